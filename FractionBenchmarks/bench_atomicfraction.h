@@ -0,0 +1,74 @@
+#pragma once
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/atomicfraction.h"
+
+/* Runs update(threadIndex) additionsCount times on each thread
+*/
+template<typename Update>
+void runConcurrentUpdates(size_t threadsCount, size_t additionsCount, Update&& update)
+{
+    std::vector<std::thread> threads;
+
+    for (size_t threadIndex{0}; threadIndex < threadsCount; ++threadIndex)
+    {
+        threads.emplace_back([&update, additionsCount, threadIndex]()
+        {
+            for (size_t addition{0}; addition < additionsCount; ++addition)
+            {
+                update(threadIndex);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/* Shared counter updated by all threads: mutex protected Fraction compared to AtomicFraction (CAS loop) and the sharded accumulator
+   (the increments have small denominators so that the sums never overflow)
+*/
+inline void runAtomicFractionBenchmarks(const BenchmarkOptions& options)
+{
+    const size_t cThreadsCount{0 != options.threadsCount ? options.threadsCount : std::max<size_t>(std::thread::hardware_concurrency(), 2)};
+    const size_t cAdditionsCount{getMaxSize(options, 1 << 16)};
+    const Fraction cIncrement{1, 4};
+
+    std::mutex mutex;
+    Fraction lockedSum;
+
+    printBenchmarkResult("atomicFraction.mutexFraction", cAdditionsCount, measureMilliseconds([&]()
+    {
+        runConcurrentUpdates(cThreadsCount, cAdditionsCount, [&](size_t)
+        {
+            const std::lock_guard<std::mutex> cLock{mutex};
+            lockedSum += cIncrement;
+        });
+
+        lockedSum = 0;
+    }), std::to_string(cThreadsCount) + " threads");
+
+    AtomicFraction atomicSum;
+
+    printBenchmarkResult("atomicFraction.fetchAdd", cAdditionsCount, measureMilliseconds([&]()
+    {
+        runConcurrentUpdates(cThreadsCount, cAdditionsCount, [&](size_t) {atomicSum.fetchAdd(cIncrement, std::memory_order_relaxed);});
+        atomicSum.store(Fraction{});
+    }), std::to_string(cThreadsCount) + " threads");
+
+    ShardedFractionAccumulator shardedSum;
+
+    printBenchmarkResult("atomicFraction.shardedAccumulator", cAdditionsCount, measureMilliseconds([&]()
+    {
+        runConcurrentUpdates(cThreadsCount, cAdditionsCount, [&](size_t) {shardedSum.add(cIncrement);});
+        (void)shardedSum.getSum();
+        shardedSum.reset();
+    }), std::to_string(cThreadsCount) + " threads, " + std::to_string(shardedSum.getShardsCount()) + " shards");
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cmath>
+#include <string>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/continuedfraction.h"
+#include "../FractionLib/fractionbatch.h"
+
+inline void runContinuedFractionBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cMaxSize{getMaxSize(options, 1 << 20)};
+
+    for (size_t size{1 << 14}; size <= cMaxSize; size *= 4)
+    {
+        // values with large terms, like the results of long computations
+        std::vector<Fraction> fractions(size);
+        std::vector<Fraction> results(size);
+
+        for (Fraction& fraction : fractions)
+        {
+            fraction = createRandomFraction(generator, 2000000000, 2000000000);
+        }
+
+        printBenchmarkResult("continuedFractions.expand", size, measureMilliseconds([&fractions]()
+        {
+            size_t termsCount{0};
+
+            for (const Fraction& fraction : fractions)
+            {
+                termsCount += ContinuedFraction{fraction}.getTerms().size();
+            }
+
+            (void)termsCount;
+        }));
+
+        for (const int cMaxDenominator : {1000, 1000000})
+        {
+            printBenchmarkResult("continuedFractions.limitDenominators(" + std::to_string(cMaxDenominator) + ")", size,
+                                 measureMilliseconds([&fractions, &results, cMaxDenominator]() {limitDenominators(fractions, results, cMaxDenominator);}));
+        }
+    }
+
+    // quantization of measured values: trying the denominators one by one compared to the Stern-Brocot search
+    std::uniform_real_distribution<double> valueDistribution{-100.0, 100.0};
+
+    for (size_t size{1 << 10}; size <= cMaxSize / 64; size *= 4)
+    {
+        std::vector<double> values(size);
+        std::vector<Fraction> results(size);
+
+        for (double& value : values)
+        {
+            value = valueDistribution(generator);
+        }
+
+        for (const double cTolerance : {1e-3, 1e-6})
+        {
+            const std::string cDetails{"tolerance " + std::to_string(cTolerance)};
+
+            printBenchmarkResult("continuedFractions.quantizeBruteForce", size, measureMilliseconds([&values, &results, cTolerance]()
+            {
+                for (size_t index{0}; index < values.size(); ++index)
+                {
+                    for (int denominator{1}; ; ++denominator)
+                    {
+                        const Fraction cCandidate{static_cast<int>(std::lround(values[index] * denominator)), denominator};
+
+                        if (std::abs(cCandidate.getDecimalValue() - values[index]) <= cTolerance)
+                        {
+                            results[index] = cCandidate;
+                            break;
+                        }
+                    }
+                }
+            }), cDetails);
+
+            printBenchmarkResult("continuedFractions.quantizeValues", size, measureMilliseconds([&values, &results, cTolerance]()
+            {
+                quantizeValues(values, results, cTolerance);
+            }), cDetails);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "benchmarkutils.h"
+
+/* Decimal report of many fractions: digit by digit long division into new strings compared to 9 digits per step into a preallocated buffer
+*/
+inline void runDecimalStringBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cSize{getMaxSize(options, 1 << 16)};
+    std::vector<Fraction> fractions(cSize);
+
+    for (Fraction& fraction : fractions)
+    {
+        fraction = createRandomFraction(generator, 2000000000, 2000000000);
+    }
+
+    for (const int cDigits : {20, 100})
+    {
+        const std::string cDetails{std::to_string(cDigits) + " digits"};
+
+        printBenchmarkResult("decimalStrings.digitByDigit", cSize, measureMilliseconds([&fractions, cDigits]()
+        {
+            std::vector<std::string> report;
+            report.reserve(fractions.size());
+
+            for (const Fraction& fraction : fractions)
+            {
+                const long long cNumerator{fraction.getNumerator()};
+                const long long cDenominator{fraction.getDenominator()};
+                std::string decimalString{(cNumerator < 0 ? "-" : "") + std::to_string(std::abs(cNumerator) / cDenominator) + "."};
+                long long remainder{std::abs(cNumerator) % cDenominator};
+
+                for (int digitIndex{0}; digitIndex < cDigits; ++digitIndex)
+                {
+                    remainder *= 10;
+                    decimalString.push_back(static_cast<char>('0' + remainder / cDenominator));
+                    remainder %= cDenominator;
+                }
+
+                report.push_back(std::move(decimalString));
+            }
+        }), cDetails);
+
+        printBenchmarkResult("decimalStrings.toDecimalStringBuffer", cSize, measureMilliseconds([&fractions, cDigits]()
+        {
+            const size_t cSlotSize{Fraction::getMaxDecimalStringLength(cDigits)};
+            std::vector<char> report(fractions.size() * cSlotSize);
+            std::vector<size_t> lengths(fractions.size());
+
+            for (size_t index{0}; index < fractions.size(); ++index)
+            {
+                lengths[index] = fractions[index].toDecimalString(std::span<char>{report.data() + index * cSlotSize, cSlotSize}, cDigits,
+                                                                  Fraction::RoundingMode::TOWARD_ZERO);
+            }
+        }), cDetails);
+    }
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "benchmarkutils.h"
+
+/* Accumulation loops: assigning the results of the binary operators compared to the in-place compound assignment operators;
+   operand shapes with fast paths (integer operands, equal denominators) compared to the general path of the non-throwing API
+*/
+inline void runFractionArithmeticBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    std::uniform_int_distribution<int> numeratorDistribution{-5, 5};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 12};
+    const size_t cMaxSize{getMaxSize(options, 1 << 20)};
+
+    for (size_t size{1 << 14}; size <= cMaxSize; size *= 4)
+    {
+        // small denominators and alternating signs keep the sums within the int range
+        std::vector<Fraction> fractions(size);
+
+        for (Fraction& fraction : fractions)
+        {
+            fraction = Fraction{numeratorDistribution(generator), denominatorDistribution(generator)};
+        }
+
+        std::vector<Fraction> ratios(fractions);
+
+        for (Fraction& ratio : ratios)
+        {
+            if (0 == ratio.getNumerator())
+            {
+                ratio = Fraction{7, 5};
+            }
+        }
+
+        printBenchmarkResult("fractionArithmetic.sumBinaryOperator", size, measureMilliseconds([&fractions]()
+        {
+            Fraction sum;
+
+            for (const Fraction& fraction : fractions)
+            {
+                sum = sum + fraction;
+            }
+        }));
+
+        printBenchmarkResult("fractionArithmetic.sumCompoundOperator", size, measureMilliseconds([&fractions]()
+        {
+            Fraction sum;
+
+            for (const Fraction& fraction : fractions)
+            {
+                sum += fraction;
+            }
+        }));
+
+        // multiplying and dividing back by each ratio
+        printBenchmarkResult("fractionArithmetic.scaleBinaryOperators", size, measureMilliseconds([&ratios]()
+        {
+            Fraction value{3, 7};
+
+            for (const Fraction& ratio : ratios)
+            {
+                value = value * ratio;
+                value = value / ratio;
+            }
+        }));
+
+        printBenchmarkResult("fractionArithmetic.scaleCompoundOperators", size, measureMilliseconds([&ratios]()
+        {
+            Fraction value{3, 7};
+
+            for (const Fraction& ratio : ratios)
+            {
+                (value *= ratio) /= ratio;
+            }
+        }));
+    }
+
+    const size_t cShapesSize{getMaxSize(options, 1 << 18)};
+    std::uniform_int_distribution<int> termDistribution{1, 10000};
+    std::vector<Fraction> first(cShapesSize);
+    std::vector<Fraction> integers(cShapesSize);
+    std::vector<Fraction> sameDenominators(cShapesSize);
+    std::vector<Fraction> results(cShapesSize);
+
+    for (size_t index{0}; index < cShapesSize; ++index)
+    {
+        first[index] = Fraction{termDistribution(generator), 10007};
+        integers[index] = Fraction{termDistribution(generator)};
+        sameDenominators[index] = Fraction{termDistribution(generator), 10007};
+    }
+
+    const std::vector<std::pair<std::string, const std::vector<Fraction>*>> cShapes{{"IntegerOperands", &integers}, {"SameDenominators", &sameDenominators}};
+
+    for (const auto& [shapeName, operands] : cShapes)
+    {
+        printBenchmarkResult("fractionArithmetic.add" + shapeName, cShapesSize, measureMilliseconds([&first, operands, &results]()
+        {
+            for (size_t index{0}; index < first.size(); ++index)
+            {
+                results[index] = first[index] + (*operands)[index];
+            }
+        }));
+
+        printBenchmarkResult("fractionArithmetic.add" + shapeName + "GeneralPath", cShapesSize, measureMilliseconds([&first, operands, &results]()
+        {
+            for (size_t index{0}; index < first.size(); ++index)
+            {
+                results[index] = *first[index].tryAdd((*operands)[index]);
+            }
+        }));
+    }
+
+    printBenchmarkResult("fractionArithmetic.multiplyIntegerOperands", cShapesSize, measureMilliseconds([&first, &integers, &results]()
+    {
+        for (size_t index{0}; index < first.size(); ++index)
+        {
+            results[index] = first[index] * integers[index];
+        }
+    }));
+
+    printBenchmarkResult("fractionArithmetic.multiplyIntegerOperandsGeneralPath", cShapesSize, measureMilliseconds([&first, &integers, &results]()
+    {
+        for (size_t index{0}; index < first.size(); ++index)
+        {
+            results[index] = *first[index].tryMultiply(integers[index]);
+        }
+    }));
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <string_view>
+#include <memory_resource>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionarray.h"
+
+/* Allocation free parsing paths and arrays allocated from memory resources: global heap compared to a monotonic arena per thread
+*/
+inline void runFractionArrayBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cSize{getMaxSize(options, 1 << 18)};
+    const size_t cSmallArraySize{64};
+    std::vector<std::string> strings(cSize);
+    std::vector<double> decimalValues(cSize);
+    std::string lines;
+
+    for (size_t index{0}; index < cSize; ++index)
+    {
+        const Fraction cFraction{createRandomFraction(generator, 100000, 1000)};
+
+        strings[index] = 0 == index % 2 ? std::to_string(cFraction.getNumerator()) + "/" + std::to_string(cFraction.getDenominator())
+                                        : std::to_string(cFraction.getNumerator()) + "." + std::to_string(cFraction.getDenominator());
+        decimalValues[index] = cFraction.getDecimalValue();
+        lines += strings[index] + "\n";
+    }
+
+    const std::vector<std::string_view> cViews(strings.cbegin(), strings.cend());
+
+    printBenchmarkResult("fractionArray.doubleViaStream", cSize, measureMilliseconds([&decimalValues]()
+    {
+        // the previous conversion of Fraction(double): the value is formatted by a string stream
+        long long sum{0};
+
+        for (const double cValue : decimalValues)
+        {
+            std::ostringstream decimalStream;
+            decimalStream << cValue;
+            sum += static_cast<long long>(decimalStream.str().size());
+        }
+
+        (void)sum;
+    }));
+
+    printBenchmarkResult("fractionArray.doubleConstructor", cSize, measureMilliseconds([&decimalValues]()
+    {
+        long long sum{0};
+
+        for (const double cValue : decimalValues)
+        {
+            sum += Fraction{cValue}.getDenominator();
+        }
+
+        (void)sum;
+    }));
+
+    printBenchmarkResult("fractionArray.streamOperator", cSize, measureMilliseconds([&lines, cSize]()
+    {
+        std::istringstream stream{lines};
+        std::vector<Fraction> fractions(cSize);
+
+        for (Fraction& fraction : fractions)
+        {
+            stream >> fraction;
+        }
+    }));
+
+    printBenchmarkResult("fractionArray.readFractionArrayHeap", cSize, measureMilliseconds([&lines]()
+    {
+        std::istringstream stream{lines};
+        (void)readFractionArray(stream);
+    }));
+
+    printBenchmarkResult("fractionArray.readFractionArrayArena", cSize, measureMilliseconds([&lines]()
+    {
+        std::istringstream stream{lines};
+        std::pmr::monotonic_buffer_resource arena;
+        (void)readFractionArray(stream, &arena);
+    }));
+
+    // many small arrays per thread (e.g. one per request), released at the end of the job
+    const size_t cThreadsCount{0 == options.threadsCount ? std::max(1u, std::thread::hardware_concurrency()) : options.threadsCount};
+    const std::string cThreadsDetails{std::to_string(cThreadsCount) + " threads"};
+
+    const auto cParseSmallArrays{[&cViews, cSmallArraySize, cThreadsCount](bool useArena)
+    {
+        std::vector<std::thread> threads;
+
+        for (size_t threadIndex{0}; threadIndex < cThreadsCount; ++threadIndex)
+        {
+            threads.emplace_back([&cViews, cSmallArraySize, useArena]()
+            {
+                std::pmr::monotonic_buffer_resource arena;
+                std::pmr::memory_resource* const cMemoryResource{useArena ? &arena : std::pmr::new_delete_resource()};
+                std::vector<FractionArray> arrays;
+                FractionContext context;
+
+                for (size_t begin{0}; begin + cSmallArraySize <= cViews.size(); begin += cSmallArraySize)
+                {
+                    arrays.push_back(parseFractionArray(std::span<const std::string_view>{cViews.data() + begin, cSmallArraySize}, cMemoryResource, context));
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }};
+
+    printBenchmarkResult("fractionArray.smallArraysHeap", cSize, measureMilliseconds([&cParseSmallArrays]()
+    {
+        cParseSmallArrays(false);
+    }), cThreadsDetails);
+
+    printBenchmarkResult("fractionArray.smallArraysArena", cSize, measureMilliseconds([&cParseSmallArrays]()
+    {
+        cParseSmallArrays(true);
+    }), cThreadsDetails);
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <map>
+#include <vector>
+#include <algorithm>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionbtree.h"
+
+/* Ordered index of fractions: std::map compared to the B+ tree (larger sizes, e.g. 10^8 keys, can be run with --max-size)
+*/
+inline void runFractionBTreeBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cMaxSize{getMaxSize(options, 1 << 20)};
+    const size_t cQueriesCount{1 << 16};
+
+    for (size_t size{1 << 14}; size <= cMaxSize; size *= 4)
+    {
+        std::vector<Fraction> keys(size);
+        std::vector<int> values(size);
+        std::vector<Fraction> queries(cQueriesCount);
+
+        for (size_t index{0}; index < size; ++index)
+        {
+            keys[index] = createRandomFraction(generator, 100000, 1000);
+            values[index] = static_cast<int>(index);
+        }
+
+        for (Fraction& query : queries)
+        {
+            query = createRandomFraction(generator, 100000, 1000);
+        }
+
+        std::map<Fraction, int> map;
+        FractionBTree<int> tree;
+
+        printBenchmarkResult("fractionBTree.mapInsert", size, measureMilliseconds([&keys, &values, &map]()
+        {
+            map.clear();
+
+            for (size_t index{0}; index < keys.size(); ++index)
+            {
+                map.emplace(keys[index], values[index]);
+            }
+        }));
+
+        printBenchmarkResult("fractionBTree.treeInsert", size, measureMilliseconds([&keys, &values, &tree]()
+        {
+            tree.clear();
+
+            for (size_t index{0}; index < keys.size(); ++index)
+            {
+                tree.insert(keys[index], values[index]);
+            }
+        }));
+
+        // sorted unique keys for the bulk loading
+        std::vector<Fraction> sortedKeys;
+        std::vector<int> sortedValues;
+
+        for (const auto& [cKey, cValue] : map)
+        {
+            sortedKeys.push_back(cKey);
+            sortedValues.push_back(cValue);
+        }
+
+        printBenchmarkResult("fractionBTree.mapFromSorted", size, measureMilliseconds([&sortedKeys, &sortedValues, &map]()
+        {
+            map.clear();
+
+            for (size_t index{0}; index < sortedKeys.size(); ++index)
+            {
+                map.emplace_hint(map.end(), sortedKeys[index], sortedValues[index]);
+            }
+        }));
+
+        printBenchmarkResult("fractionBTree.treeFromSorted", size, measureMilliseconds([&sortedKeys, &sortedValues, &tree]()
+        {
+            tree = FractionBTree<int>::fromSorted(sortedKeys, sortedValues);
+        }));
+
+        const std::string cQueriesDetails{std::to_string(cQueriesCount) + " queries"};
+
+        printBenchmarkResult("fractionBTree.mapLowerBound", size, measureMilliseconds([&queries, &map]()
+        {
+            long long sum{0};
+
+            for (const Fraction& query : queries)
+            {
+                const auto cIt{map.lower_bound(query)};
+                sum += map.end() == cIt ? 0 : cIt->second;
+            }
+
+            (void)sum;
+        }), cQueriesDetails);
+
+        printBenchmarkResult("fractionBTree.treeLowerBound", size, measureMilliseconds([&queries, &tree]()
+        {
+            long long sum{0};
+
+            for (const Fraction& query : queries)
+            {
+                const FractionBTree<int>::Iterator cIt{tree.lowerBound(query)};
+                sum += tree.end() == cIt ? 0 : (*cIt).value;
+            }
+
+            (void)sum;
+        }), cQueriesDetails);
+
+        // ranges of width 1/4 (the terms are small enough for the int products of the std::map comparisons)
+        printBenchmarkResult("fractionBTree.mapRange", size, measureMilliseconds([&queries, &map]()
+        {
+            long long sum{0};
+
+            for (size_t query{0}; query < queries.size() / 64; ++query)
+            {
+                const Fraction cUpper{queries[query] + Fraction{1, 4}};
+
+                for (auto it{map.lower_bound(queries[query])}; map.end() != it && !(cUpper < it->first); ++it)
+                {
+                    sum += it->second;
+                }
+            }
+
+            (void)sum;
+        }), std::to_string(cQueriesCount / 64) + " ranges");
+
+        printBenchmarkResult("fractionBTree.treeRange", size, measureMilliseconds([&queries, &tree]()
+        {
+            long long sum{0};
+
+            for (size_t query{0}; query < queries.size() / 64; ++query)
+            {
+                tree.forEachInRange(queries[query], queries[query] + Fraction{1, 4}, [&sum](const Fraction&, int value) {sum += value;});
+            }
+
+            (void)sum;
+        }), std::to_string(cQueriesCount / 64) + " ranges");
+    }
+}
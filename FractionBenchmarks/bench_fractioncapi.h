@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractioncapi.h"
+
+/* C interface: one call per value (as done by the per-value FFI shims) compared to one call per batch
+*/
+inline void runFractionCApiBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cMaxSize{getMaxSize(options, 1 << 20)};
+
+    for (size_t size{1 << 14}; size <= cMaxSize; size *= 4)
+    {
+        std::vector<std::string> strings(size);
+        std::vector<const char*> stringPointers(size);
+        std::vector<size_t> lengths(size);
+        std::vector<FractionLibValue> first(size);
+        std::vector<FractionLibValue> second(size);
+        std::vector<FractionLibValue> results(size);
+        std::vector<int32_t> statuses(size);
+
+        for (size_t index{0}; index < size; ++index)
+        {
+            const Fraction cFirst{createRandomFraction(generator, 100000, 100000)};
+            const Fraction cSecond{createRandomFraction(generator, 100000, 100000)};
+
+            strings[index] = std::to_string(cFirst.getNumerator()) + "/" + std::to_string(cFirst.getDenominator());
+            stringPointers[index] = strings[index].c_str();
+            lengths[index] = strings[index].size();
+            first[index] = FractionLibValue{cFirst.getNumerator(), cFirst.getDenominator()};
+            second[index] = FractionLibValue{cSecond.getNumerator(), cSecond.getDenominator()};
+        }
+
+        printBenchmarkResult("fractionCApi.parsePerValue", size, measureMilliseconds([&stringPointers, &lengths, &results, &statuses]()
+        {
+            for (size_t index{0}; index < stringPointers.size(); ++index)
+            {
+                fractionlib_parse_batch(&stringPointers[index], &lengths[index], 1, &results[index], &statuses[index]);
+            }
+        }));
+
+        printBenchmarkResult("fractionCApi.parseBatch", size, measureMilliseconds([&stringPointers, &lengths, &results, &statuses]()
+        {
+            fractionlib_parse_batch(stringPointers.data(), lengths.data(), stringPointers.size(), results.data(), statuses.data());
+        }));
+
+        printBenchmarkResult("fractionCApi.addPerValue", size, measureMilliseconds([&first, &second, &results, &statuses]()
+        {
+            for (size_t index{0}; index < first.size(); ++index)
+            {
+                fractionlib_add_batch(&first[index], &second[index], 1, &results[index], &statuses[index]);
+            }
+        }));
+
+        printBenchmarkResult("fractionCApi.addBatch", size, measureMilliseconds([&first, &second, &results, &statuses]()
+        {
+            fractionlib_add_batch(first.data(), second.data(), first.size(), results.data(), statuses.data());
+        }));
+
+        printBenchmarkResult("fractionCApi.sort", size, measureMilliseconds([&first, &results, &statuses]()
+        {
+            std::copy(first.cbegin(), first.cend(), results.begin());
+            fractionlib_sort(results.data(), results.size(), statuses.data());
+        }));
+
+        std::vector<char> buffer(size * FRACTIONLIB_FORMAT_SLOT_SIZE);
+
+        printBenchmarkResult("fractionCApi.formatBatch", size, measureMilliseconds([&first, &buffer, &statuses]()
+        {
+            fractionlib_format_batch(first.data(), first.size(), buffer.data(), statuses.data());
+        }));
+    }
+}
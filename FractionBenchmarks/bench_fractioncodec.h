@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractioncodec.h"
+
+/* Compressed fraction streams: encoded size compared to the text form and to fixed 8 byte records (two ints), encoding and decoding
+   time (one thread and a scheduler of options.threadsCount threads) for random, sorted and repeated denominator sequences
+*/
+inline void runFractionCodecBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2025};
+
+    const size_t cMaxSize{getMaxSize(options, 1 << 20)};
+    FractionScheduler serialScheduler{1};
+    FractionScheduler scheduler{options.threadsCount};
+
+    for (size_t size{1 << 14}; size <= cMaxSize; size *= 8)
+    {
+        std::vector<Fraction> randomFractions(size);
+        std::vector<Fraction> sortedFractions(size);
+        std::vector<Fraction> repeatedDenominators(size);
+
+        for (size_t index{0}; index < size; ++index)
+        {
+            randomFractions[index] = createRandomFraction(generator, 1000000, 1000);
+            sortedFractions[index] = Fraction{static_cast<int>(index) * 3 + 1, 100};
+            repeatedDenominators[index] = createRandomFraction(generator, 1000, 1) / Fraction{static_cast<int>(index / 1024 + 2)};
+        }
+
+        std::sort(sortedFractions.begin(), sortedFractions.end());
+
+        for (const auto& [cName, cFractions] : {std::pair<std::string, const std::vector<Fraction>*>{"random", &randomFractions},
+                                                {"sorted", &sortedFractions}, {"repeatedDenominators", &repeatedDenominators}})
+        {
+            std::ostringstream textStream;
+
+            for (Fraction fraction : *cFractions)
+            {
+                textStream << fraction << '\n';
+            }
+
+            const std::string cEncoded{encodeFractions(*cFractions)};
+            const double cTextRatio{static_cast<double>(textStream.str().size()) / static_cast<double>(cEncoded.size())};
+            const double cRecordRatio{static_cast<double>(size * 8) / static_cast<double>(cEncoded.size())};
+            const std::string cSizeDetails{std::to_string(cEncoded.size()) + " bytes, " + std::to_string(cTextRatio) + "x smaller than text, " +
+                                           std::to_string(cRecordRatio) + "x smaller than 8 byte records"};
+
+            printBenchmarkResult("fractionCodec.encode." + cName, size, measureMilliseconds([&cFractions]()
+            {
+                (void)encodeFractions(*cFractions);
+            }), cSizeDetails);
+
+            const FractionDecoder cDecoder{cEncoded};
+
+            printBenchmarkResult("fractionCodec.decodeSerial." + cName, size, measureMilliseconds([&cDecoder, &serialScheduler]()
+            {
+                (void)cDecoder.decode(serialScheduler);
+            }));
+
+            printBenchmarkResult("fractionCodec.decodeParallel." + cName, size, measureMilliseconds([&cDecoder, &scheduler]()
+            {
+                (void)cDecoder.decode(scheduler);
+            }));
+        }
+    }
+}
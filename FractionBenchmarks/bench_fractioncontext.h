@@ -0,0 +1,36 @@
+#pragma once
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionbatch.h"
+
+/* Cost of the overflow checked batch operations compared to the plain (wrapping) operators
+*/
+inline void runFractionContextBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cSize{getMaxSize(options, 1 << 18)};
+    std::vector<Fraction> first(cSize);
+    std::vector<Fraction> second(cSize);
+    std::vector<Fraction> results(cSize);
+
+    for (size_t index{0}; index < cSize; ++index)
+    {
+        first[index] = createRandomFraction(generator, 100000, 100000);
+        second[index] = createRandomFraction(generator, 100000, 100000);
+    }
+
+    printBenchmarkResult("fractionContext.plainMultiply", cSize, measureMilliseconds([&first, &second, &results]()
+    {
+        for (size_t index{0}; index < first.size(); ++index)
+        {
+            results[index] = first[index] * second[index];
+        }
+    }));
+
+    FractionContext context;
+
+    printBenchmarkResult("fractionContext.multiplyFractions", cSize, measureMilliseconds([&first, &second, &results, &context]()
+    {
+        multiplyFractions(first, second, results, context);
+    }), context.isRaised(FractionError::ARITHMETIC_OVERFLOW) ? "overflow flag raised" : "");
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <stdexcept>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractioncsvreader.h"
+
+// "size MB/s" details of a CSV read
+inline std::string getThroughputDetails(size_t bytesCount, double milliseconds)
+{
+    const double cMegabytes{bytesCount / (1024.0 * 1024.0)};
+
+    return std::to_string(milliseconds > 0.0 ? cMegabytes / (milliseconds / 1000.0) : 0.0) + " MB/s";
+}
+
+/* CSV columns of fractions, decimals and integers: serial getline, split and Fraction(std::string) compared to the chunked reader
+*/
+inline void runFractionCsvReaderBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cMaxSize{getMaxSize(options, 1 << 20)};
+    const size_t cColumnsCount{4};
+    FractionScheduler serialScheduler{1};
+    FractionScheduler scheduler{options.threadsCount};
+
+    for (size_t size{1 << 14}; size <= cMaxSize; size *= 4)
+    {
+        // one column per format and a column mixing them, every 1000th row has a bad cell
+        std::string text{"fraction,decimal,integer,mixed\n"};
+
+        for (size_t row{0}; row < size; ++row)
+        {
+            const Fraction cValue{createRandomFraction(generator, 1000000, 1000)};
+
+            text += std::to_string(cValue.getNumerator()) + "/" + std::to_string(cValue.getDenominator()) + ",";
+            text += std::to_string(cValue.getNumerator()) + "." + std::to_string(cValue.getDenominator()) + ",";
+            text += std::to_string(cValue.getNumerator()) + ",";
+            text += 0 == row % 1000 ? "n/a" : 0 == row % 3 ? "\"-0.5\"" : std::to_string(cValue.getDenominator());
+            text += "\n";
+        }
+
+        const std::string cSizeDetails{std::to_string(text.size() / 1024) + " KB"};
+
+        double milliseconds{measureMilliseconds([&text, cColumnsCount]()
+        {
+            std::istringstream stream{text};
+            std::vector<std::vector<Fraction>> columns(cColumnsCount);
+            std::string line;
+            std::string field;
+            size_t errorsCount{0};
+
+            std::getline(stream, line);
+
+            while (std::getline(stream, line))
+            {
+                std::istringstream lineStream{line};
+
+                for (size_t column{0}; column < cColumnsCount && std::getline(lineStream, field, ','); ++column)
+                {
+                    if (!field.empty() && '"' == field.front())
+                    {
+                        field = field.substr(1, field.size() - 2);
+                    }
+
+                    try
+                    {
+                        columns[column].push_back(Fraction{field});
+                    }
+                    catch (const std::runtime_error&)
+                    {
+                        columns[column].push_back(Fraction{});
+                        ++errorsCount;
+                    }
+                }
+            }
+
+            (void)errorsCount;
+        })};
+
+        printBenchmarkResult("fractionCsvReader.getlineSplit", size, milliseconds, cSizeDetails + ", " + getThroughputDetails(text.size(), milliseconds));
+
+        milliseconds = measureMilliseconds([&text, &serialScheduler]()
+        {
+            (void)FractionCsvReader{',', true, serialScheduler}.read(text);
+        });
+
+        printBenchmarkResult("fractionCsvReader.read", size, milliseconds, cSizeDetails + ", " + getThroughputDetails(text.size(), milliseconds));
+
+        milliseconds = measureMilliseconds([&text, &scheduler]()
+        {
+            (void)FractionCsvReader{',', true, scheduler}.read(text);
+        });
+
+        printBenchmarkResult("fractionCsvReader.readThreads", size, milliseconds, cSizeDetails + ", " + getThroughputDetails(text.size(), milliseconds));
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionformula.h"
+
+/* Evaluation of "1/2 + 3/4 * (x - 0.25)" over rows: the literals parsed on each evaluation compared to the compiled formula
+*/
+inline void runFractionFormulaBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{34};
+    const size_t cRowsCount{getMaxSize(options, 1 << 18)};
+    std::vector<Fraction> rows(cRowsCount);
+    std::vector<Fraction> results(cRowsCount);
+
+    for (Fraction& row : rows)
+    {
+        row = createRandomFraction(generator, 1000, 1000);
+    }
+
+    printBenchmarkResult("fractionFormula.parsedLiterals", cRowsCount, measureMilliseconds([&rows, &results]()
+    {
+        for (size_t row{0}; row < rows.size(); ++row)
+        {
+            results[row] = Fraction{"1/2"} + Fraction{"3/4"} * (rows[row] - Fraction{"0.25"});
+        }
+    }));
+
+    const FractionFormula cFormula{"1/2 + 3/4 * (x - 0.25)"};
+    FractionScheduler serialScheduler{1};
+    FractionScheduler scheduler{options.threadsCount};
+    FractionContext context;
+
+    printBenchmarkResult("fractionFormula.compiled", cRowsCount, measureMilliseconds([&cFormula, &rows, &results, &serialScheduler, &context]()
+    {
+        cFormula.evaluateRows(rows, results, serialScheduler, context);
+    }), "1 thread");
+
+    printBenchmarkResult("fractionFormula.compiledThreads", cRowsCount, measureMilliseconds([&cFormula, &rows, &results, &scheduler, &context]()
+    {
+        cFormula.evaluateRows(rows, results, scheduler, context);
+    }));
+}
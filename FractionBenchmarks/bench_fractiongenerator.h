@@ -0,0 +1,57 @@
+#pragma once
+
+#include <sstream>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractiongenerator.h"
+
+// sum of the positive fractions of the stream (function pointer stage, see the generator tests)
+inline bool isPositiveFraction(const Fraction& fraction)
+{
+    return fraction.getNumerator() > 0;
+}
+
+inline Fraction addFraction(Fraction sum, const Fraction& fraction)
+{
+    return sum + fraction;
+}
+
+/* Reading a stream of fractions: the operator>> loop compared to the generator pipeline (readFractions -> filter -> reduce)
+*/
+inline void runFractionGeneratorBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{36};
+    const size_t cLinesCount{getMaxSize(options, 1 << 17)};
+    std::ostringstream outputStream;
+
+    for (size_t line{0}; line < cLinesCount; ++line)
+    {
+        Fraction fraction{createRandomFraction(generator, 100, 6)};
+        outputStream << fraction << "\n";
+    }
+
+    const std::string cInput{outputStream.str()};
+
+    printBenchmarkResult("fractionGenerator.extractionOperator", cLinesCount, measureMilliseconds([&cInput]()
+    {
+        std::istringstream inputStream{cInput};
+        Fraction sum;
+        Fraction fraction;
+
+        while (inputStream.peek() != std::char_traits<char>::eof())
+        {
+            inputStream >> fraction;
+
+            if (isPositiveFraction(fraction))
+            {
+                sum = sum + fraction;
+            }
+        }
+    }));
+
+    printBenchmarkResult("fractionGenerator.pipeline", cLinesCount, measureMilliseconds([&cInput]()
+    {
+        std::istringstream inputStream{cInput};
+        (void)reduce(filter(readFractions(inputStream), isPositiveFraction), Fraction{}, addFraction);
+    }));
+}
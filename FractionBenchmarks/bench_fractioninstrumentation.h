@@ -0,0 +1,33 @@
+#pragma once
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractioninstrumentation.h"
+
+/* Fraction arithmetic throughput, to be compared between builds with and without FRACTIONLIB_INSTRUMENTATION
+*/
+inline void runFractionInstrumentationBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cSize{getMaxSize(options, 1 << 18)};
+    const std::string cDetails{FractionInstrumentation::isEnabled() ? "instrumentation=on" : "instrumentation=off"};
+    std::vector<Fraction> fractions(cSize);
+
+    for (Fraction& fraction : fractions)
+    {
+        fraction = createRandomFraction(generator, 1000, 1000);
+    }
+
+    printBenchmarkResult("fractionInstrumentation.arithmetic", cSize, measureMilliseconds([&fractions]()
+    {
+        Fraction sum;
+
+        for (size_t index{1}; index < fractions.size(); ++index)
+        {
+            sum = fractions[index] * fractions[index - 1] + fractions[index];
+        }
+
+        (void)sum;
+    }), cDetails);
+
+    printBenchmarkResult("fractionInstrumentation.snapshot", 1, measureMilliseconds([]() {(void)FractionInstrumentation::getSnapshot().toPrometheusText();}), cDetails);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionmatrix.h"
+
+inline FractionMatrix createRandomFractionMatrix(size_t size, std::mt19937& generator, int maxNumerator, int maxDenominator)
+{
+    FractionMatrix matrix{size, size};
+
+    for (size_t row{0}; row < size; ++row)
+    {
+        for (size_t column{0}; column < size; ++column)
+        {
+            matrix(row, column) = createRandomFraction(generator, maxNumerator, maxDenominator);
+        }
+    }
+
+    return matrix;
+}
+
+inline void runFractionMatrixBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cMaxSize{getMaxSize(options, 512)};
+    FractionScheduler scheduler{options.threadsCount};
+
+    for (size_t size{16}; size <= cMaxSize; size *= 2)
+    {
+        // denominators are powers of 2 so the dot products of the multiplication stay within the int range
+        const FractionMatrix cFirst{createRandomFractionMatrix(size, generator, 9, 1)};
+        FractionMatrix second{createRandomFractionMatrix(size, generator, 9, 1)};
+
+        for (size_t row{0}; row < size; ++row)
+        {
+            for (size_t column{0}; column < size; ++column)
+            {
+                second(row, column) = Fraction{second(row, column).getNumerator(), 1 << (row + column) % 3};
+            }
+        }
+
+        printBenchmarkResult("fractionMatrices.multiply", size, measureMilliseconds([&cFirst, &second, &scheduler]() {(void)cFirst.multiply(second, scheduler);}));
+
+        const FractionMatrix cSystemMatrix{createRandomFractionMatrix(size, generator, 9, 3)};
+        std::vector<Fraction> rightHandSide(size);
+
+        for (Fraction& element : rightHandSide)
+        {
+            element = createRandomFraction(generator, 9, 3);
+        }
+
+        printBenchmarkResult("fractionMatrices.determinant", size, measureMilliseconds([&cSystemMatrix]() {(void)cSystemMatrix.getDeterminant();}));
+        printBenchmarkResult("fractionMatrices.rank", size, measureMilliseconds([&cSystemMatrix]() {(void)cSystemMatrix.getRank();}));
+        printBenchmarkResult("fractionMatrices.solve", size, measureMilliseconds([&cSystemMatrix, &rightHandSide]() {(void)cSystemMatrix.solve(rightHandSide);}));
+        printBenchmarkResult("fractionMatrices.inverse", size, measureMilliseconds([&cSystemMatrix]() {(void)cSystemMatrix.getInverse();}));
+    }
+}
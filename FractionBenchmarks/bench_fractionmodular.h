@@ -0,0 +1,114 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionmodular.h"
+
+/* Multi-modular computations (residues per prime, Chinese remaindering and rational reconstruction) compared to the exact wide arithmetic
+*/
+inline void runFractionModularBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    FractionScheduler scheduler{options.threadsCount};
+    FractionModular modular{scheduler};
+
+    const auto cGetDetails{[&modular]()
+    {
+        return std::to_string(modular.getStatistics().primesCount) + " primes, " + std::to_string(modular.getStatistics().roundsCount) + " rounds";
+    }};
+
+    const size_t cMaxSize{getMaxSize(options, 64)};
+
+    for (size_t size{16}; size <= cMaxSize; size *= 2)
+    {
+        FractionMatrix matrix{size, size};
+        std::vector<Fraction> rightHandSide(size);
+
+        for (size_t row{0}; row < size; ++row)
+        {
+            for (size_t column{0}; column < size; ++column)
+            {
+                matrix(row, column) = createRandomFraction(generator, 1000, 100);
+            }
+
+            rightHandSide[row] = createRandomFraction(generator, 1000, 100);
+        }
+
+        printBenchmarkResult("fractionModular.solveBareiss", size, measureMilliseconds([&matrix, &rightHandSide]()
+        {
+            (void)matrix.solve(rightHandSide);
+        }));
+
+        const double cSolveMilliseconds{measureMilliseconds([&modular, &matrix, &rightHandSide]()
+        {
+            (void)modular.solve(matrix, rightHandSide);
+        })};
+
+        printBenchmarkResult("fractionModular.solveModular", size, cSolveMilliseconds, cGetDetails());
+    }
+
+    for (size_t degree{64}; degree <= cMaxSize * 8; degree *= 2)
+    {
+        std::vector<WideFraction> firstCoefficients(degree + 1);
+        std::vector<WideFraction> secondCoefficients(degree + 1);
+
+        // numerators of about 80 bits over small denominators (e.g. from a previous exact computation)
+        for (size_t power{0}; power <= degree; ++power)
+        {
+            firstCoefficients[power] = WideFraction{createRandomFraction(generator, 1000000, 16)};
+            secondCoefficients[power] = WideFraction{createRandomFraction(generator, 1000000, 16)};
+
+            for (size_t factor{0}; factor < 3; ++factor)
+            {
+                firstCoefficients[power] *= WideFraction{createRandomFraction(generator, 1000000, 1)};
+                secondCoefficients[power] *= WideFraction{createRandomFraction(generator, 1000000, 1)};
+            }
+        }
+
+        const FractionPolynomial cFirst{firstCoefficients};
+        const FractionPolynomial cSecond{secondCoefficients};
+
+        printBenchmarkResult("fractionModular.polynomialProductWide", degree, measureMilliseconds([&cFirst, &cSecond]()
+        {
+            (void)(cFirst * cSecond);
+        }));
+
+        const double cProductMilliseconds{measureMilliseconds([&modular, &cFirst, &cSecond]()
+        {
+            (void)modular.multiply(cFirst, cSecond);
+        })};
+
+        printBenchmarkResult("fractionModular.polynomialProductModular", degree, cProductMilliseconds, cGetDetails());
+    }
+
+    for (size_t size{1 << 10}; size <= cMaxSize * 256; size *= 4)
+    {
+        std::vector<Fraction> first(size);
+        std::vector<Fraction> second(size);
+
+        for (size_t index{0}; index < size; ++index)
+        {
+            first[index] = createRandomFraction(generator, 1000, 64);
+            second[index] = createRandomFraction(generator, 1000, 64);
+        }
+
+        printBenchmarkResult("fractionModular.dotWide", size, measureMilliseconds([&first, &second]()
+        {
+            WideFraction sum;
+
+            for (size_t index{0}; index < first.size(); ++index)
+            {
+                sum += WideFraction{first[index]} * WideFraction{second[index]};
+            }
+        }));
+
+        const double cDotMilliseconds{measureMilliseconds([&modular, &first, &second]()
+        {
+            (void)modular.dot(first, second);
+        })};
+
+        printBenchmarkResult("fractionModular.dotModular", size, cDotMilliseconds, cGetDetails());
+    }
+}
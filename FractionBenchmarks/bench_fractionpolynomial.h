@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionpolynomial.h"
+
+/* Polynomial values at many points: Horner's scheme with normalized fractions compared to the integer form with a single reduction per point
+*/
+inline void runFractionPolynomialBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cMaxSize{getMaxSize(options, 1 << 20)};
+
+    // degree 5 with small coefficients, evaluated at points with small terms (the values fit into a Fraction)
+    const FractionPolynomial cPolynomial{Fraction{-7, 3}, Fraction{1, 2}, Fraction{0}, Fraction{5, 6}, Fraction{-1, 4}, Fraction{1, 12}};
+    std::vector<Fraction> coefficients;
+
+    for (const WideFraction& coefficient : cPolynomial.getCoefficients())
+    {
+        coefficients.push_back(coefficient.toFraction());
+    }
+
+    FractionScheduler serialScheduler{1};
+    FractionScheduler scheduler{options.threadsCount};
+
+    for (size_t size{1 << 14}; size <= cMaxSize; size *= 4)
+    {
+        std::vector<Fraction> points(size);
+        std::vector<Fraction> results(size);
+
+        for (Fraction& point : points)
+        {
+            point = createRandomFraction(generator, 20, 6);
+        }
+
+        printBenchmarkResult("fractionPolynomial.hornerNormalized", size, measureMilliseconds([&points, &results, &coefficients]()
+        {
+            for (size_t index{0}; index < points.size(); ++index)
+            {
+                Fraction value{coefficients.back()};
+
+                for (size_t power{coefficients.size() - 1}; power-- > 0; )
+                {
+                    value = value * points[index] + coefficients[power];
+                }
+
+                results[index] = value;
+            }
+        }));
+
+        printBenchmarkResult("fractionPolynomial.evaluateBatch", size, measureMilliseconds([&cPolynomial, &points, &results, &serialScheduler]()
+        {
+            cPolynomial.evaluate(points, results, serialScheduler);
+        }));
+
+        printBenchmarkResult("fractionPolynomial.evaluateBatchThreads", size, measureMilliseconds([&cPolynomial, &points, &results, &scheduler]()
+        {
+            cPolynomial.evaluate(points, results, scheduler);
+        }));
+    }
+
+    // root isolation of products of linear and irreducible quadratic factors
+    for (int degree{4}; degree <= 16; degree *= 2)
+    {
+        FractionPolynomial polynomial{Fraction{1}};
+
+        for (int factor{1}; factor <= degree / 2; ++factor)
+        {
+            polynomial = polynomial * FractionPolynomial{Fraction{-factor, 7}, Fraction{1}} * FractionPolynomial{Fraction{-factor}, Fraction{0}, Fraction{1}};
+        }
+
+        printBenchmarkResult("fractionPolynomial.isolateRealRoots", static_cast<size_t>(polynomial.getDegree()), measureMilliseconds([&polynomial]()
+        {
+            (void)polynomial.isolateRealRoots();
+        }));
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionbatch.h"
+
+// cost grows with the size of the terms: the first eighth of the elements has huge terms, the others small ones
+inline Fraction approximateRepeatedly(const Fraction& fraction)
+{
+    Fraction result{fraction};
+
+    for (int maxDenominator{1}; maxDenominator <= 64; ++maxDenominator)
+    {
+        result = fraction.limitDenominator(maxDenominator * (fraction.getDenominator() / 64 + 1));
+    }
+
+    return result;
+}
+
+/* Skewed workload: equal static slices per thread compared to the work-stealing scheduler
+*/
+inline void runFractionSchedulerBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{35};
+    const size_t cSize{getMaxSize(options, 1 << 16)};
+    std::vector<Fraction> fractions(cSize);
+    std::vector<Fraction> results(cSize);
+
+    for (size_t index{0}; index < cSize; ++index)
+    {
+        fractions[index] = index < cSize / 8 ? createRandomFraction(generator, 2000000000, 2000000000) : createRandomFraction(generator, 10, 10);
+    }
+
+    FractionScheduler scheduler{options.threadsCount};
+    const size_t cThreadsCount{scheduler.getThreadsCount()};
+
+    printBenchmarkResult("fractionScheduler.staticSlices", cSize, measureMilliseconds([&fractions, &results, cThreadsCount]()
+    {
+        std::vector<std::thread> threads;
+
+        for (size_t threadIndex{0}; threadIndex < cThreadsCount; ++threadIndex)
+        {
+            threads.emplace_back([&fractions, &results, cThreadsCount, threadIndex]()
+            {
+                for (size_t index{fractions.size() * threadIndex / cThreadsCount}; index < fractions.size() * (threadIndex + 1) / cThreadsCount; ++index)
+                {
+                    results[index] = approximateRepeatedly(fractions[index]);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }), std::to_string(cThreadsCount) + " threads");
+
+    scheduler.resetStatistics();
+
+    printBenchmarkResult("fractionScheduler.workStealing", cSize, measureMilliseconds([&fractions, &results, &scheduler]()
+    {
+        mapFractions(fractions, results, approximateRepeatedly, scheduler);
+    }), std::to_string(cThreadsCount) + " threads");
+
+    const FractionScheduler::Statistics cStatistics{scheduler.getStatistics()};
+
+    std::cout << "    imbalance " << cStatistics.getImbalance() << ", stolen ranges " << cStatistics.getStolenRangesCount() << std::endl;
+}
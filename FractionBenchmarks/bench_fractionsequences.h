@@ -0,0 +1,67 @@
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <iterator>
+#include <numeric>
+#include <algorithm>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionsequences.h"
+
+/* Enumeration of the Farey sequence elements: trying all the terms with a GCD check compared to the next term recurrence (serial and chunked in parallel)
+*/
+inline void runFractionSequencesBenchmarks(const BenchmarkOptions& options)
+{
+    const size_t cThreadsCount{0 == options.threadsCount ? std::max(1u, std::thread::hardware_concurrency()) : options.threadsCount};
+
+    for (size_t order{500}; order <= getMaxSize(options, 4000); order *= 2)
+    {
+        const int cOrder{static_cast<int>(order)};
+        const FareySequence cSequence{cOrder};
+        const std::string cDetails{std::to_string(std::distance(cSequence.begin(), cSequence.end())) + " elements"};
+
+        printBenchmarkResult("fractionSequences.fareyBruteForce", order, measureMilliseconds([cOrder]()
+        {
+            std::vector<Fraction> elements;
+
+            for (int denominator{1}; denominator <= cOrder; ++denominator)
+            {
+                for (int numerator{0}; numerator <= denominator; ++numerator)
+                {
+                    if (1 == std::gcd(numerator, denominator))
+                    {
+                        elements.push_back(Fraction{numerator, denominator});
+                    }
+                }
+            }
+
+            std::sort(elements.begin(), elements.end());
+        }), cDetails);
+
+        printBenchmarkResult("fractionSequences.fareyIterator", order, measureMilliseconds([&cSequence]()
+        {
+            const std::vector<Fraction> cElements{cSequence.begin(), cSequence.end()};
+        }), cDetails);
+
+        printBenchmarkResult("fractionSequences.fareyChunks", order, measureMilliseconds([&cSequence, cThreadsCount]()
+        {
+            const std::vector<FareySequence> cChunks{cSequence.split(cThreadsCount)};
+            std::vector<std::thread> threads;
+
+            for (size_t chunkIndex{0}; chunkIndex < cChunks.size(); ++chunkIndex)
+            {
+                threads.emplace_back([&cChunks, chunkIndex]()
+                {
+                    const std::vector<Fraction> cElements{cChunks[chunkIndex].begin(), cChunks[chunkIndex].end()};
+                });
+            }
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }), cDetails + ", " + std::to_string(cThreadsCount) + " threads");
+    }
+}
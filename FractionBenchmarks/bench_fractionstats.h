@@ -0,0 +1,99 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/fractionstats.h"
+
+/* Exact statistics of quantized measurements: two passes over the stored values compared to the streaming accumulators
+*/
+inline void runFractionStatsBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cMaxSize{getMaxSize(options, 1 << 18)};
+    const size_t cWindowSize{256};
+
+    for (size_t size{1 << 12}; size <= cMaxSize; size *= 4)
+    {
+        std::vector<Fraction> values(size);
+
+        for (Fraction& value : values)
+        {
+            value = createRandomFraction(generator, 1000, 12);
+        }
+
+        printBenchmarkResult("fractionStats.varianceTwoPasses", size, measureMilliseconds([&values]()
+        {
+            WideFraction sum;
+
+            for (const Fraction& value : values)
+            {
+                sum += WideFraction{value};
+            }
+
+            const WideFraction cMean{sum / WideFraction{WideInteger{static_cast<long long>(values.size())}}};
+            WideFraction squaredDeviationsSum;
+
+            for (const Fraction& value : values)
+            {
+                const WideFraction cDeviation{WideFraction{value} - cMean};
+                squaredDeviationsSum += cDeviation * cDeviation;
+            }
+        }));
+
+        printBenchmarkResult("fractionStats.varianceStreaming", size, measureMilliseconds([&values]()
+        {
+            FractionStats stats;
+
+            for (const Fraction& value : values)
+            {
+                stats.add(value);
+            }
+
+            (void)stats.getVariance();
+        }));
+
+        printBenchmarkResult("fractionStats.windowMeanRecomputed", size, measureMilliseconds([&values, cWindowSize]()
+        {
+            for (size_t end{1}; end <= values.size(); ++end)
+            {
+                CheckedFraction sum;
+
+                for (size_t index{end > cWindowSize ? end - cWindowSize : 0}; index < end; ++index)
+                {
+                    sum += CheckedFraction{values[index]};
+                }
+            }
+        }), "window 256");
+
+        printBenchmarkResult("fractionStats.windowMeanStreaming", size, measureMilliseconds([&values, cWindowSize]()
+        {
+            FractionWindowStats windowStats{cWindowSize};
+
+            for (const Fraction& value : values)
+            {
+                windowStats.add(value);
+                (void)windowStats.getMean();
+            }
+        }), "window 256");
+
+        printBenchmarkResult("fractionStats.medianSorted", size, measureMilliseconds([&values]()
+        {
+            std::vector<Fraction> sortedValues{values};
+            std::nth_element(sortedValues.begin(), sortedValues.begin() + (sortedValues.size() - 1) / 2, sortedValues.end());
+        }));
+
+        printBenchmarkResult("fractionStats.medianDistinctCounts", size, measureMilliseconds([&values]()
+        {
+            FractionQuantiles quantiles;
+
+            for (const Fraction& value : values)
+            {
+                quantiles.add(value);
+            }
+
+            (void)quantiles.getMedian();
+        }));
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "benchmarkutils.h"
+
+/* Validation of a dirty feed (every fourth string is invalid): exceptions vs. std::expected
+*/
+inline void runNonThrowingApiBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cSize{getMaxSize(options, 1 << 16)};
+    std::vector<std::string> feed(cSize);
+
+    for (size_t index{0}; index < cSize; ++index)
+    {
+        const Fraction cFraction{createRandomFraction(generator, 100000, 100000)};
+        const std::string cFractionString{std::to_string(cFraction.getNumerator()) + "/" + std::to_string(cFraction.getDenominator())};
+
+        feed[index] = 3 == index % 4 ? cFractionString + "x" : cFractionString;
+    }
+
+    printBenchmarkResult("nonThrowingApi.parseThrowing", cSize, measureMilliseconds([&feed]()
+    {
+        size_t validCount{0};
+
+        for (const std::string& fractionString : feed)
+        {
+            try
+            {
+                (void)Fraction{fractionString};
+                ++validCount;
+            }
+            catch (const std::runtime_error&)
+            {
+            }
+        }
+
+        (void)validCount;
+    }));
+
+    printBenchmarkResult("nonThrowingApi.tryParse", cSize, measureMilliseconds([&feed]()
+    {
+        size_t validCount{0};
+
+        for (const std::string& fractionString : feed)
+        {
+            validCount += Fraction::tryParse(fractionString).has_value() ? 1 : 0;
+        }
+
+        (void)validCount;
+    }));
+}
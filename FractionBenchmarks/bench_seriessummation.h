@@ -0,0 +1,54 @@
+#pragma once
+
+#include "benchmarkutils.h"
+#include "../FractionLib/seriessummation.h"
+
+/* Exact partial sums: naive accumulation (reduced after each term) compared to the binary splitting
+*/
+inline void runSeriesSummationBenchmarks(const BenchmarkOptions& options)
+{
+    const SeriesSummation::TermFunction cHarmonicTerm{[](long long index) {return SeriesSummation::Term{1, index};}};
+    const SeriesSummation::TermFunction cFactorialRatio{[](long long index) {return SeriesSummation::Term{1, index};}};
+
+    for (size_t termsCount{256}; termsCount <= getMaxSize(options, 1024); termsCount *= 2)
+    {
+        const long long cEnd{static_cast<long long>(termsCount) + 1};
+
+        printBenchmarkResult("seriesSummation.harmonicNaive", termsCount, measureMilliseconds([cEnd]()
+        {
+            WideFraction sum;
+
+            for (long long index{1}; index < cEnd; ++index)
+            {
+                sum += WideFraction{WideInteger{1}, WideInteger{index}};
+            }
+        }));
+
+        printBenchmarkResult("seriesSummation.harmonicSplitting", termsCount, measureMilliseconds([&cHarmonicTerm, cEnd]()
+        {
+            (void)SeriesSummation::sumTerms(cHarmonicTerm, 1, cEnd);
+        }));
+
+        printBenchmarkResult("seriesSummation.harmonicSplittingThreads", termsCount, measureMilliseconds([&cHarmonicTerm, cEnd, &options]()
+        {
+            (void)SeriesSummation::sumTerms(cHarmonicTerm, 1, cEnd, options.threadsCount);
+        }));
+
+        printBenchmarkResult("seriesSummation.eNaive", termsCount, measureMilliseconds([cEnd]()
+        {
+            WideFraction sum;
+            WideFraction term{1};
+
+            for (long long index{1}; index < cEnd; ++index)
+            {
+                term /= WideFraction{WideInteger{index}};
+                sum += term;
+            }
+        }));
+
+        printBenchmarkResult("seriesSummation.eSplitting", termsCount, measureMilliseconds([&cFactorialRatio, cEnd]()
+        {
+            (void)SeriesSummation::sumRatioProducts(cFactorialRatio, 1, cEnd);
+        }));
+    }
+}
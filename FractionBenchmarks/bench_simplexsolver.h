@@ -0,0 +1,81 @@
+#pragma once
+
+#include <sstream>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/simplexsolver.h"
+
+/* Random feasible and bounded sparse LP: maximize c * x with a few positive fractional coefficients per row, the i-th variable appears in the i-th
+   (<=) row so none can grow unbounded; size / 4 additional >= covering rows make x = 0 infeasible (phase 1 is needed)
+*/
+inline SimplexSolver createRandomLinearProgram(size_t size, std::mt19937& generator, std::vector<Fraction>& objective)
+{
+    std::uniform_int_distribution<size_t> columnDistribution{0, size - 1};
+    std::uniform_int_distribution<int> rightHandSideDistribution{10, 100};
+    std::uniform_int_distribution<int> numeratorDistribution{1, 9};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 4};
+    SimplexSolver solver{size};
+    objective.assign(size, Fraction{});
+
+    for (Fraction& coefficient : objective)
+    {
+        coefficient = Fraction{numeratorDistribution(generator)};
+    }
+
+    solver.setObjective(objective, true);
+
+    for (size_t row{0}; row < size + size / 4; ++row)
+    {
+        const bool cIsCoveringRow{row >= size};
+        std::vector<Fraction> coefficients(size, Fraction{0});
+
+        if (!cIsCoveringRow)
+        {
+            coefficients[row] = Fraction{1};
+        }
+
+        for (size_t entryIndex{0}; entryIndex < 5; ++entryIndex)
+        {
+            coefficients[columnDistribution(generator)] = Fraction{numeratorDistribution(generator), denominatorDistribution(generator)};
+        }
+
+        solver.addConstraint(coefficients, cIsCoveringRow ? SimplexSolver::ConstraintType::GREATER_OR_EQUAL : SimplexSolver::ConstraintType::LESS_OR_EQUAL,
+                             Fraction{cIsCoveringRow ? 1 : rightHandSideDistribution(generator)});
+    }
+
+    return solver;
+}
+
+inline void runSimplexSolverBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cMaxSize{getMaxSize(options, 64)};
+
+    for (size_t size{16}; size <= cMaxSize; size *= 2)
+    {
+        std::vector<Fraction> objective;
+        SimplexSolver solver{createRandomLinearProgram(size, generator, objective)};
+        SimplexSolver::Result result;
+
+        for (const SimplexSolver::PivotingRule pivotingRule : {SimplexSolver::PivotingRule::BLAND, SimplexSolver::PivotingRule::DANTZIG})
+        {
+            const bool cIsBlandRule{SimplexSolver::PivotingRule::BLAND == pivotingRule};
+            solver.setPivotingRule(pivotingRule);
+
+            const double cMilliseconds{measureMilliseconds([&solver, &result]() {result = solver.solve();}, 0.0)};
+            std::ostringstream details;
+
+            details << (SimplexSolver::Status::OPTIMAL == result.status ? "" : "(not optimal) ") << "iterations=" << result.iterationsCount
+                    << " reinversions=" << result.reinversionsCount << " objective~" << result.objectiveValue.getDecimalValue();
+            printBenchmarkResult(cIsBlandRule ? "simplexSolver.solveBland" : "simplexSolver.solveDantzig", size, cMilliseconds, details.str());
+        }
+
+        // re-solve after changing an objective coefficient, starting from the previous optimal basis (it stays feasible, only phase 2 runs)
+        const std::vector<size_t> cBasis{result.basis};
+        objective[0] = Fraction{10};
+        solver.setObjective(objective, true);
+
+        const double cMilliseconds{measureMilliseconds([&solver, &result, &cBasis]() {result = solver.solve(cBasis);}, 0.0)};
+        printBenchmarkResult("simplexSolver.warmStart", size, cMilliseconds, "iterations=" + std::to_string(result.iterationsCount));
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <sstream>
+
+#include "benchmarkutils.h"
+#include "../FractionLib/sparsefractionmatrix.h"
+
+/* Random sparse system with a few off-diagonal entries per row, close to the diagonal (local constraints), and a dominant diagonal (so it is never singular)
+*/
+inline SparseFractionMatrix createRandomSparseFractionMatrix(size_t size, size_t offDiagonalsPerRow, std::mt19937& generator)
+{
+    std::vector<SparseFractionMatrixEntry> entries;
+    std::uniform_int_distribution<int> offsetDistribution{-8, 8};
+
+    for (size_t row{0}; row < size; ++row)
+    {
+        entries.push_back({row, row, Fraction{static_cast<int>(2 * offDiagonalsPerRow + 2)}});
+
+        for (size_t entryIndex{0}; entryIndex < offDiagonalsPerRow; ++entryIndex)
+        {
+            const size_t cColumn{(row + size + offsetDistribution(generator)) % size};
+
+            if (cColumn != row)
+            {
+                entries.push_back({row, cColumn, Fraction{0 == cColumn % 2 ? 1 : -1}});
+            }
+        }
+    }
+
+    return SparseFractionMatrix{size, size, entries};
+}
+
+inline void runSparseFractionMatrixBenchmarks(const BenchmarkOptions& options)
+{
+    std::mt19937 generator{2024};
+    const size_t cMaxSize{getMaxSize(options, 2048)};
+
+    for (size_t size{256}; size <= cMaxSize; size *= 2)
+    {
+        const SparseFractionMatrix cMatrix{createRandomSparseFractionMatrix(size, 3, generator)};
+        std::vector<Fraction> vector(size);
+
+        for (Fraction& element : vector)
+        {
+            element = createRandomFraction(generator, 9, 4);
+        }
+
+        printBenchmarkResult("sparseFractionMatrices.multiply", size, measureMilliseconds([&cMatrix, &vector]() {(void)cMatrix.multiply(vector);}));
+
+        const SparseLUFactorization cFactorization{cMatrix};
+        const SparseLUStatistics& cStatistics{cFactorization.getStatistics()};
+        std::ostringstream details;
+
+        details << "nnz(A)=" << cStatistics.matrixNonZerosCount << " nnz(L+U)=" << cStatistics.lowerNonZerosCount + cStatistics.upperNonZerosCount
+                << " fill-in=" << cStatistics.fillInCount << " ordering=" << cStatistics.orderingMilliseconds << "ms"
+                << (cStatistics.isWideArithmeticUsed ? " (wide)" : "");
+
+        printBenchmarkResult("sparseFractionMatrices.factorize", size, cStatistics.factorizationMilliseconds, details.str());
+        printBenchmarkResult("sparseFractionMatrices.solve", size, measureMilliseconds([&cFactorization, &vector]() {(void)cFactorization.solve(vector);}));
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+#include "../FractionLib/fraction.h"
+
+struct BenchmarkOptions
+{
+    std::string filter;   // only the benchmark groups whose name contains the filter are run (empty: all)
+    size_t maxSize;       // upper limit of the problem sizes (0: use the default limit of each benchmark group)
+    size_t threadsCount;  // 0: use all available hardware threads
+};
+
+inline BenchmarkOptions parseBenchmarkOptions(int argc, char* argv[])
+{
+    BenchmarkOptions options{"", 0, 0};
+
+    for (int argIndex{1}; argIndex + 1 < argc; argIndex += 2)
+    {
+        const std::string cOption{argv[argIndex]};
+        const std::string cValue{argv[argIndex + 1]};
+
+        if ("--filter" == cOption)
+        {
+            options.filter = cValue;
+        }
+        else if ("--max-size" == cOption)
+        {
+            options.maxSize = std::stoul(cValue);
+        }
+        else if ("--threads" == cOption)
+        {
+            options.threadsCount = std::stoul(cValue);
+        }
+        else
+        {
+            throw std::runtime_error{"Error! Unknown option: " + cOption};
+        }
+    }
+
+    return options;
+}
+
+inline size_t getMaxSize(const BenchmarkOptions& options, size_t defaultMaxSize)
+{
+    return 0 == options.maxSize ? defaultMaxSize : options.maxSize;
+}
+
+/* Runs the callable until the minimum duration is reached (at least once) and returns the average duration of a run in milliseconds
+*/
+template<typename Callable>
+double measureMilliseconds(Callable&& callable, double minimumMilliseconds = 200.0)
+{
+    using Clock = std::chrono::steady_clock;
+
+    size_t runsCount{0};
+    double elapsedMilliseconds{0.0};
+    const Clock::time_point cStart{Clock::now()};
+
+    do
+    {
+        callable();
+        ++runsCount;
+        elapsedMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - cStart).count();
+    }
+    while (elapsedMilliseconds < minimumMilliseconds);
+
+    return elapsedMilliseconds / runsCount;
+}
+
+inline void printBenchmarkResult(const std::string& benchmarkName, size_t size, double milliseconds, const std::string& details = "")
+{
+    std::cout << std::left << std::setw(48) << benchmarkName << std::right << std::setw(10) << size
+              << std::setw(14) << std::fixed << std::setprecision(3) << milliseconds << " ms"
+              << (details.empty() ? "" : "  ") << details << std::endl;
+}
+
+inline Fraction createRandomFraction(std::mt19937& generator, int maxNumerator, int maxDenominator)
+{
+    std::uniform_int_distribution<int> numeratorDistribution{-maxNumerator, maxNumerator};
+    std::uniform_int_distribution<int> denominatorDistribution{1, maxDenominator};
+
+    const Fraction cFraction{numeratorDistribution(generator), denominatorDistribution(generator)};
+
+    return cFraction;
+}
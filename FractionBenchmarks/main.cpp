@@ -0,0 +1,71 @@
+#include <vector>
+#include <utility>
+
+#include "bench_fractionmatrices.h"
+#include "bench_sparsefractionmatrices.h"
+#include "bench_simplexsolver.h"
+#include "bench_continuedfractions.h"
+#include "bench_fractioninstrumentation.h"
+#include "bench_nonthrowingapi.h"
+#include "bench_fractioncontext.h"
+#include "bench_atomicfraction.h"
+#include "bench_fractionformula.h"
+#include "bench_fractionscheduler.h"
+#include "bench_fractiongenerator.h"
+#include "bench_seriessummation.h"
+#include "bench_fractionsequences.h"
+#include "bench_decimalstrings.h"
+#include "bench_fractionarithmetic.h"
+#include "bench_fractionstats.h"
+#include "bench_fractionpolynomial.h"
+#include "bench_fractionbtree.h"
+#include "bench_fractioncsvreader.h"
+#include "bench_fractioncapi.h"
+#include "bench_fractionarray.h"
+#include "bench_fractionmodular.h"
+#include "bench_fractioncodec.h"
+
+using BenchmarkGroup = std::pair<std::string, void(*)(const BenchmarkOptions&)>;
+
+/* Usage: FractionBenchmarks [--filter groupName] [--max-size size] [--threads count]
+*/
+int main(int argc, char *argv[])
+{
+    const BenchmarkOptions cOptions{parseBenchmarkOptions(argc, argv)};
+
+    const std::vector<BenchmarkGroup> cBenchmarkGroups{
+        {"fractionMatrices", runFractionMatrixBenchmarks},
+        {"sparseFractionMatrices", runSparseFractionMatrixBenchmarks},
+        {"simplexSolver", runSimplexSolverBenchmarks},
+        {"continuedFractions", runContinuedFractionBenchmarks},
+        {"fractionInstrumentation", runFractionInstrumentationBenchmarks},
+        {"nonThrowingApi", runNonThrowingApiBenchmarks},
+        {"fractionContext", runFractionContextBenchmarks},
+        {"atomicFraction", runAtomicFractionBenchmarks},
+        {"fractionFormula", runFractionFormulaBenchmarks},
+        {"fractionScheduler", runFractionSchedulerBenchmarks},
+        {"fractionGenerator", runFractionGeneratorBenchmarks},
+        {"seriesSummation", runSeriesSummationBenchmarks},
+        {"fractionSequences", runFractionSequencesBenchmarks},
+        {"decimalStrings", runDecimalStringBenchmarks},
+        {"fractionArithmetic", runFractionArithmeticBenchmarks},
+        {"fractionStats", runFractionStatsBenchmarks},
+        {"fractionPolynomial", runFractionPolynomialBenchmarks},
+        {"fractionBTree", runFractionBTreeBenchmarks},
+        {"fractionCsvReader", runFractionCsvReaderBenchmarks},
+        {"fractionCApi", runFractionCApiBenchmarks},
+        {"fractionArray", runFractionArrayBenchmarks},
+        {"fractionModular", runFractionModularBenchmarks},
+        {"fractionCodec", runFractionCodecBenchmarks}
+    };
+
+    for (const BenchmarkGroup& benchmarkGroup : cBenchmarkGroups)
+    {
+        if (benchmarkGroup.first.find(cOptions.filter) != std::string::npos)
+        {
+            benchmarkGroup.second(cOptions);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+#include <thread>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "atomicfraction.h"
+
+static uint64_t pack(const Fraction& fraction)
+{
+    return static_cast<uint64_t>(static_cast<uint32_t>(fraction.getNumerator())) << 32 | static_cast<uint32_t>(fraction.getDenominator());
+}
+
+static long long getNumerator(uint64_t value)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(value >> 32));
+}
+
+static long long getDenominator(uint64_t value)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(value));
+}
+
+// the packed terms are always reduced with a positive denominator (packed fractions or packReduced() results)
+static Fraction unpack(uint64_t value)
+{
+    return Fraction::fromReducedTerms(static_cast<int>(getNumerator(value)), static_cast<int>(getDenominator(value)));
+}
+
+// reduces the (non-zero denominator) result of an operation on two packed fractions and packs it, throws if it does not fit into int terms
+static uint64_t packReduced(long long numerator, long long denominator)
+{
+    const long long cGreatestCommonDivisor{std::gcd(numerator, denominator)};
+
+    numerator /= cGreatestCommonDivisor;
+    denominator /= cGreatestCommonDivisor;
+
+    if (numerator < std::numeric_limits<int>::min() || numerator > std::numeric_limits<int>::max() || denominator > std::numeric_limits<int>::max())
+    {
+        throw std::overflow_error{"Error! Fraction term out of range"};
+    }
+
+    return static_cast<uint64_t>(static_cast<uint32_t>(numerator)) << 32 | static_cast<uint32_t>(denominator);
+}
+
+/* CAS loop replacing the value by operation(value), returns the previous value
+   (the operation works directly on the packed terms, the Fraction objects are only created for the result)
+*/
+template<typename Operation>
+static Fraction fetchUpdate(std::atomic<uint64_t>& value, Operation&& operation, std::memory_order order)
+{
+    uint64_t current{value.load(std::memory_order_relaxed)};
+
+    while (!value.compare_exchange_weak(current, operation(current), order))
+    {
+    }
+
+    return unpack(current);
+}
+
+// packed sum of a packed fraction and numerator / denominator
+static uint64_t addPacked(uint64_t value, long long numerator, long long denominator)
+{
+    const long long cGreatestCommonDivisor{std::gcd(getDenominator(value), denominator)};
+
+    return packReduced(getNumerator(value) * (denominator / cGreatestCommonDivisor) + numerator * (getDenominator(value) / cGreatestCommonDivisor),
+                       getDenominator(value) / cGreatestCommonDivisor * denominator);
+}
+
+AtomicFraction::AtomicFraction()
+    : AtomicFraction{Fraction{}}
+{
+}
+
+AtomicFraction::AtomicFraction(const Fraction& fraction)
+    : mValue{pack(fraction)}
+{
+}
+
+Fraction AtomicFraction::load(std::memory_order order) const
+{
+    return unpack(mValue.load(order));
+}
+
+void AtomicFraction::store(const Fraction& fraction, std::memory_order order)
+{
+    mValue.store(pack(fraction), order);
+}
+
+Fraction AtomicFraction::exchange(const Fraction& fraction, std::memory_order order)
+{
+    return unpack(mValue.exchange(pack(fraction), order));
+}
+
+bool AtomicFraction::compareExchange(Fraction& expected, const Fraction& desired, std::memory_order order)
+{
+    uint64_t expectedValue{pack(expected)};
+    const bool cExchanged{mValue.compare_exchange_strong(expectedValue, pack(desired), order)};
+
+    if (!cExchanged)
+    {
+        expected = unpack(expectedValue);
+    }
+
+    return cExchanged;
+}
+
+Fraction AtomicFraction::fetchAdd(const Fraction& fraction, std::memory_order order)
+{
+    const long long cNumerator{fraction.getNumerator()};
+    const long long cDenominator{fraction.getDenominator()};
+
+    return fetchUpdate(mValue, [cNumerator, cDenominator](uint64_t current) {return addPacked(current, cNumerator, cDenominator);}, order);
+}
+
+Fraction AtomicFraction::fetchSubtract(const Fraction& fraction, std::memory_order order)
+{
+    const long long cNumerator{-static_cast<long long>(fraction.getNumerator())};
+    const long long cDenominator{fraction.getDenominator()};
+
+    return fetchUpdate(mValue, [cNumerator, cDenominator](uint64_t current) {return addPacked(current, cNumerator, cDenominator);}, order);
+}
+
+Fraction AtomicFraction::fetchMul(const Fraction& fraction, std::memory_order order)
+{
+    const long long cNumerator{fraction.getNumerator()};
+    const long long cDenominator{fraction.getDenominator()};
+
+    return fetchUpdate(mValue, [cNumerator, cDenominator](uint64_t current)
+    {
+        return packReduced(getNumerator(current) * cNumerator, getDenominator(current) * cDenominator);
+    }, order);
+}
+
+ShardedFractionAccumulator::ShardedFractionAccumulator(size_t shardsCount)
+    : mShards(0 != shardsCount ? shardsCount : std::max(std::thread::hardware_concurrency(), 1u))
+{
+}
+
+void ShardedFractionAccumulator::add(const Fraction& fraction)
+{
+    // the threads get consecutive indexes when they first add into any accumulator
+    static std::atomic<size_t> sNextThreadIndex{0};
+    thread_local const size_t tThreadIndex{sNextThreadIndex.fetch_add(1, std::memory_order_relaxed)};
+
+    mShards[tThreadIndex % mShards.size()].value.fetchAdd(fraction, std::memory_order_relaxed);
+}
+
+WideFraction ShardedFractionAccumulator::getSum() const
+{
+    WideFraction sum;
+
+    for (const Shard& shard : mShards)
+    {
+        sum += WideFraction{shard.value.load(std::memory_order_relaxed)};
+    }
+
+    return sum;
+}
+
+void ShardedFractionAccumulator::reset()
+{
+    for (Shard& shard : mShards)
+    {
+        shard.value.store(Fraction{}, std::memory_order_relaxed);
+    }
+}
+
+size_t ShardedFractionAccumulator::getShardsCount() const
+{
+    return mShards.size();
+}
@@ -0,0 +1,85 @@
+#ifndef ATOMICFRACTION_H
+#define ATOMICFRACTION_H
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+#include "fraction.h"
+#include "widefraction.h"
+
+/* Fraction that can be read and updated concurrently without locks
+   - the normalized numerator and denominator are packed into a single 64 bit word (numerator in the upper half),
+     so a normalized value has a single representation and compareExchange() compares values
+   - the read-modify-write operations are CAS loops computing with 64 bit intermediate terms; an overflowing result throws
+     (like the non-throwing API, the int range of the reduced result is checked) and leaves the value unchanged
+   - the decimal value is not stored, it is recomputed by load()
+*/
+class AtomicFraction
+{
+public:
+    // constructors
+    AtomicFraction();
+    explicit AtomicFraction(const Fraction& fraction);
+
+    AtomicFraction(const AtomicFraction&) = delete;
+    AtomicFraction& operator=(const AtomicFraction&) = delete;
+
+    // atomic access
+    Fraction load(std::memory_order order = std::memory_order_seq_cst) const;
+    void store(const Fraction& fraction, std::memory_order order = std::memory_order_seq_cst);
+    Fraction exchange(const Fraction& fraction, std::memory_order order = std::memory_order_seq_cst);
+
+    /* Replaces the value by desired if it equals expected and returns true, otherwise loads the current value into expected and returns false
+    */
+    bool compareExchange(Fraction& expected, const Fraction& desired, std::memory_order order = std::memory_order_seq_cst);
+
+    // atomic read-modify-write operations, they return the previous value
+    Fraction fetchAdd(const Fraction& fraction, std::memory_order order = std::memory_order_seq_cst);
+    Fraction fetchSubtract(const Fraction& fraction, std::memory_order order = std::memory_order_seq_cst);
+    Fraction fetchMul(const Fraction& fraction, std::memory_order order = std::memory_order_seq_cst);
+
+    static constexpr bool isAlwaysLockFree()
+    {
+        return std::atomic<uint64_t>::is_always_lock_free;
+    }
+
+private:
+    std::atomic<uint64_t> mValue;
+};
+
+/* Accumulator for write-heavy shared sums: each thread adds into its own cache line aligned AtomicFraction shard
+   (the threads are spread round robin over the shards, so the updates only contend when there are more threads than shards)
+   and the exact sum of the shards is computed when read
+*/
+class ShardedFractionAccumulator
+{
+public:
+    // constructors
+    explicit ShardedFractionAccumulator(size_t shardsCount = 0);   // 0: one shard per hardware thread
+
+    ShardedFractionAccumulator(const ShardedFractionAccumulator&) = delete;
+    ShardedFractionAccumulator& operator=(const ShardedFractionAccumulator&) = delete;
+
+    // throws if the shard of the calling thread overflows (the shard is left unchanged)
+    void add(const Fraction& fraction);
+
+    /* Sum of all shards (exact, even if it does not fit into a Fraction);
+       the additions running concurrently with the call might be partially included
+    */
+    WideFraction getSum() const;
+
+    void reset();
+
+    size_t getShardsCount() const;
+
+private:
+    struct alignas(64) Shard
+    {
+        AtomicFraction value;
+    };
+
+    std::vector<Shard> mShards;
+};
+
+#endif // ATOMICFRACTION_H
@@ -0,0 +1,154 @@
+#ifndef BLOCKEDMATRIX_H
+#define BLOCKEDMATRIX_H
+
+#include <vector>
+#include <stdexcept>
+
+/* Dense matrix stored as square blocks (tiles) that are contiguous in memory, each block being stored row by row
+   (this way a block of each operand of a blocked algorithm stays in cache while being processed)
+*/
+template<typename Element>
+class BlockedMatrix
+{
+public:
+    static constexpr size_t scBlockSize{16};
+    static constexpr size_t scBlockElementsCount{scBlockSize * scBlockSize};
+
+    // constructors
+    BlockedMatrix();
+    BlockedMatrix(size_t rowsCount, size_t columnsCount);
+
+    // getters
+    size_t getRowsCount() const;
+    size_t getColumnsCount() const;
+
+    // element access operators
+    Element& operator()(size_t row, size_t column);
+    const Element& operator()(size_t row, size_t column) const;
+
+    Element& at(size_t row, size_t column);
+    const Element& at(size_t row, size_t column) const;
+
+    // block access functions (blocks located on the right/bottom edge are padded)
+    size_t getBlockRowsCount() const;
+    size_t getBlockColumnsCount() const;
+    Element* getBlock(size_t blockRow, size_t blockColumn);
+    const Element* getBlock(size_t blockRow, size_t blockColumn) const;
+
+    // logical operators
+    bool operator==(const BlockedMatrix& matrix) const;
+
+protected:
+    size_t getElementIndex(size_t row, size_t column) const;
+
+    size_t mRowsCount;
+    size_t mColumnsCount;
+    size_t mBlockRowsCount;
+    size_t mBlockColumnsCount;
+    std::vector<Element> mElements;
+};
+
+template<typename Element>
+BlockedMatrix<Element>::BlockedMatrix()
+    : BlockedMatrix{0, 0}
+{
+}
+
+template<typename Element>
+BlockedMatrix<Element>::BlockedMatrix(size_t rowsCount, size_t columnsCount)
+    : mRowsCount{rowsCount}
+    , mColumnsCount{columnsCount}
+    , mBlockRowsCount{(rowsCount + scBlockSize - 1) / scBlockSize}
+    , mBlockColumnsCount{(columnsCount + scBlockSize - 1) / scBlockSize}
+    , mElements(mBlockRowsCount * mBlockColumnsCount * scBlockElementsCount)
+{
+}
+
+template<typename Element>
+size_t BlockedMatrix<Element>::getRowsCount() const
+{
+    return mRowsCount;
+}
+
+template<typename Element>
+size_t BlockedMatrix<Element>::getColumnsCount() const
+{
+    return mColumnsCount;
+}
+
+template<typename Element>
+Element& BlockedMatrix<Element>::operator()(size_t row, size_t column)
+{
+    return mElements[getElementIndex(row, column)];
+}
+
+template<typename Element>
+const Element& BlockedMatrix<Element>::operator()(size_t row, size_t column) const
+{
+    return mElements[getElementIndex(row, column)];
+}
+
+template<typename Element>
+Element& BlockedMatrix<Element>::at(size_t row, size_t column)
+{
+    if (row >= mRowsCount || column >= mColumnsCount)
+    {
+        throw std::runtime_error{"Error! Matrix index out of range"};
+    }
+
+    return mElements[getElementIndex(row, column)];
+}
+
+template<typename Element>
+const Element& BlockedMatrix<Element>::at(size_t row, size_t column) const
+{
+    if (row >= mRowsCount || column >= mColumnsCount)
+    {
+        throw std::runtime_error{"Error! Matrix index out of range"};
+    }
+
+    return mElements[getElementIndex(row, column)];
+}
+
+template<typename Element>
+size_t BlockedMatrix<Element>::getBlockRowsCount() const
+{
+    return mBlockRowsCount;
+}
+
+template<typename Element>
+size_t BlockedMatrix<Element>::getBlockColumnsCount() const
+{
+    return mBlockColumnsCount;
+}
+
+template<typename Element>
+Element* BlockedMatrix<Element>::getBlock(size_t blockRow, size_t blockColumn)
+{
+    return mElements.data() + (blockRow * mBlockColumnsCount + blockColumn) * scBlockElementsCount;
+}
+
+template<typename Element>
+const Element* BlockedMatrix<Element>::getBlock(size_t blockRow, size_t blockColumn) const
+{
+    return mElements.data() + (blockRow * mBlockColumnsCount + blockColumn) * scBlockElementsCount;
+}
+
+template<typename Element>
+bool BlockedMatrix<Element>::operator==(const BlockedMatrix& matrix) const
+{
+    // padding elements are never written so they are identical in matrices of the same size
+    const bool cIsEqual{mRowsCount == matrix.mRowsCount && mColumnsCount == matrix.mColumnsCount && mElements == matrix.mElements};
+    return cIsEqual;
+}
+
+template<typename Element>
+size_t BlockedMatrix<Element>::getElementIndex(size_t row, size_t column) const
+{
+    const size_t cBlockIndex{(row / scBlockSize) * mBlockColumnsCount + column / scBlockSize};
+    const size_t cElementIndex{cBlockIndex * scBlockElementsCount + (row % scBlockSize) * scBlockSize + column % scBlockSize};
+
+    return cElementIndex;
+}
+
+#endif // BLOCKEDMATRIX_H
@@ -0,0 +1,227 @@
+#include <limits>
+#include <numeric>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "checkedfraction.h"
+#include "fractioninstrumentation.h"
+
+// the minimum long long value is excluded so that negating a term can never overflow
+static constexpr long long scMaxTermMagnitude{std::numeric_limits<long long>::max()};
+
+CheckedFraction::CheckedFraction()
+    : mNumerator{0}
+    , mDenominator{1}
+{
+}
+
+CheckedFraction::CheckedFraction(long long numerator, long long denominator)
+    : mNumerator{numerator}
+    , mDenominator{denominator}
+{
+    if (0 == denominator)
+    {
+        throw std::runtime_error{ "Fatal error! Division by 0." };
+    }
+
+    if (numerator < -scMaxTermMagnitude || denominator < -scMaxTermMagnitude)
+    {
+        FRACTION_COUNT_EVENT(CHECKED_OVERFLOWS);
+        throw std::overflow_error{"Error! Fraction term out of range"};
+    }
+
+    normalize();
+}
+
+CheckedFraction::CheckedFraction(const Fraction& fraction)
+    : mNumerator{fraction.getNumerator()}
+    , mDenominator{fraction.getDenominator()}
+{
+}
+
+long long CheckedFraction::getNumerator() const
+{
+    return mNumerator;
+}
+
+long long CheckedFraction::getDenominator() const
+{
+    return mDenominator;
+}
+
+CheckedFraction CheckedFraction::operator+(const CheckedFraction& checkedFraction) const
+{
+    CheckedFraction result;
+
+    if (mDenominator == checkedFraction.mDenominator)
+    {
+        result.mNumerator = addTerms(mNumerator, checkedFraction.mNumerator);
+        result.mDenominator = mDenominator;
+    }
+    else
+    {
+        const long long cGreatestCommonDivisor{std::gcd(mDenominator, checkedFraction.mDenominator)};
+        const long long cFirstMultiplicationFactor{checkedFraction.mDenominator / cGreatestCommonDivisor};
+        const long long cSecondMultiplicationFactor{mDenominator / cGreatestCommonDivisor};
+
+        result.mNumerator = addTerms(multiplyTerms(mNumerator, cFirstMultiplicationFactor), multiplyTerms(checkedFraction.mNumerator, cSecondMultiplicationFactor));
+        result.mDenominator = multiplyTerms(mDenominator, cFirstMultiplicationFactor);
+    }
+
+    result.normalize();
+
+    return result;
+}
+
+CheckedFraction CheckedFraction::operator-(const CheckedFraction& checkedFraction) const
+{
+    const CheckedFraction cResult{*this + (-checkedFraction)};
+    return cResult;
+}
+
+CheckedFraction CheckedFraction::operator*(const CheckedFraction& checkedFraction) const
+{
+    CheckedFraction result;
+
+    if (0 != mNumerator && 0 != checkedFraction.mNumerator)
+    {
+        // cross reduce first so the products are already normalized and overflow only if the result does
+        const long long cFirstDivisor{std::gcd(mNumerator, checkedFraction.mDenominator)};
+        const long long cSecondDivisor{std::gcd(checkedFraction.mNumerator, mDenominator)};
+
+        result.mNumerator = multiplyTerms(mNumerator / cFirstDivisor, checkedFraction.mNumerator / cSecondDivisor);
+        result.mDenominator = multiplyTerms(mDenominator / cSecondDivisor, checkedFraction.mDenominator / cFirstDivisor);
+    }
+
+    return result;
+}
+
+CheckedFraction CheckedFraction::operator/(const CheckedFraction& checkedFraction) const
+{
+    if (0 == checkedFraction.mNumerator)
+    {
+        throw std::runtime_error{ "Error! Division by 0" };
+    }
+
+    const CheckedFraction cInverse{checkedFraction.mDenominator, checkedFraction.mNumerator};
+    const CheckedFraction cResult{*this * cInverse};
+
+    return cResult;
+}
+
+CheckedFraction CheckedFraction::operator-() const
+{
+    CheckedFraction result{*this};
+    result.mNumerator = -mNumerator;
+
+    return result;
+}
+
+CheckedFraction& CheckedFraction::operator+=(const CheckedFraction& checkedFraction)
+{
+    *this = *this + checkedFraction;
+    return *this;
+}
+
+CheckedFraction& CheckedFraction::operator-=(const CheckedFraction& checkedFraction)
+{
+    *this = *this - checkedFraction;
+    return *this;
+}
+
+CheckedFraction& CheckedFraction::operator*=(const CheckedFraction& checkedFraction)
+{
+    *this = *this * checkedFraction;
+    return *this;
+}
+
+CheckedFraction& CheckedFraction::operator/=(const CheckedFraction& checkedFraction)
+{
+    *this = *this / checkedFraction;
+    return *this;
+}
+
+std::strong_ordering CheckedFraction::operator<=>(const CheckedFraction& checkedFraction) const
+{
+    return multiplyTerms(mNumerator, checkedFraction.mDenominator) <=> multiplyTerms(checkedFraction.mNumerator, mDenominator);
+}
+
+bool CheckedFraction::operator==(const CheckedFraction& checkedFraction) const
+{
+    const bool cIsEqual{mNumerator == checkedFraction.mNumerator && mDenominator == checkedFraction.mDenominator};
+    return cIsEqual;
+}
+
+CheckedFraction::operator bool() const
+{
+    return 0 != mNumerator;
+}
+
+bool CheckedFraction::fitsFraction() const
+{
+    const bool cFitsFraction{mNumerator >= std::numeric_limits<int>::min() && mNumerator <= std::numeric_limits<int>::max() &&
+                             mDenominator <= std::numeric_limits<int>::max()};
+
+    return cFitsFraction;
+}
+
+Fraction CheckedFraction::toFraction() const
+{
+    if (!fitsFraction())
+    {
+        throw std::runtime_error{"Error! Value does not fit into a Fraction"};
+    }
+
+    const Fraction cResult{static_cast<int>(mNumerator), static_cast<int>(mDenominator)};
+
+    return cResult;
+}
+
+WideFraction CheckedFraction::toWideFraction() const
+{
+    const WideFraction cResult{WideInteger{mNumerator}, WideInteger{mDenominator}};
+    return cResult;
+}
+
+long long CheckedFraction::addTerms(long long first, long long second)
+{
+    if ((second > 0 && first > scMaxTermMagnitude - second) || (second < 0 && first < -scMaxTermMagnitude - second))
+    {
+        FRACTION_COUNT_EVENT(CHECKED_OVERFLOWS);
+        throw std::overflow_error{"Error! Fraction term out of range"};
+    }
+
+    return first + second;
+}
+
+long long CheckedFraction::multiplyTerms(long long first, long long second)
+{
+    if (0 != first && 0 != second && std::abs(first) > scMaxTermMagnitude / std::abs(second))
+    {
+        FRACTION_COUNT_EVENT(CHECKED_OVERFLOWS);
+        throw std::overflow_error{"Error! Fraction term out of range"};
+    }
+
+    return first * second;
+}
+
+void CheckedFraction::normalize()
+{
+    if (0 == mNumerator)
+    {
+        mDenominator = 1;
+    }
+    else
+    {
+        const long long cGreatestCommonDivisor{std::gcd(mNumerator, mDenominator)};
+
+        mNumerator /= cGreatestCommonDivisor;
+        mDenominator /= cGreatestCommonDivisor;
+
+        if (mDenominator < 0)
+        {
+            mNumerator = -mNumerator;
+            mDenominator = -mDenominator;
+        }
+    }
+}
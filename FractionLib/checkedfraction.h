@@ -0,0 +1,58 @@
+#ifndef CHECKEDFRACTION_H
+#define CHECKEDFRACTION_H
+
+#include <compare>
+
+#include "fraction.h"
+#include "widefraction.h"
+
+/* Rational number with long long terms whose operations throw std::overflow_error instead of silently wrapping around;
+   it is the fast path of the algorithms that fall back to wide integers only when the values actually grow too large
+*/
+class CheckedFraction
+{
+public:
+    // constructors
+    CheckedFraction();
+    CheckedFraction(long long numerator, long long denominator = 1);
+    CheckedFraction(const Fraction& fraction);
+
+    // getters
+    long long getNumerator() const;
+    long long getDenominator() const;
+
+    // arithmetic operators
+    CheckedFraction operator+(const CheckedFraction& checkedFraction) const;
+    CheckedFraction operator-(const CheckedFraction& checkedFraction) const;
+    CheckedFraction operator*(const CheckedFraction& checkedFraction) const;
+    CheckedFraction operator/(const CheckedFraction& checkedFraction) const;
+    CheckedFraction operator-() const;
+
+    CheckedFraction& operator+=(const CheckedFraction& checkedFraction);
+    CheckedFraction& operator-=(const CheckedFraction& checkedFraction);
+    CheckedFraction& operator*=(const CheckedFraction& checkedFraction);
+    CheckedFraction& operator/=(const CheckedFraction& checkedFraction);
+
+    // logical operators
+    std::strong_ordering operator<=>(const CheckedFraction& checkedFraction) const;
+    bool operator==(const CheckedFraction& checkedFraction) const;
+
+    explicit operator bool() const;
+
+    // conversion functions
+    bool fitsFraction() const;
+    Fraction toFraction() const;
+    WideFraction toWideFraction() const;
+
+    // static helper functions (throw std::overflow_error if the result is not representable)
+    static long long addTerms(long long first, long long second);
+    static long long multiplyTerms(long long first, long long second);
+
+private:
+    void normalize();
+
+    long long mNumerator;
+    long long mDenominator;
+};
+
+#endif // CHECKEDFRACTION_H
@@ -0,0 +1,178 @@
+#include "continuedfraction.h"
+
+SemiconvergentSequence::Iterator::Iterator()
+    : mTerms{nullptr}
+    , mTermIndex{0}
+    , mMultiplier{0}
+    , mPreviousNumerator{0}
+    , mPreviousDenominator{1}
+    , mNumerator{1}
+    , mDenominator{0}
+    , mIsEnd{true}
+{
+}
+
+// a0 / 1 = (p_-2 + a0 * p_-1) / (q_-2 + a0 * q_-1)
+SemiconvergentSequence::Iterator::Iterator(const std::vector<int>& terms)
+    : mTerms{&terms}
+    , mTermIndex{0}
+    , mMultiplier{terms.front()}
+    , mPreviousNumerator{0}
+    , mPreviousDenominator{1}
+    , mNumerator{1}
+    , mDenominator{0}
+    , mIsEnd{false}
+{
+}
+
+Fraction SemiconvergentSequence::Iterator::operator*() const
+{
+    // p_(k-2) * q_(k-1) - p_(k-1) * q_(k-2) = +-1, so the semiconvergents are always reduced
+    return Fraction::fromReducedTerms(static_cast<int>(mPreviousNumerator + mMultiplier * mNumerator),
+                                      static_cast<int>(mPreviousDenominator + mMultiplier * mDenominator));
+}
+
+SemiconvergentSequence::Iterator& SemiconvergentSequence::Iterator::operator++()
+{
+    if (0 != mTermIndex && mMultiplier < (*mTerms)[mTermIndex])
+    {
+        ++mMultiplier;
+    }
+    else if (mTermIndex + 1 == mTerms->size())
+    {
+        mIsEnd = true;
+    }
+    else
+    {
+        // the current convergent p_k / q_k becomes p_(k-1) / q_(k-1) of the next term
+        const long long cNextNumerator{mPreviousNumerator + mMultiplier * mNumerator};
+        const long long cNextDenominator{mPreviousDenominator + mMultiplier * mDenominator};
+
+        mPreviousNumerator = mNumerator;
+        mPreviousDenominator = mDenominator;
+        mNumerator = cNextNumerator;
+        mDenominator = cNextDenominator;
+        ++mTermIndex;
+        mMultiplier = 1;
+    }
+
+    return *this;
+}
+
+SemiconvergentSequence::Iterator SemiconvergentSequence::Iterator::operator++(int)
+{
+    Iterator result{*this};
+    ++*this;
+
+    return result;
+}
+
+bool SemiconvergentSequence::Iterator::operator==(const Iterator& iterator) const
+{
+    return mIsEnd == iterator.mIsEnd && (mIsEnd || (mTermIndex == iterator.mTermIndex && mMultiplier == iterator.mMultiplier));
+}
+
+SemiconvergentSequence::SemiconvergentSequence(const std::vector<int>& terms)
+    : mTerms{terms}
+{
+}
+
+SemiconvergentSequence::Iterator SemiconvergentSequence::begin() const
+{
+    return Iterator{mTerms};
+}
+
+SemiconvergentSequence::Iterator SemiconvergentSequence::end() const
+{
+    return Iterator{};
+}
+
+ContinuedFraction::ContinuedFraction()
+    : mTerms{0}
+{
+}
+
+ContinuedFraction::ContinuedFraction(const Fraction& fraction)
+{
+    // Euclid's algorithm with floor division (the denominator is always positive, only the first term can be negative)
+    long long numerator{fraction.getNumerator()};
+    long long denominator{fraction.getDenominator()};
+
+    while (0 != denominator)
+    {
+        long long term{numerator / denominator};
+
+        if (numerator % denominator < 0)
+        {
+            --term;
+        }
+
+        const long long cRemainder{numerator - term * denominator};
+
+        mTerms.push_back(static_cast<int>(term));
+        numerator = denominator;
+        denominator = cRemainder;
+    }
+}
+
+const std::vector<int>& ContinuedFraction::getTerms() const
+{
+    return mTerms;
+}
+
+std::vector<Fraction> ContinuedFraction::getConvergents() const
+{
+    std::vector<Fraction> convergents;
+    convergents.reserve(mTerms.size());
+
+    long long previousNumerator{1};
+    long long previousDenominator{0};
+    long long numerator{mTerms.front()};
+    long long denominator{1};
+
+    convergents.emplace_back(static_cast<int>(numerator), static_cast<int>(denominator));
+
+    for (size_t index{1}; index < mTerms.size(); ++index)
+    {
+        const long long cNextNumerator{mTerms[index] * numerator + previousNumerator};
+        const long long cNextDenominator{mTerms[index] * denominator + previousDenominator};
+
+        previousNumerator = numerator;
+        previousDenominator = denominator;
+        numerator = cNextNumerator;
+        denominator = cNextDenominator;
+
+        convergents.emplace_back(static_cast<int>(numerator), static_cast<int>(denominator));
+    }
+
+    return convergents;
+}
+
+SemiconvergentSequence ContinuedFraction::getSemiconvergents() const
+{
+    return SemiconvergentSequence{mTerms};
+}
+
+Fraction ContinuedFraction::getBestApproximation(int maxDenominator) const
+{
+    return toFraction().limitDenominator(maxDenominator);
+}
+
+Fraction ContinuedFraction::toFraction() const
+{
+    // the last convergent is the value itself
+    long long numerator{1};
+    long long denominator{0};
+
+    for (auto termIt{mTerms.crbegin()}; termIt != mTerms.crend(); ++termIt)
+    {
+        const long long cNextNumerator{*termIt * numerator + denominator};
+
+        denominator = numerator;
+        numerator = cNextNumerator;
+    }
+
+    const Fraction cResult{static_cast<int>(numerator), static_cast<int>(denominator)};
+
+    return cResult;
+}
@@ -0,0 +1,90 @@
+#ifndef CONTINUEDFRACTION_H
+#define CONTINUEDFRACTION_H
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+
+#include "fraction.h"
+
+/* Semiconvergents of a continued fraction (convergents included) by increasing denominator, i.e. sum(a1..an) + 1 fractions, a0 / 1 being the first one
+   - they are computed lazily, O(1) per step (their count can reach the maximum int, e.g. for 1 / 2147483647)
+   - the sequence keeps a copy of the terms, its iterators are valid as long as it exists
+*/
+class SemiconvergentSequence
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = Fraction;
+        using difference_type = std::ptrdiff_t;
+        using reference = Fraction;
+
+        Iterator();     // past the end iterator
+
+        Fraction operator*() const;
+
+        Iterator& operator++();
+        Iterator operator++(int);
+
+        bool operator==(const Iterator& iterator) const;
+
+    private:
+        friend class SemiconvergentSequence;
+
+        explicit Iterator(const std::vector<int>& terms);
+
+        const std::vector<int>* mTerms;
+        size_t mTermIndex;                  // k
+        long long mMultiplier;              // j (a0 for k = 0)
+        long long mPreviousNumerator;       // p_(k-2)
+        long long mPreviousDenominator;     // q_(k-2)
+        long long mNumerator;               // p_(k-1)
+        long long mDenominator;             // q_(k-1)
+        bool mIsEnd;
+    };
+
+    Iterator begin() const;
+    Iterator end() const;
+
+private:
+    friend class ContinuedFraction;
+
+    explicit SemiconvergentSequence(const std::vector<int>& terms);
+
+    std::vector<int> mTerms;
+};
+
+/* Regular continued fraction expansion [a0; a1, ..., an] of a Fraction (a0 = floor of the value, all other terms positive, an > 1 unless n = 0)
+   - the k-th convergent is p_k / q_k with p_k = a_k * p_(k-1) + p_(k-2), q_k = a_k * q_(k-1) + q_(k-2) (p_-1 = 1, q_-1 = 0, p_-2 = 0, q_-2 = 1)
+   - the semiconvergents are (p_(k-2) + j * p_(k-1)) / (q_(k-2) + j * q_(k-1)) with 1 <= j <= a_k, j = a_k giving the convergent
+   - all terms, convergents and semiconvergents of a Fraction fit into int
+*/
+class ContinuedFraction
+{
+public:
+    // constructors
+    ContinuedFraction();
+    explicit ContinuedFraction(const Fraction& fraction);
+
+    // getters
+    const std::vector<int>& getTerms() const;
+
+    std::vector<Fraction> getConvergents() const;
+
+    // all semiconvergents (see SemiconvergentSequence)
+    SemiconvergentSequence getSemiconvergents() const;
+
+    // closest fraction with denominator not larger than maxDenominator (same result as Fraction::limitDenominator())
+    Fraction getBestApproximation(int maxDenominator) const;
+
+    Fraction toFraction() const;
+
+private:
+    std::vector<int> mTerms;
+};
+
+#endif // CONTINUEDFRACTION_H
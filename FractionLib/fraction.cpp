@@ -1,13 +1,267 @@
-#include <sstream>
 #include <cmath>
 #include <cctype>
 #include <cassert>
+#include <limits>
+#include <array>
+#include <vector>
+#include <cstring>
+#include <numeric>
+#include <charconv>
 #include <algorithm>
+#include <string_view>
 
 #include "fraction.h"
+#include "fractioninstrumentation.h"
 
 static constexpr int scDigitMultiplier{10};
 
+// decimal strings with more decimals than this cannot be parsed exactly with 64 bit terms
+static constexpr int scMaxDecimalsCount{18};
+
+// the long division produces this many decimal digits per step: the remainder (below the denominator < 2^31) times 10^9 fits into 64 bits
+static constexpr size_t scDecimalChunkDigits{9};
+static constexpr std::array<unsigned long long, scDecimalChunkDigits + 1> scPowersOfTen{1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+// sign, up to 10 integer part digits and the decimal point
+static constexpr size_t scMaxDecimalPrefixLength{12};
+
+// the doubles are converted with the precision of the default stream formatting, e.g. "-1.23457e-300" fits into the buffer
+static constexpr int scDoubleStringPrecision{6};
+static constexpr size_t scMaxDoubleStringLength{32};
+
+// throws the exception matching the error reported by the non-throwing API
+static Fraction getValueOrThrow(const std::expected<Fraction, FractionError>& result, const char* divisionByZeroMessage)
+{
+    if (!result)
+    {
+        switch (result.error())
+        {
+        case FractionError::INVALID_FORMAT:
+            throw std::runtime_error{"Error! Wrong fraction format"};
+        case FractionError::DIVISION_BY_ZERO:
+            throw std::runtime_error{divisionByZeroMessage};
+        case FractionError::ARITHMETIC_OVERFLOW:
+            throw std::overflow_error{"Error! Fraction term out of range"};
+        default:
+            assert(false);
+            break;
+        }
+    }
+
+    return *result;
+}
+
+// parses an optionally signed decimal integer without throwing (the minimum long long is rejected so that it can always be negated)
+static std::expected<long long, FractionError> parseTerm(std::string_view termString)
+{
+    if (!termString.empty() && '+' == termString.front())
+    {
+        termString.remove_prefix(1);
+    }
+
+    long long term{0};
+    const std::from_chars_result cParsingResult{std::from_chars(termString.data(), termString.data() + termString.size(), term)};
+
+    if (std::errc::result_out_of_range == cParsingResult.ec || std::numeric_limits<long long>::min() == term)
+    {
+        return std::unexpected{FractionError::ARITHMETIC_OVERFLOW};
+    }
+
+    if (std::errc{} != cParsingResult.ec || termString.data() + termString.size() != cParsingResult.ptr)
+    {
+        return std::unexpected{FractionError::INVALID_FORMAT};
+    }
+
+    return term;
+}
+
+/* Largest k >= 1 for which (numerator + k * stepNumerator) / (denominator + k * stepDenominator) still satisfies the condition (it must hold for k = 1),
+   the step count is doubled until the condition fails and then refined by halving (O(log(k)) evaluations); the terms are kept within the int range
+*/
+template<typename Condition>
+static long long getLongestRun(long long numerator, long long denominator, long long stepNumerator, long long stepDenominator, const Condition& condition)
+{
+    const auto cHolds{[&](long long steps)
+    {
+        const long long cMaxTerm{std::numeric_limits<int>::max()};
+
+        return steps <= cMaxTerm && numerator + steps * stepNumerator <= cMaxTerm && denominator + steps * stepDenominator <= cMaxTerm &&
+               condition(numerator + steps * stepNumerator, denominator + steps * stepDenominator);
+    }};
+
+    long long steps{1};
+    long long increment{1};
+
+    while (cHolds(steps + increment))
+    {
+        steps += increment;
+        increment *= 2;
+    }
+
+    while (increment > 1)
+    {
+        increment /= 2;
+
+        if (cHolds(steps + increment))
+        {
+            steps += increment;
+        }
+    }
+
+    return steps;
+}
+
+/* Walks the Stern-Brocot tree from the bounds 0/1 and 1/0 towards a positive interval (the predicates compare the nodes to its bounds)
+   until a node falls inside it, the sign is applied to the result
+*/
+template<typename IsBelowLower, typename IsAboveUpper>
+static Fraction getSimplestPositive(const IsBelowLower& isBelowLower, const IsAboveUpper& isAboveUpper, bool isNegative)
+{
+    long long leftNumerator{0};
+    long long leftDenominator{1};
+    long long rightNumerator{1};
+    long long rightDenominator{0};
+
+    while (true)
+    {
+        const long long cNumerator{leftNumerator + rightNumerator};
+        const long long cDenominator{leftDenominator + rightDenominator};
+
+        if (cNumerator > std::numeric_limits<int>::max() || cDenominator > std::numeric_limits<int>::max())
+        {
+            throw std::overflow_error{"Error! Fraction term out of range"};
+        }
+
+        if (isBelowLower(cNumerator, cDenominator))
+        {
+            const long long cSteps{getLongestRun(leftNumerator, leftDenominator, rightNumerator, rightDenominator, isBelowLower)};
+
+            leftNumerator += cSteps * rightNumerator;
+            leftDenominator += cSteps * rightDenominator;
+        }
+        else if (isAboveUpper(cNumerator, cDenominator))
+        {
+            const long long cSteps{getLongestRun(rightNumerator, rightDenominator, leftNumerator, leftDenominator, isAboveUpper)};
+
+            rightNumerator += cSteps * leftNumerator;
+            rightDenominator += cSteps * leftDenominator;
+        }
+        else
+        {
+            return Fraction::fromReducedTerms(static_cast<int>(isNegative ? -cNumerator : cNumerator), static_cast<int>(cDenominator));
+        }
+    }
+}
+
+// writes the next fractional digits of remainder / denominator (remainder < denominator) by long division, the final remainder is kept
+static void writeFractionalDigits(char* digits, size_t digitsCount, unsigned long long& remainder, unsigned long long denominator)
+{
+    while (digitsCount > 0)
+    {
+        const size_t cChunkDigits{std::min(digitsCount, scDecimalChunkDigits)};
+        const unsigned long long cScaledRemainder{remainder * scPowersOfTen[cChunkDigits]};
+        unsigned long long chunk{cScaledRemainder / denominator};
+
+        remainder = cScaledRemainder % denominator;
+
+        for (size_t digitIndex{cChunkDigits}; digitIndex > 0; --digitIndex)
+        {
+            digits[digitIndex - 1] = static_cast<char>('0' + chunk % 10);
+            chunk /= 10;
+        }
+
+        digits += cChunkDigits;
+        digitsCount -= cChunkDigits;
+    }
+}
+
+// removes the factors 2 and 5 from the denominator and returns the number of fractional digits they generate (the pre-period length)
+static size_t removeDecimalFactors(unsigned long long& denominator)
+{
+    size_t twosCount{0};
+    size_t fivesCount{0};
+
+    for (; 0 == denominator % 2; denominator /= 2)
+    {
+        ++twosCount;
+    }
+
+    for (; 0 == denominator % 5; denominator /= 5)
+    {
+        ++fivesCount;
+    }
+
+    return std::max(twosCount, fivesCount);
+}
+
+static unsigned long long getModularPower(unsigned long long base, unsigned long long exponent, unsigned long long modulus)
+{
+    unsigned long long result{1 % modulus};
+
+    for (base %= modulus; exponent > 0; exponent /= 2)
+    {
+        if (1 == exponent % 2)
+        {
+            result = result * base % modulus;
+        }
+
+        base = base * base % modulus;
+    }
+
+    return result;
+}
+
+// distinct prime factors by trial division (the values are below 2^31, so the products of the modular arithmetic fit into 64 bits)
+static std::vector<unsigned long long> getPrimeFactors(unsigned long long value)
+{
+    std::vector<unsigned long long> result;
+
+    for (unsigned long long divisor{2}; divisor * divisor <= value; ++divisor)
+    {
+        if (0 == value % divisor)
+        {
+            result.push_back(divisor);
+
+            while (0 == value % divisor)
+            {
+                value /= divisor;
+            }
+        }
+    }
+
+    if (value > 1)
+    {
+        result.push_back(value);
+    }
+
+    return result;
+}
+
+/* Smallest k > 0 with 10^k = 1 modulo the modulus (coprime to 10, larger than 1): it divides Euler's totient of the modulus,
+   which is divided by its prime factors as long as the power stays 1
+*/
+static size_t getMultiplicativeOrderOfTen(unsigned long long modulus)
+{
+    unsigned long long totient{modulus};
+
+    for (const unsigned long long cPrimeFactor : getPrimeFactors(modulus))
+    {
+        totient = totient / cPrimeFactor * (cPrimeFactor - 1);
+    }
+
+    unsigned long long order{totient};
+
+    for (const unsigned long long cPrimeFactor : getPrimeFactors(totient))
+    {
+        while (0 == order % cPrimeFactor && 1 == getModularPower(10, order / cPrimeFactor, modulus))
+        {
+            order /= cPrimeFactor;
+        }
+    }
+
+    return static_cast<size_t>(order);
+}
+
 Fraction::Fraction()
     : mNumerator{0}
     , mDenominator{1}
@@ -25,12 +279,14 @@ Fraction::Fraction(int numerator)
 Fraction::Fraction(double decimalValue)
     : mDenominator{1}
 {
-    std::ostringstream decimalStream;
-    decimalStream << decimalValue;
+    // same text as the default stream formatting (6 significant digits), written into a local buffer instead of an allocated stream
+    std::array<char, scMaxDoubleStringLength> decimalBuffer;
+    const std::to_chars_result cFormattingResult{std::to_chars(decimalBuffer.data(), decimalBuffer.data() + decimalBuffer.size(), decimalValue,
+                                                               std::chars_format::general, scDoubleStringPrecision)};
 
-    const std::string cDecimalString{decimalStream.str()};
+    const std::string_view cDecimalString{decimalBuffer.data(), static_cast<size_t>(cFormattingResult.ptr - decimalBuffer.data())};
     const size_t cCommaIndex{cDecimalString.find('.')};
-    const size_t cDecimalsCount{cCommaIndex != std::string::npos ? cDecimalString.size() - 1 - cCommaIndex : 0u};
+    const size_t cDecimalsCount{cCommaIndex != std::string_view::npos ? cDecimalString.size() - 1 - cCommaIndex : 0u};
 
     for (size_t currentDecimal{0u}; currentDecimal < cDecimalsCount; ++currentDecimal)
 	{
@@ -43,67 +299,13 @@ Fraction::Fraction(double decimalValue)
 }
 
 Fraction::Fraction(int numerator, int denominator)
-    : Fraction{}
+    : Fraction{getValueOrThrow(tryMake(numerator, denominator), "Fatal error! Division by 0.")}
 {
-    if (0 != denominator)
-    {
-        mNumerator = numerator;
-        mDenominator = denominator;
-
-        normalize();
-    }
-    else
-    {
-        throw std::runtime_error{ "Fatal error! Division by 0." };
-	}
 }
 
 Fraction::Fraction(const std::string& fractionString)
-    : Fraction{}
+    : Fraction{getValueOrThrow(tryParse(fractionString), "Fatal error! Division by 0.")}
 {
-    int separatorIndex;
-    NumericStringType status{parseNumericString(fractionString, separatorIndex)};
-
-    switch(status)
-    {
-    case NumericStringType::FRACTION:
-    {
-        mDenominator = std::stoi(fractionString.substr(separatorIndex + 1, fractionString.length() - separatorIndex - 1));
-        if (0 != mDenominator)
-        {
-            mNumerator = std::stoi(fractionString.substr(0, separatorIndex));
-            normalize();
-        }
-        else
-        {
-            throw std::runtime_error{ "Fatal error! Division by 0." };
-        }
-    }
-        break;
-    case NumericStringType::DECIMAL:
-    {
-        int numberOfDecimals{ static_cast<int>(fractionString.length()) - 1 - separatorIndex };
-
-        for (int currentDecimal{ 0 }; currentDecimal < numberOfDecimals; ++currentDecimal)
-        {
-            mDenominator *= scDigitMultiplier;
-        }
-
-        mNumerator = static_cast<int>(std::stod(fractionString) * mDenominator);
-        normalize();
-    }
-        break;
-    case NumericStringType::INTEGER:
-        mNumerator = std::stoi(fractionString);
-        mDecimalValue = static_cast<double>(mNumerator);
-        break;
-    case NumericStringType::INVALID:
-        throw std::runtime_error{"Error! Wrong fraction format"};
-        break;
-    default:
-        assert(false);
-        break;
-    }
 }
 
 Fraction& Fraction::operator=(int fractionString)
@@ -143,15 +345,7 @@ int Fraction::getNumerator() const
 
 void Fraction::setDenominator(int denominator)
 {
-    if (denominator != 0)
-    {
-        mDenominator = denominator;
-        normalize();
-    }
-    else
-    {
-        throw std::runtime_error{ "Fatal error! Division by 0." };
-    }
+    *this = getValueOrThrow(tryMake(mNumerator, denominator), "Fatal error! Division by 0.");
 }
 
 int Fraction::getDenominator() const
@@ -291,93 +485,122 @@ Fraction operator/(const char* fractionString, const Fraction& fraction)
 
 Fraction Fraction::operator^(int power)
 {
-    int numeratorMultiplicator{mNumerator};
-    int denominatorMultiplicator{mDenominator};
-
-    int resultingNumerator{1};
-    int resultingDenominator{1};
-
-    if (power < 0)
-    {
-        power = -power;
-        std::swap(numeratorMultiplicator, denominatorMultiplicator);
-    }
-
-    while (power > 0)
-    {
-        resultingNumerator *= numeratorMultiplicator;
-        resultingDenominator *= denominatorMultiplicator;
-        --power;
-    }
-
-    const Fraction result{resultingNumerator, resultingDenominator};
+    Fraction result{*this};
+    result ^= power;
 
     return result;
 }
 
-void Fraction::operator+=(const Fraction& fraction)
+Fraction& Fraction::operator+=(const Fraction& fraction)
 {
-    *this = *this + fraction;
+    addInPlace(fraction, Sign::Plus);
+
+    return *this;
 }
 
-void Fraction::operator+=(const std::string& fractionString)
+Fraction& Fraction::operator+=(const std::string& fractionString)
 {
-    *this = *this + fractionString;
+    return *this += Fraction{fractionString};
 }
 
-void Fraction::operator+=(const char* fractionString)
+Fraction& Fraction::operator+=(const char* fractionString)
 {
-    *this = *this + fractionString;
+    return *this += Fraction{fractionString};
 }
 
-void Fraction::operator-=(const Fraction& fraction)
+Fraction& Fraction::operator-=(const Fraction& fraction)
 {
-    *this = *this - fraction;
+    addInPlace(fraction, Sign::Minus);
+
+    return *this;
 }
 
-void Fraction::operator-=(const std::string& fractionString)
+Fraction& Fraction::operator-=(const std::string& fractionString)
 {
-    *this = *this - fractionString;
+    return *this -= Fraction{fractionString};
 }
 
-void Fraction::operator-=(const char* fractionString)
+Fraction& Fraction::operator-=(const char* fractionString)
 {
-    *this = *this - fractionString;
+    return *this -= Fraction{fractionString};
 }
 
-void Fraction::operator*=(const Fraction& fraction)
+Fraction& Fraction::operator*=(const Fraction& fraction)
 {
-    *this = *this * fraction;
+    multiplyInPlace(fraction.mNumerator, fraction.mDenominator);
+
+    return *this;
 }
 
-void Fraction::operator*=(const std::string& fractionString)
+Fraction& Fraction::operator*=(const std::string& fractionString)
 {
-    *this = *this * fractionString;
+    return *this *= Fraction{fractionString};
 }
 
-void Fraction::operator*=(const char* fractionString)
+Fraction& Fraction::operator*=(const char* fractionString)
 {
-    *this = *this * fractionString;
+    return *this *= Fraction{fractionString};
 }
 
-void Fraction::operator/=(const Fraction& fraction)
+Fraction& Fraction::operator/=(const Fraction& fraction)
 {
-    *this = *this / fraction;
+    if (0 == fraction.mNumerator)
+    {
+        throw std::runtime_error{"Fatal error! Division by 0."};
+    }
+
+    if (std::numeric_limits<int>::min() == fraction.mNumerator)
+    {
+        // the inverse of the minimum int has no int terms, the quotient is reduced with 64 bit terms
+        *this = getValueOrThrow(tryDivide(fraction), "Fatal error! Division by 0.");
+    }
+    else
+    {
+        // the inverse gets a positive denominator
+        const int cSign{fraction.mNumerator < 0 ? -1 : 1};
+        multiplyInPlace(cSign * fraction.mDenominator, cSign * fraction.mNumerator);
+    }
+
+    return *this;
 }
 
-void Fraction::operator/=(const std::string& fractionString)
+Fraction& Fraction::operator/=(const std::string& fractionString)
 {
-    *this = *this / fractionString;
+    return *this /= Fraction{fractionString};
 }
 
-void Fraction::operator/=(const char* fractionString)
+Fraction& Fraction::operator/=(const char* fractionString)
 {
-    *this = *this / fractionString;
+    return *this /= Fraction{fractionString};
 }
 
-void Fraction::operator^=(int power)
+/* Exponentiation by squaring with 64 bit products: the powers of reduced terms are reduced, and a squared base overflows only
+   if the result does, so an out of range result throws std::overflow_error like the non-throwing API reports it
+*/
+Fraction& Fraction::operator^=(int power)
 {
-    *this = *this ^ power;
+    Fraction base{power < 0 ? getValueOrThrow(tryInverse(), "Fatal error! Division by 0.") : *this};
+    unsigned int exponent{power < 0 ? 0u - static_cast<unsigned int>(power) : static_cast<unsigned int>(power)};
+    Fraction result{1};
+
+    while (exponent > 0)
+    {
+        if (1 == exponent % 2)
+        {
+            result = getValueOrThrow(result.tryMultiply(base), "Fatal error! Division by 0.");
+        }
+
+        exponent /= 2;
+
+        if (exponent > 0)
+        {
+            base = getValueOrThrow(base.tryMultiply(base), "Fatal error! Division by 0.");
+        }
+    }
+
+    *this = result;
+
+    return *this;
 }
 
 Fraction& Fraction::operator++()
@@ -460,7 +683,8 @@ bool Fraction::isUnit() const
 
 std::istream& operator>>(std::istream& inputStream, Fraction& fraction)
 {
-    std::string streamBuffer;
+    // the line buffer of the thread is reused, so no allocation is made once it fits the longest line
+    static thread_local std::string streamBuffer;
     std::getline(inputStream, streamBuffer);
     fraction = streamBuffer;
 
@@ -475,7 +699,8 @@ std::ostream& operator<<(std::ostream& outputStream, Fraction& fraction)
 
 std::ifstream& operator>>(std::ifstream& inputFileStream, Fraction& fraction)
 {
-    std::string streamBuffer;
+    // the line buffer of the thread is reused, so no allocation is made once it fits the longest line
+    static thread_local std::string streamBuffer;
     std::getline(inputFileStream, streamBuffer);
     fraction = streamBuffer;
 
@@ -490,43 +715,418 @@ std::ofstream& operator<<(std::ofstream& outputFileStream, Fraction& fraction)
 
 Fraction Fraction::inverse() const
 {
-    Fraction result{1};
+    return getValueOrThrow(tryInverse(), "Error! Division by 0");
+}
+
+std::expected<Fraction, FractionError> Fraction::tryParse(std::string_view fractionString)
+{
+    FRACTION_COUNT_EVENT(PARSE_CALLS);
+
+    int separatorIndex;
+    std::expected<Fraction, FractionError> result{std::unexpected{FractionError::INVALID_FORMAT}};
 
-    if (mNumerator != 0)
+    switch(parseNumericString(fractionString, separatorIndex))
+    {
+    case NumericStringType::FRACTION:
     {
-        result = Fraction{mDenominator, mNumerator};
+        const std::expected<long long, FractionError> cNumerator{parseTerm(fractionString.substr(0, separatorIndex))};
+        const std::expected<long long, FractionError> cDenominator{parseTerm(fractionString.substr(separatorIndex + 1))};
+
+        result = !cNumerator ? std::unexpected{cNumerator.error()}
+                             : !cDenominator ? std::unexpected{cDenominator.error()}
+                                             : makeReduced(*cNumerator, *cDenominator);
     }
-    else
+        break;
+    case NumericStringType::DECIMAL:
+    {
+        // the digits without the separator form the numerator, the denominator is the matching power of 10 (exact, no floating point rounding);
+        // the integer part and the decimals are combined arithmetically, so no string is allocated
+        const std::string_view cDecimals{fractionString.substr(separatorIndex + 1)};
+        const int cDecimalsCount{static_cast<int>(cDecimals.size())};
+        const std::expected<long long, FractionError> cIntegerPart{parseTerm(fractionString.substr(0, separatorIndex))};
+        long long denominator{1};
+        long long decimalsValue{0};
+
+        for (int currentDecimal{0}; currentDecimal < cDecimalsCount && currentDecimal < scMaxDecimalsCount; ++currentDecimal)
+        {
+            denominator *= scDigitMultiplier;
+            decimalsValue = decimalsValue * scDigitMultiplier + (cDecimals[currentDecimal] - '0');
+        }
+
+        if (cDecimalsCount > scMaxDecimalsCount)
+        {
+            result = std::unexpected{FractionError::ARITHMETIC_OVERFLOW};
+        }
+        else if (!cIntegerPart)
+        {
+            result = std::unexpected{cIntegerPart.error()};
+        }
+        else if (std::abs(*cIntegerPart) > (std::numeric_limits<long long>::max() - decimalsValue) / denominator)
+        {
+            result = std::unexpected{FractionError::ARITHMETIC_OVERFLOW};
+        }
+        else
+        {
+            // the sign is read from the string as the integer part of e.g. "-0.5" is 0
+            const long long cNumerator{std::abs(*cIntegerPart) * denominator + decimalsValue};
+            result = makeReduced('-' == fractionString.front() ? -cNumerator : cNumerator, denominator);
+        }
+    }
+        break;
+    case NumericStringType::INTEGER:
+    {
+        const std::expected<long long, FractionError> cNumerator{parseTerm(fractionString)};
+        result = !cNumerator ? std::unexpected{cNumerator.error()} : makeReduced(*cNumerator, 1);
+    }
+        break;
+    default:
+        break;
+    }
+
+    if (!result)
     {
-        throw std::runtime_error{ "Error! Division by 0" };
+        FRACTION_COUNT_EVENT(PARSE_FAILURES);
     }
 
     return result;
 }
 
-/* Parses a numeric string that can be in one of the three accepted formats: (integer) fraction, decimal, integer
-   (decimal fraction or scientific formats are excluded)
-*/
-Fraction::NumericStringType Fraction::parseNumericString(const std::string& numericString, int& separatorIndex)
+std::expected<Fraction, FractionError> Fraction::tryMake(int numerator, int denominator)
 {
-    NumericStringType numericStringType{NumericStringType::INVALID};
-    NumericStringParsingState currentState{NumericStringParsingState::NO_CHARS};
-    char separator{'\0'};
+    std::expected<Fraction, FractionError> result{std::unexpected{FractionError::DIVISION_BY_ZERO}};
 
-    separatorIndex = -1; // assume integer or invalid
-
-    for(std::string::const_iterator it{numericString.cbegin()};  it != numericString.cend(); ++it)
+    if (0 != denominator)
     {
-        switch(currentState)
+        if (std::numeric_limits<int>::min() != numerator && std::numeric_limits<int>::min() != denominator)
         {
-        case NumericStringParsingState::NO_CHARS:
-            currentState = ('-' == *it || '+' == *it) ? NumericStringParsingState::FIRST_SIGN
-                                                      : (0 != isdigit(*it)) ? NumericStringParsingState::DIGITS_BEFORE_SEPARATOR
-                                                                            : NumericStringParsingState::INVALID;
-            break;
-        case NumericStringParsingState::FIRST_SIGN:
-            currentState = isdigit(*it) ? NumericStringParsingState::DIGITS_BEFORE_SEPARATOR : NumericStringParsingState::INVALID;
-            break;
+            Fraction fraction;
+            fraction.mNumerator = numerator;
+            fraction.mDenominator = denominator;
+            fraction.normalize();
+
+            result = fraction;
+        }
+        else
+        {
+            // the absolute value of the minimum int is out of range, reduce with 64 bit terms
+            result = makeReduced(numerator, denominator);
+        }
+    }
+
+    return result;
+}
+
+std::expected<Fraction, FractionError> Fraction::tryInverse() const
+{
+    return makeReduced(mDenominator, mNumerator);
+}
+
+std::expected<Fraction, FractionError> Fraction::tryAdd(const Fraction& fraction) const
+{
+    const long long cGreatestCommonDivisor{std::gcd(mDenominator, fraction.mDenominator)};
+    const long long cNumerator{mNumerator * (fraction.mDenominator / cGreatestCommonDivisor) + fraction.mNumerator * (mDenominator / cGreatestCommonDivisor)};
+
+    return makeReduced(cNumerator, mDenominator / cGreatestCommonDivisor * fraction.mDenominator);
+}
+
+std::expected<Fraction, FractionError> Fraction::trySubtract(const Fraction& fraction) const
+{
+    const long long cGreatestCommonDivisor{std::gcd(mDenominator, fraction.mDenominator)};
+    const long long cNumerator{mNumerator * (fraction.mDenominator / cGreatestCommonDivisor) - fraction.mNumerator * (mDenominator / cGreatestCommonDivisor)};
+
+    return makeReduced(cNumerator, mDenominator / cGreatestCommonDivisor * fraction.mDenominator);
+}
+
+std::expected<Fraction, FractionError> Fraction::tryMultiply(const Fraction& fraction) const
+{
+    return makeReduced(static_cast<long long>(mNumerator) * fraction.mNumerator, static_cast<long long>(mDenominator) * fraction.mDenominator);
+}
+
+std::expected<Fraction, FractionError> Fraction::tryDivide(const Fraction& fraction) const
+{
+    return makeReduced(static_cast<long long>(mNumerator) * fraction.mDenominator, static_cast<long long>(mDenominator) * fraction.mNumerator);
+}
+
+Fraction Fraction::limitDenominator(int maxDenominator) const
+{
+    if (maxDenominator < 1)
+    {
+        throw std::runtime_error{"Error! Invalid maximum denominator"};
+    }
+
+    Fraction result{*this};
+
+    if (mDenominator > maxDenominator)
+    {
+        // walk the convergents of |value| until the next one exceeds the maximum denominator (p0/q0, p1/q1 are the last two convergents)
+        const long long cNumerator{std::abs(static_cast<long long>(mNumerator))};
+        long long previousNumerator{0};
+        long long previousDenominator{1};
+        long long numerator{1};
+        long long denominator{0};
+        long long currentNumerator{cNumerator};
+        long long currentDenominator{mDenominator};
+
+        while (true)
+        {
+            const long long cTerm{currentNumerator / currentDenominator};
+            const long long cNextDenominator{previousDenominator + cTerm * denominator};
+
+            if (cNextDenominator > maxDenominator)
+            {
+                break;
+            }
+
+            const long long cNextNumerator{previousNumerator + cTerm * numerator};
+            const long long cRemainder{currentNumerator - cTerm * currentDenominator};
+
+            previousNumerator = numerator;
+            previousDenominator = denominator;
+            numerator = cNextNumerator;
+            denominator = cNextDenominator;
+            currentNumerator = currentDenominator;
+            currentDenominator = cRemainder;
+        }
+
+        // the best approximation is either the last convergent or the largest admissible semiconvergent (on the other side of the value)
+        const long long cMultiplier{(maxDenominator - previousDenominator) / denominator};
+        const long long cSemiconvergentNumerator{previousNumerator + cMultiplier * numerator};
+        const long long cSemiconvergentDenominator{previousDenominator + cMultiplier * denominator};
+
+        // |value - p / q| = |numerator * q - p * denominator| / (denominator * q), the scaled errors are below the denominator so no overflow occurs
+        const long long cConvergentError{std::abs(cNumerator * denominator - numerator * mDenominator)};
+        const long long cSemiconvergentError{std::abs(cNumerator * cSemiconvergentDenominator - cSemiconvergentNumerator * mDenominator)};
+        const bool cIsConvergentCloser{cConvergentError * cSemiconvergentDenominator <= cSemiconvergentError * denominator};
+        const long long cResultNumerator{cIsConvergentCloser ? numerator : cSemiconvergentNumerator};
+        const long long cResultDenominator{cIsConvergentCloser ? denominator : cSemiconvergentDenominator};
+
+        result = Fraction{static_cast<int>(mNumerator < 0 ? -cResultNumerator : cResultNumerator), static_cast<int>(cResultDenominator)};
+    }
+
+    return result;
+}
+
+Fraction Fraction::simplestBetween(const Fraction& lower, const Fraction& upper)
+{
+    if (static_cast<long long>(upper.mNumerator) * lower.mDenominator < static_cast<long long>(lower.mNumerator) * upper.mDenominator)
+    {
+        throw std::runtime_error{"Error! Invalid interval"};
+    }
+
+    Fraction result;
+
+    if (lower.mNumerator > 0 || upper.mNumerator < 0)
+    {
+        // negative intervals are mirrored
+        const bool cIsNegative{upper.mNumerator < 0};
+        const long long cLowerNumerator{cIsNegative ? -static_cast<long long>(upper.mNumerator) : lower.mNumerator};
+        const long long cLowerDenominator{cIsNegative ? upper.mDenominator : lower.mDenominator};
+        const long long cUpperNumerator{cIsNegative ? -static_cast<long long>(lower.mNumerator) : upper.mNumerator};
+        const long long cUpperDenominator{cIsNegative ? lower.mDenominator : upper.mDenominator};
+
+        result = getSimplestPositive([cLowerNumerator, cLowerDenominator](long long numerator, long long denominator)
+                                     {
+                                         return numerator * cLowerDenominator < cLowerNumerator * denominator;
+                                     },
+                                     [cUpperNumerator, cUpperDenominator](long long numerator, long long denominator)
+                                     {
+                                         return numerator * cUpperDenominator > cUpperNumerator * denominator;
+                                     },
+                                     cIsNegative);
+    }
+
+    return result;
+}
+
+Fraction Fraction::simplestBetween(double lower, double upper)
+{
+    if (!std::isfinite(lower) || !std::isfinite(upper) || upper < lower)
+    {
+        throw std::runtime_error{"Error! Invalid interval"};
+    }
+
+    Fraction result;
+
+    if (lower > 0.0 || upper < 0.0)
+    {
+        const bool cIsNegative{upper < 0.0};
+        const double cLower{cIsNegative ? -upper : lower};
+        const double cUpper{cIsNegative ? -lower : upper};
+
+        result = getSimplestPositive([cLower](long long numerator, long long denominator)
+                                     {
+                                         return static_cast<double>(numerator) < cLower * static_cast<double>(denominator);
+                                     },
+                                     [cUpper](long long numerator, long long denominator)
+                                     {
+                                         return static_cast<double>(numerator) > cUpper * static_cast<double>(denominator);
+                                     },
+                                     cIsNegative);
+    }
+
+    return result;
+}
+
+std::string Fraction::toDecimalString(int digits, RoundingMode roundingMode) const
+{
+    std::string result(getMaxDecimalStringLength(digits), '\0');
+    result.resize(toDecimalString(std::span<char>{result}, digits, roundingMode));
+
+    return result;
+}
+
+size_t Fraction::toDecimalString(std::span<char> buffer, int digits, RoundingMode roundingMode) const
+{
+    if (buffer.size() < getMaxDecimalStringLength(digits))
+    {
+        throw std::runtime_error{"Error! Insufficient buffer size"};
+    }
+
+    const size_t cDigitsCount{static_cast<size_t>(digits)};
+    const bool cIsNegative{mNumerator < 0};
+    const unsigned long long cMagnitude{static_cast<unsigned long long>(std::abs(static_cast<long long>(mNumerator)))};
+    const unsigned long long cDenominator{static_cast<unsigned long long>(mDenominator)};
+
+    unsigned long long integerPart{cMagnitude / cDenominator};
+    unsigned long long remainder{cMagnitude % cDenominator};
+
+    // the fractional digits are written after the room of the longest prefix and moved next to the actual prefix at the end
+    char* const cDigits{buffer.data() + scMaxDecimalPrefixLength};
+    writeFractionalDigits(cDigits, cDigitsCount, remainder, cDenominator);
+
+    const unsigned long long cLastDigit{cDigitsCount > 0 ? static_cast<unsigned long long>(cDigits[cDigitsCount - 1] - '0') : integerPart % 10};
+    bool isIncremented{false};
+
+    switch (roundingMode)
+    {
+    case RoundingMode::TOWARD_ZERO:
+        break;
+    case RoundingMode::FLOOR:
+        isIncremented = cIsNegative && 0 != remainder;
+        break;
+    case RoundingMode::CEILING:
+        isIncremented = !cIsNegative && 0 != remainder;
+        break;
+    case RoundingMode::HALF_AWAY_FROM_ZERO:
+        isIncremented = 2 * remainder >= cDenominator;
+        break;
+    case RoundingMode::HALF_EVEN:
+        isIncremented = 2 * remainder > cDenominator || (2 * remainder == cDenominator && 1 == cLastDigit % 2);
+        break;
+    default:
+        assert(false);
+        break;
+    }
+
+    if (isIncremented)
+    {
+        size_t digitIndex{cDigitsCount};
+
+        for (; digitIndex > 0 && '9' == cDigits[digitIndex - 1]; --digitIndex)
+        {
+            cDigits[digitIndex - 1] = '0';
+        }
+
+        if (digitIndex > 0)
+        {
+            ++cDigits[digitIndex - 1];
+        }
+        else
+        {
+            ++integerPart;
+        }
+    }
+
+    // the values rounded to zero get no sign
+    const bool cIsZero{0 == integerPart && std::all_of(cDigits, cDigits + cDigitsCount, [](char digit) {return '0' == digit;})};
+    std::array<char, scMaxDecimalPrefixLength> prefix;
+    char* prefixEnd{prefix.data()};
+
+    if (cIsNegative && !cIsZero)
+    {
+        *prefixEnd++ = '-';
+    }
+
+    prefixEnd = std::to_chars(prefixEnd, prefix.data() + prefix.size(), integerPart).ptr;
+
+    if (cDigitsCount > 0)
+    {
+        *prefixEnd++ = '.';
+    }
+
+    const size_t cPrefixLength{static_cast<size_t>(prefixEnd - prefix.data())};
+
+    std::memmove(buffer.data() + cPrefixLength, cDigits, cDigitsCount);
+    std::memcpy(buffer.data(), prefix.data(), cPrefixLength);
+
+    return cPrefixLength + cDigitsCount;
+}
+
+size_t Fraction::getMaxDecimalStringLength(int digits)
+{
+    if (digits < 0)
+    {
+        throw std::runtime_error{"Error! Invalid digits count"};
+    }
+
+    return scMaxDecimalPrefixLength + static_cast<size_t>(digits);
+}
+
+Fraction::DecimalExpansion Fraction::decimalExpansion() const
+{
+    const unsigned long long cMagnitude{static_cast<unsigned long long>(std::abs(static_cast<long long>(mNumerator)))};
+    const unsigned long long cDenominator{static_cast<unsigned long long>(mDenominator)};
+
+    unsigned long long periodModulus{cDenominator};
+    unsigned long long remainder{cMagnitude % cDenominator};
+
+    DecimalExpansion result;
+
+    result.integerPart = (mNumerator < 0 ? "-" : "") + std::to_string(cMagnitude / cDenominator);
+    result.preperiod.resize(removeDecimalFactors(periodModulus));
+    writeFractionalDigits(result.preperiod.data(), result.preperiod.size(), remainder, cDenominator);
+
+    // the remainder is 0 exactly when the expansion terminates
+    if (0 != remainder)
+    {
+        result.period.resize(getMultiplicativeOrderOfTen(periodModulus));
+        writeFractionalDigits(result.period.data(), result.period.size(), remainder, cDenominator);
+    }
+
+    return result;
+}
+
+size_t Fraction::getDecimalPeriodLength() const
+{
+    unsigned long long periodModulus{static_cast<unsigned long long>(mDenominator)};
+    (void)removeDecimalFactors(periodModulus);
+
+    return 1 == periodModulus ? 0 : getMultiplicativeOrderOfTen(periodModulus);
+}
+
+/* Parses a numeric string that can be in one of the three accepted formats: (integer) fraction, decimal, integer
+   (decimal fraction or scientific formats are excluded)
+*/
+Fraction::NumericStringType Fraction::parseNumericString(std::string_view numericString, int& separatorIndex)
+{
+    NumericStringType numericStringType{NumericStringType::INVALID};
+    NumericStringParsingState currentState{NumericStringParsingState::NO_CHARS};
+    char separator{'\0'};
+
+    separatorIndex = -1; // assume integer or invalid
+
+    for(std::string_view::const_iterator it{numericString.cbegin()};  it != numericString.cend(); ++it)
+    {
+        switch(currentState)
+        {
+        case NumericStringParsingState::NO_CHARS:
+            currentState = ('-' == *it || '+' == *it) ? NumericStringParsingState::FIRST_SIGN
+                                                      : (0 != isdigit(*it)) ? NumericStringParsingState::DIGITS_BEFORE_SEPARATOR
+                                                                            : NumericStringParsingState::INVALID;
+            break;
+        case NumericStringParsingState::FIRST_SIGN:
+            currentState = isdigit(*it) ? NumericStringParsingState::DIGITS_BEFORE_SEPARATOR : NumericStringParsingState::INVALID;
+            break;
         case NumericStringParsingState::DIGITS_BEFORE_SEPARATOR:
             if ('/' == *it)
             {
@@ -599,20 +1199,25 @@ int Fraction::getGreatestCommonDivisor(int first, int second)
 {
     int greatestCommonDivisor{1};
 
+    FRACTION_COUNT_EVENT(GCD_CALLS);
+
     if (0 != first && 0 != second)
     {
         first = std::abs(first);
         second = std::abs(second);
 
         int remainder{first % second};
+        [[maybe_unused]] uint64_t iterationsCount{1};
 
         while (remainder)
         {
             first = second;
             second = remainder;
             remainder = first % second;
+            ++iterationsCount;
         }
 
+        FRACTION_RECORD_VALUE(GCD_ITERATIONS, iterationsCount);
         greatestCommonDivisor = second;
     }
     else if (0 != first)
@@ -631,12 +1236,27 @@ int Fraction::getGreatestCommonDivisor(int first, int second)
     return greatestCommonDivisor;
 }
 
+Fraction Fraction::fromReducedTerms(int numerator, int denominator)
+{
+    assert(denominator > 0 && std::gcd(numerator, denominator) == 1);
+
+    Fraction result;
+    result.mNumerator = numerator;
+    result.mDenominator = denominator;
+    result.mDecimalValue = static_cast<double>(numerator) / denominator;
+
+    return result;
+}
+
 void Fraction::normalize()
 {
     const int cGreatestCommonDivisor{getGreatestCommonDivisor(std::abs(mNumerator), std::abs(mDenominator))};
 
+    FRACTION_COUNT_EVENT(NORMALIZE_CALLS);
+
     if (1 != cGreatestCommonDivisor)
     {
+        FRACTION_COUNT_EVENT(NORMALIZE_REDUCTIONS);
         mNumerator /= cGreatestCommonDivisor;
         mDenominator /= cGreatestCommonDivisor;
     }
@@ -650,24 +1270,271 @@ void Fraction::normalize()
     mDecimalValue = static_cast<double>(mNumerator) / mDenominator;
 }
 
+std::expected<Fraction, FractionError> Fraction::makeReduced(long long numerator, long long denominator)
+{
+    if (0 == denominator)
+    {
+        return std::unexpected{FractionError::DIVISION_BY_ZERO};
+    }
+
+    const long long cGreatestCommonDivisor{std::gcd(numerator, denominator)};
+
+    numerator /= cGreatestCommonDivisor;
+    denominator /= cGreatestCommonDivisor;
+
+    if (denominator < 0)
+    {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    if (numerator < std::numeric_limits<int>::min() || numerator > std::numeric_limits<int>::max() || denominator > std::numeric_limits<int>::max())
+    {
+        return std::unexpected{FractionError::ARITHMETIC_OVERFLOW};
+    }
+
+    Fraction result;
+    result.mNumerator = static_cast<int>(numerator);
+    result.mDenominator = static_cast<int>(denominator);
+    result.mDecimalValue = static_cast<double>(numerator) / denominator;
+
+    return result;
+}
+
+/* The fast path results are reduced by construction, so they are computed with 64 bit terms and taken only when they fit into int terms:
+   out of range results are left to the general path (like any other operands)
+*/
+static bool fitsTerms(long long numerator, long long denominator)
+{
+    return numerator >= std::numeric_limits<int>::min() && numerator <= std::numeric_limits<int>::max() && denominator <= std::numeric_limits<int>::max();
+}
+
+bool Fraction::addFastPath(const Fraction& fraction, Sign sign, Fraction& result) const
+{
+    const long long cOtherNumerator{static_cast<long long>(sign) * fraction.mNumerator};
+    long long numerator;
+    long long denominator;
+
+    if (1 == fraction.mDenominator || 1 == mDenominator)
+    {
+        // a/b + k = (a + k * b) / b is reduced, as gcd(a + k * b, b) = gcd(a, b) = 1
+        numerator = mNumerator * static_cast<long long>(fraction.mDenominator) + cOtherNumerator * mDenominator;
+        denominator = static_cast<long long>(mDenominator) * fraction.mDenominator;
+
+        if (!fitsTerms(numerator, denominator))
+        {
+            return false;
+        }
+
+        if (0 == cOtherNumerator || 0 == mNumerator)
+        {
+            FRACTION_COUNT_EVENT(ZERO_OPERAND_HITS);
+        }
+        else
+        {
+            FRACTION_COUNT_EVENT(INTEGER_OPERAND_HITS);
+            FRACTION_RECORD_INTERMEDIATE_TERMS(numerator, denominator);
+        }
+    }
+    else if (mDenominator == fraction.mDenominator)
+    {
+        // only the common factors of the numerators sum and the denominator are left (the zero sum gets the denominator 1)
+        const long long cNumerator{mNumerator + cOtherNumerator};
+        const long long cGreatestCommonDivisor{std::gcd(cNumerator, static_cast<long long>(mDenominator))};
+
+        numerator = cNumerator / cGreatestCommonDivisor;
+        denominator = mDenominator / cGreatestCommonDivisor;
+
+        if (!fitsTerms(numerator, denominator))
+        {
+            return false;
+        }
+
+        FRACTION_COUNT_EVENT(SAME_DENOMINATOR_HITS);
+        FRACTION_RECORD_INTERMEDIATE_TERMS(cNumerator, mDenominator);
+    }
+    else
+    {
+        return false;
+    }
+
+    result = fromReducedTerms(static_cast<int>(numerator), static_cast<int>(denominator));
+
+    return true;
+}
+
+// the operand numerator / denominator is reduced, with a positive denominator
+bool Fraction::multiplyFastPath(int numerator, int denominator, Fraction& result) const
+{
+    if (0 == mNumerator || 0 == numerator)
+    {
+        FRACTION_COUNT_EVENT(ZERO_OPERAND_HITS);
+        result = Fraction{};
+
+        return true;
+    }
+
+    const bool cIsUnitOperand{1 == denominator && (1 == numerator || -1 == numerator)};
+    const bool cIsUnit{1 == mDenominator && (1 == mNumerator || -1 == mNumerator)};
+
+    // integer operand k or unit fraction operand 1/k (e.g. division by an integer) and the other way around: a single common factor can be left,
+    // gcd(k, b) for a/b * k and gcd(a, k) for a/b * 1/k
+    const bool cIsOperandFactorCancelled{1 == denominator || 1 == mNumerator || -1 == mNumerator};
+    const bool cIsOwnFactorCancelled{1 == mDenominator || 1 == numerator || -1 == numerator};
+
+    if (!cIsUnitOperand && !cIsUnit && !cIsOperandFactorCancelled && !cIsOwnFactorCancelled)
+    {
+        return false;
+    }
+
+    long long resultingNumerator{static_cast<long long>(mNumerator) * numerator};
+    long long resultingDenominator{static_cast<long long>(mDenominator) * denominator};
+
+    if (!cIsUnitOperand && !cIsUnit)
+    {
+        const long long cCommonFactor{cIsOperandFactorCancelled ? std::gcd(static_cast<long long>(numerator), static_cast<long long>(mDenominator))
+                                                                : std::gcd(static_cast<long long>(mNumerator), static_cast<long long>(denominator))};
+
+        resultingNumerator /= cCommonFactor;
+        resultingDenominator /= cCommonFactor;
+    }
+
+    if (!fitsTerms(resultingNumerator, resultingDenominator))
+    {
+        return false;
+    }
+
+    if (cIsUnitOperand || cIsUnit)
+    {
+        FRACTION_COUNT_EVENT(UNIT_OPERAND_HITS);
+    }
+    else
+    {
+        FRACTION_COUNT_EVENT(INTEGER_OPERAND_HITS);
+        FRACTION_RECORD_INTERMEDIATE_TERMS(static_cast<long long>(mNumerator) * numerator, static_cast<long long>(mDenominator) * denominator);
+    }
+
+    result = fromReducedTerms(static_cast<int>(resultingNumerator), static_cast<int>(resultingDenominator));
+
+    return true;
+}
+
 Fraction Fraction::add(const Fraction& fraction, Fraction::Sign sign) const
 {
+    Fraction result;
+
+    if (addFastPath(fraction, sign, result))
+    {
+        return result;
+    }
+
+    FRACTION_COUNT_EVENT(GENERAL_ARITHMETIC_PATHS);
+
     const int cGreatestCommonDivisor{ getGreatestCommonDivisor(std::abs(mDenominator), std::abs(fraction.mDenominator)) };
     const int cFirstMultiplicationFactor{ fraction.mDenominator / cGreatestCommonDivisor };
     const int cSecondMultiplicationFactor{ static_cast<int>(sign) * mDenominator / cGreatestCommonDivisor };
     const int cResultingNumerator{mNumerator * cFirstMultiplicationFactor + fraction.mNumerator * cSecondMultiplicationFactor};
     const int cResultingDenominator{cFirstMultiplicationFactor * mDenominator};
 
+    FRACTION_RECORD_INTERMEDIATE_TERMS(static_cast<long long>(mNumerator) * cFirstMultiplicationFactor + static_cast<long long>(fraction.mNumerator) * cSecondMultiplicationFactor,
+                                       static_cast<long long>(cFirstMultiplicationFactor) * mDenominator);
+
     const Fraction cResult{cResultingNumerator, cResultingDenominator};
 
     return cResult;
 }
 
+/* With g = gcd(b, d): a/b + c/d = (a * (d/g) + c * (b/g)) / (b/g * d) and, as both fractions are reduced, only the factors of g can be common
+   to these terms, so the result is reduced by the (smaller) GCD of the numerator and g (Knuth, TAOCP vol. 2, 4.5.1)
+*/
+void Fraction::addInPlace(const Fraction& fraction, Sign sign)
+{
+    if (addFastPath(fraction, sign, *this))
+    {
+        return;
+    }
+
+    FRACTION_COUNT_EVENT(GENERAL_ARITHMETIC_PATHS);
+
+    const int cGreatestCommonDivisor{getGreatestCommonDivisor(mDenominator, fraction.mDenominator)};
+    const int cFirstMultiplicationFactor{fraction.mDenominator / cGreatestCommonDivisor};
+    const int cSecondMultiplicationFactor{mDenominator / cGreatestCommonDivisor};
+
+    FRACTION_RECORD_INTERMEDIATE_TERMS(static_cast<long long>(mNumerator) * cFirstMultiplicationFactor + static_cast<int>(sign) * static_cast<long long>(fraction.mNumerator) * cSecondMultiplicationFactor,
+                                       static_cast<long long>(cSecondMultiplicationFactor) * fraction.mDenominator);
+
+    int resultingNumerator{mNumerator * cFirstMultiplicationFactor + static_cast<int>(sign) * fraction.mNumerator * cSecondMultiplicationFactor};
+    int resultingDenominator{fraction.mDenominator};
+
+    if (0 == resultingNumerator)
+    {
+        resultingDenominator = 1;
+    }
+    else if (1 != cGreatestCommonDivisor)
+    {
+        const int cCommonFactor{getGreatestCommonDivisor(resultingNumerator, cGreatestCommonDivisor)};
+
+        resultingNumerator /= cCommonFactor;
+        resultingDenominator /= cCommonFactor;
+    }
+
+    mNumerator = resultingNumerator;
+    mDenominator = cSecondMultiplicationFactor * resultingDenominator;
+    mDecimalValue = static_cast<double>(mNumerator) / mDenominator;
+}
+
+/* Multiplies by numerator / denominator (reduced, the denominator might be negative when dividing): the cross GCDs are removed before multiplying,
+   so the product is reduced and its intermediate terms are as small as possible
+*/
+void Fraction::multiplyInPlace(int numerator, int denominator)
+{
+    if (denominator > 0 && multiplyFastPath(numerator, denominator, *this))
+    {
+        return;
+    }
+
+    FRACTION_COUNT_EVENT(GENERAL_ARITHMETIC_PATHS);
+
+    const int cFirstCommonFactor{getGreatestCommonDivisor(mNumerator, denominator)};
+    const int cSecondCommonFactor{getGreatestCommonDivisor(numerator, mDenominator)};
+
+    FRACTION_RECORD_INTERMEDIATE_TERMS(static_cast<long long>(mNumerator / cFirstCommonFactor) * (numerator / cSecondCommonFactor),
+                                       static_cast<long long>(mDenominator / cSecondCommonFactor) * (denominator / cFirstCommonFactor));
+
+    int resultingNumerator{(mNumerator / cFirstCommonFactor) * (numerator / cSecondCommonFactor)};
+    int resultingDenominator{(mDenominator / cSecondCommonFactor) * (denominator / cFirstCommonFactor)};
+
+    if (0 == resultingNumerator)
+    {
+        resultingDenominator = 1;
+    }
+    else if (resultingDenominator < 0)
+    {
+        resultingNumerator = -resultingNumerator;
+        resultingDenominator = -resultingDenominator;
+    }
+
+    mNumerator = resultingNumerator;
+    mDenominator = resultingDenominator;
+    mDecimalValue = static_cast<double>(mNumerator) / mDenominator;
+}
+
 Fraction Fraction::multiply(const Fraction& fraction) const
 {
+    Fraction result;
+
+    if (multiplyFastPath(fraction.mNumerator, fraction.mDenominator, result))
+    {
+        return result;
+    }
+
+    FRACTION_COUNT_EVENT(GENERAL_ARITHMETIC_PATHS);
+
     const int cResultingNumerator{mNumerator * fraction.mNumerator};
     const int cResultingDenominator{mDenominator * fraction.mDenominator};
 
+    FRACTION_RECORD_INTERMEDIATE_TERMS(static_cast<long long>(mNumerator) * fraction.mNumerator, static_cast<long long>(mDenominator) * fraction.mDenominator);
+
     const Fraction cResult{cResultingNumerator, cResultingDenominator};
 
     return cResult;
@@ -676,9 +1543,24 @@ Fraction Fraction::multiply(const Fraction& fraction) const
 
 Fraction Fraction::divide(const Fraction& fraction) const
 {
+    Fraction result;
+
+    // multiplication by the inverse with a positive denominator, the division by 0 (and by the minimum int) is left to the general path
+    const bool cHasInverse{0 != fraction.mNumerator && std::numeric_limits<int>::min() != fraction.mNumerator};
+    const int cSign{fraction.mNumerator < 0 ? -1 : 1};
+
+    if (cHasInverse && multiplyFastPath(cSign * fraction.mDenominator, cSign * fraction.mNumerator, result))
+    {
+        return result;
+    }
+
+    FRACTION_COUNT_EVENT(GENERAL_ARITHMETIC_PATHS);
+
     const int cResultingNumerator{mNumerator * fraction.mDenominator};
     const int cResultingDenominator{mDenominator * fraction.mNumerator};
 
+    FRACTION_RECORD_INTERMEDIATE_TERMS(static_cast<long long>(mNumerator) * fraction.mDenominator, static_cast<long long>(mDenominator) * fraction.mNumerator);
+
     const Fraction cResult{cResultingNumerator, cResultingDenominator};
 
     return cResult;
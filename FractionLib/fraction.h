@@ -1,10 +1,21 @@
 #ifndef FRACTION_H
 #define FRACTION_H
 
+#include <span>
 #include <string>
+#include <string_view>
 #include <fstream>
+#include <expected>
 #include <stdexcept>
 
+// error codes of the non-throwing API
+enum class FractionError : unsigned short
+{
+    INVALID_FORMAT = 0,
+    DIVISION_BY_ZERO,
+    ARITHMETIC_OVERFLOW     // the (reduced) result does not fit into int terms
+};
+
 class Fraction
 {
 public:
@@ -16,6 +27,24 @@ public:
         INVALID
     };
 
+    // rounding of the decimal strings (the half modes round to the nearest value)
+    enum class RoundingMode : unsigned short
+    {
+        TOWARD_ZERO = 0,
+        FLOOR,
+        CEILING,
+        HALF_AWAY_FROM_ZERO,
+        HALF_EVEN
+    };
+
+    // e.g. -1/6 = -0.1(6): integer part "-0", pre-period "1", period "6"
+    struct DecimalExpansion
+    {
+        std::string integerPart;    // with the sign
+        std::string preperiod;      // fractional digits before the period
+        std::string period;         // repeating digits, empty when the expansion terminates
+    };
+
     // constructors
     Fraction();
     explicit Fraction(int numerator);
@@ -64,25 +93,25 @@ public:
     Fraction operator/(const char* fractionString);
     friend Fraction operator/(const char* fractionString, const Fraction& fraction);
 
-    Fraction operator^(int power);
+    Fraction operator^(int power);     // throws std::overflow_error when the power does not fit into int terms
 
-    void operator+=(const Fraction& fraction);
-    void operator+=(const std::string& fractionString);
-    void operator+=(const char* fractionString);
+    Fraction& operator+=(const Fraction& fraction);
+    Fraction& operator+=(const std::string& fractionString);
+    Fraction& operator+=(const char* fractionString);
 
-    void operator-=(const Fraction& fraction);
-    void operator-=(const std::string& fractionString);
-    void operator-=(const char* fractionString);
+    Fraction& operator-=(const Fraction& fraction);
+    Fraction& operator-=(const std::string& fractionString);
+    Fraction& operator-=(const char* fractionString);
 
-    void operator*=(const Fraction& fraction);
-    void operator*=(const std::string& fractionString);
-    void operator*=(const char* fractionString);
+    Fraction& operator*=(const Fraction& fraction);
+    Fraction& operator*=(const std::string& fractionString);
+    Fraction& operator*=(const char* fractionString);
 
-    void operator/=(const Fraction& fraction);
-    void operator/=(const std::string& fractionString);
-    void operator/=(const char* fractionString);
+    Fraction& operator/=(const Fraction& fraction);
+    Fraction& operator/=(const std::string& fractionString);
+    Fraction& operator/=(const char* fractionString);
 
-    void operator^=(int power);
+    Fraction& operator^=(int power);
 
     Fraction& operator++();
 	Fraction operator++(int);
@@ -112,10 +141,53 @@ public:
     // other functions
     Fraction inverse() const;
 
+    /* Closest fraction with a denominator not larger than maxDenominator (the ties are resolved towards the smaller denominator),
+       found with O(log(denominator)) continued fraction steps
+    */
+    Fraction limitDenominator(int maxDenominator) const;
+
+    /* Simplest fraction of the closed interval [lower, upper]: the smallest denominator, then the smallest absolute numerator (e.g. 0 when the interval contains it);
+       found by walking the Stern-Brocot tree, the runs of moves in the same direction are done by galloping search (O(log(denominator)) comparisons)
+       - the comparisons of the double overload are done in double precision, its bounds must be finite
+    */
+    static Fraction simplestBetween(const Fraction& lower, const Fraction& upper);
+    static Fraction simplestBetween(double lower, double upper);
+
+    /* Exact decimal representation with the given number of fractional digits (e.g. "-0.167" for -1/6 and 3 digits);
+       the long division produces 9 digits per step (the remainder times 10^9 fits into 64 bits)
+    */
+    std::string toDecimalString(int digits, RoundingMode roundingMode = RoundingMode::HALF_AWAY_FROM_ZERO) const;
+
+    // same as above written into the buffer (not null terminated), which must hold getMaxDecimalStringLength(digits) chars; returns the written length
+    size_t toDecimalString(std::span<char> buffer, int digits, RoundingMode roundingMode = RoundingMode::HALF_AWAY_FROM_ZERO) const;
+    static size_t getMaxDecimalStringLength(int digits);
+
+    /* Complete decimal expansion: the pre-period length is given by the factors 2 and 5 of the denominator and the period length is
+       the multiplicative order of 10 modulo the remaining factor, so no remainders need to be stored
+       - the period can have up to denominator - 1 digits, getDecimalPeriodLength() computes its length without the digits
+    */
+    DecimalExpansion decimalExpansion() const;
+    size_t getDecimalPeriodLength() const;
+
+    /* Non-throwing API (the throwing constructors, setDenominator() and inverse() are wrappers around it);
+       unlike the arithmetic operators the try functions compute with 64 bit intermediate terms and report the overflows of the reduced result
+    */
+    static std::expected<Fraction, FractionError> tryParse(std::string_view fractionString);
+    static std::expected<Fraction, FractionError> tryMake(int numerator, int denominator);
+
+    std::expected<Fraction, FractionError> tryInverse() const;
+    std::expected<Fraction, FractionError> tryAdd(const Fraction& fraction) const;
+    std::expected<Fraction, FractionError> trySubtract(const Fraction& fraction) const;
+    std::expected<Fraction, FractionError> tryMultiply(const Fraction& fraction) const;
+    std::expected<Fraction, FractionError> tryDivide(const Fraction& fraction) const;
+
     // static helper functions
-    static NumericStringType parseNumericString(const std::string& numericString, int& separatorIndex);
+    static NumericStringType parseNumericString(std::string_view numericString, int& separatorIndex);
     static int getGreatestCommonDivisor(int first, int second);
 
+    // fraction from terms known to be reduced (coprime, positive denominator, e.g. the Farey sequence elements), no GCD is computed
+    static Fraction fromReducedTerms(int numerator, int denominator);
+
 private:
     enum class NumericStringParsingState: unsigned short
     {
@@ -137,7 +209,20 @@ private:
 
     void normalize();
 
+    static std::expected<Fraction, FractionError> makeReduced(long long numerator, long long denominator);
+
+    /* Arithmetic on the operand shapes that are frequent in typical data, done without the general GCD and normalization sequence
+       (the results are the same); the checks go from the most frequent shape: integer operands (including the zeros and units),
+       then equal denominators; return false when no fast path applies
+    */
+    bool addFastPath(const Fraction& fraction, Sign sign, Fraction& result) const;
+    bool multiplyFastPath(int numerator, int denominator, Fraction& result) const;
+
     Fraction add(const Fraction& fraction, Sign sign) const;
+
+    // in-place arithmetic used by the compound assignment operators (the terms of *this are known to be reduced)
+    void addInPlace(const Fraction& fraction, Sign sign);
+    void multiplyInPlace(int numerator, int denominator);
     Fraction multiply(const Fraction& fraction) const;
     Fraction divide(const Fraction& fraction) const;
 
@@ -0,0 +1,53 @@
+#include <string>
+
+#include "fractionarray.h"
+
+FractionArray readFractionArray(std::istream& inputStream, std::pmr::memory_resource* memoryResource, FractionContext& context)
+{
+    FractionArray result{memoryResource};
+    std::pmr::string line{memoryResource};
+
+    while (std::getline(inputStream, line))
+    {
+        // files written on Windows
+        if (!line.empty() && '\r' == line.back())
+        {
+            line.pop_back();
+        }
+
+        if (line.empty())
+        {
+            continue;
+        }
+
+        const std::expected<Fraction, FractionError> cFraction{Fraction::tryParse(line)};
+
+        if (cFraction)
+        {
+            result.push_back(*cFraction);
+        }
+        else
+        {
+            context.raise(cFraction.error());
+        }
+    }
+
+    return result;
+}
+
+FractionArray parseFractionArray(std::span<const std::string_view> fractionStrings, std::pmr::memory_resource* memoryResource, FractionContext& context)
+{
+    FractionArray result{memoryResource};
+    FractionContext batchContext;
+
+    result.reserve(fractionStrings.size());
+
+    for (const std::string_view fractionString : fractionStrings)
+    {
+        result.push_back(batchContext.parse(fractionString));
+    }
+
+    context.raiseFlags(batchContext.getFlags());
+
+    return result;
+}
@@ -0,0 +1,30 @@
+#ifndef FRACTIONARRAY_H
+#define FRACTIONARRAY_H
+
+#include <span>
+#include <vector>
+#include <istream>
+#include <string_view>
+#include <memory_resource>
+
+#include "fraction.h"
+#include "fractioncontext.h"
+
+/* Array of fractions whose storage comes from a memory resource, e.g. a std::pmr::monotonic_buffer_resource arena which is released in one shot
+   at the end of a job (no deallocation per element or per array, no contention on the global heap between worker threads)
+   - the containers of the library which accept a memory resource (e.g. the columns of FractionCsvTable) are FractionArrays
+*/
+using FractionArray = std::pmr::vector<Fraction>;
+
+/* Reads one fraction per line into an array allocated from the resource, the line buffer is allocated from it too (same rules as readFractions():
+   the empty lines are skipped, the invalid ones too, raising their error flag in the context)
+   - the array grows geometrically, so a monotonic resource holds less than twice the final array size
+*/
+FractionArray readFractionArray(std::istream& inputStream, std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource(),
+                                FractionContext& context = FractionContext::getThreadContext());
+
+// parses the strings into an array allocated from the resource, the invalid strings give 0 and raise their error flag in the context
+FractionArray parseFractionArray(std::span<const std::string_view> fractionStrings, std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource(),
+                                 FractionContext& context = FractionContext::getThreadContext());
+
+#endif // FRACTIONARRAY_H
@@ -0,0 +1,165 @@
+#include <stdexcept>
+
+#include "fractionbatch.h"
+
+// element-wise binary operation recording the errors into a local context (so the given context, possibly shared, is only updated once)
+template<typename Operation>
+static void applyElementwise(std::span<const Fraction> first, std::span<const Fraction> second, std::span<Fraction> results, FractionContext& context,
+                             Operation operation)
+{
+    if (first.size() != second.size() || first.size() != results.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    FractionContext batchContext;
+
+    for (size_t index{0}; index < first.size(); ++index)
+    {
+        results[index] = operation(batchContext, first[index], second[index]);
+    }
+
+    context.raiseFlags(batchContext.getFlags());
+}
+
+void limitDenominators(std::span<const Fraction> fractions, std::span<Fraction> results, int maxDenominator)
+{
+    if (fractions.size() != results.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    for (size_t index{0}; index < fractions.size(); ++index)
+    {
+        results[index] = fractions[index].limitDenominator(maxDenominator);
+    }
+}
+
+void limitDenominators(std::span<Fraction> fractions, int maxDenominator)
+{
+    limitDenominators(fractions, fractions, maxDenominator);
+}
+
+void quantizeValues(std::span<const double> values, std::span<Fraction> results, double tolerance)
+{
+    if (values.size() != results.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    if (!(tolerance >= 0.0))
+    {
+        throw std::runtime_error{"Error! Invalid tolerance"};
+    }
+
+    for (size_t index{0}; index < values.size(); ++index)
+    {
+        results[index] = Fraction::simplestBetween(values[index] - tolerance, values[index] + tolerance);
+    }
+}
+
+void quantizeFractions(std::span<const Fraction> fractions, std::span<Fraction> results, const Fraction& tolerance)
+{
+    if (fractions.size() != results.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    if (tolerance.getNumerator() < 0)
+    {
+        throw std::runtime_error{"Error! Invalid tolerance"};
+    }
+
+    for (size_t index{0}; index < fractions.size(); ++index)
+    {
+        // the bounds are computed with 64 bit intermediate terms, overflowing bounds throw like the arithmetic operators
+        const std::expected<Fraction, FractionError> cLower{fractions[index].trySubtract(tolerance)};
+        const std::expected<Fraction, FractionError> cUpper{fractions[index].tryAdd(tolerance)};
+
+        if (!cLower || !cUpper)
+        {
+            throw std::overflow_error{"Error! Fraction term out of range"};
+        }
+
+        results[index] = Fraction::simplestBetween(*cLower, *cUpper);
+    }
+}
+
+void quantizeFractions(std::span<Fraction> fractions, const Fraction& tolerance)
+{
+    quantizeFractions(fractions, fractions, tolerance);
+}
+
+void parseFractions(std::span<const std::string> fractionStrings, std::span<Fraction> results, FractionContext& context)
+{
+    if (fractionStrings.size() != results.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    FractionContext batchContext;
+
+    for (size_t index{0}; index < fractionStrings.size(); ++index)
+    {
+        results[index] = batchContext.parse(fractionStrings[index]);
+    }
+
+    context.raiseFlags(batchContext.getFlags());
+}
+
+void parseFractions(std::span<const std::string> fractionStrings, std::span<Fraction> results, FractionScheduler& scheduler, FractionContext& context)
+{
+    if (fractionStrings.size() != results.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    std::vector<FractionContext> workerContexts(scheduler.getThreadsCount());
+
+    scheduler.parallelFor(fractionStrings.size(), [fractionStrings, results, &workerContexts](size_t begin, size_t end, size_t workerIndex)
+    {
+        FractionContext& workerContext{workerContexts[workerIndex]};
+
+        for (size_t index{begin}; index < end; ++index)
+        {
+            results[index] = workerContext.parse(fractionStrings[index]);
+        }
+    });
+
+    for (const FractionContext& workerContext : workerContexts)
+    {
+        context.raiseFlags(workerContext.getFlags());
+    }
+}
+
+void addFractions(std::span<const Fraction> first, std::span<const Fraction> second, std::span<Fraction> results, FractionContext& context)
+{
+    applyElementwise(first, second, results, context, [](FractionContext& batchContext, const Fraction& firstFraction, const Fraction& secondFraction)
+    {
+        return batchContext.add(firstFraction, secondFraction);
+    });
+}
+
+void subtractFractions(std::span<const Fraction> first, std::span<const Fraction> second, std::span<Fraction> results, FractionContext& context)
+{
+    applyElementwise(first, second, results, context, [](FractionContext& batchContext, const Fraction& firstFraction, const Fraction& secondFraction)
+    {
+        return batchContext.subtract(firstFraction, secondFraction);
+    });
+}
+
+void multiplyFractions(std::span<const Fraction> first, std::span<const Fraction> second, std::span<Fraction> results, FractionContext& context)
+{
+    applyElementwise(first, second, results, context, [](FractionContext& batchContext, const Fraction& firstFraction, const Fraction& secondFraction)
+    {
+        return batchContext.multiply(firstFraction, secondFraction);
+    });
+}
+
+void divideFractions(std::span<const Fraction> first, std::span<const Fraction> second, std::span<Fraction> results, FractionContext& context)
+{
+    applyElementwise(first, second, results, context, [](FractionContext& batchContext, const Fraction& firstFraction, const Fraction& secondFraction)
+    {
+        return batchContext.divide(firstFraction, secondFraction);
+    });
+}
@@ -0,0 +1,93 @@
+#ifndef FRACTIONBATCH_H
+#define FRACTIONBATCH_H
+
+#include <span>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "fraction.h"
+#include "fractioncontext.h"
+#include "fractionscheduler.h"
+
+/* Batch operations on contiguous ranges of fractions (input and output spans must have the same size, they may be the same range)
+*/
+
+// replaces each fraction by its best approximation with a denominator not larger than maxDenominator (see Fraction::limitDenominator())
+void limitDenominators(std::span<const Fraction> fractions, std::span<Fraction> results, int maxDenominator);
+void limitDenominators(std::span<Fraction> fractions, int maxDenominator);
+
+// replaces each value by the simplest fraction within the tolerance, i.e. of [value - tolerance, value + tolerance] (see Fraction::simplestBetween())
+void quantizeValues(std::span<const double> values, std::span<Fraction> results, double tolerance);
+void quantizeFractions(std::span<const Fraction> fractions, std::span<Fraction> results, const Fraction& tolerance);
+void quantizeFractions(std::span<Fraction> fractions, const Fraction& tolerance);
+
+/* Element-wise operations that never throw on invalid values: the errors raise the sticky flags of the context (once per batch)
+   and the affected elements get the defined results of the FractionContext operations
+*/
+void parseFractions(std::span<const std::string> fractionStrings, std::span<Fraction> results, FractionContext& context = FractionContext::getThreadContext());
+void addFractions(std::span<const Fraction> first, std::span<const Fraction> second, std::span<Fraction> results,
+                  FractionContext& context = FractionContext::getThreadContext());
+void subtractFractions(std::span<const Fraction> first, std::span<const Fraction> second, std::span<Fraction> results,
+                       FractionContext& context = FractionContext::getThreadContext());
+void multiplyFractions(std::span<const Fraction> first, std::span<const Fraction> second, std::span<Fraction> results,
+                       FractionContext& context = FractionContext::getThreadContext());
+void divideFractions(std::span<const Fraction> first, std::span<const Fraction> second, std::span<Fraction> results,
+                     FractionContext& context = FractionContext::getThreadContext());
+
+/* Parallel batch operations run by a work-stealing scheduler (suited for elements with very different costs)
+*/
+
+// parses the strings in parallel, each worker records the errors into its own context and the flags are merged into the given one
+void parseFractions(std::span<const std::string> fractionStrings, std::span<Fraction> results, FractionScheduler& scheduler,
+                    FractionContext& context = FractionContext::getThreadContext());
+
+// results[i] = function(fractions[i])
+template<typename Function>
+void mapFractions(std::span<const Fraction> fractions, std::span<Fraction> results, Function function,
+                  FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler())
+{
+    if (fractions.size() != results.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    scheduler.parallelFor(fractions.size(), [fractions, results, &function](size_t begin, size_t end, size_t)
+    {
+        for (size_t index{begin}; index < end; ++index)
+        {
+            results[index] = function(fractions[index]);
+        }
+    });
+}
+
+/* Combines all fractions with the operation, which has to be associative and commutative (the elements are combined in no particular order);
+   identity is the neutral element of the operation (e.g. 0 for the addition)
+*/
+template<typename Operation>
+Fraction reduceFractions(std::span<const Fraction> fractions, const Fraction& identity, Operation operation,
+                         FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler())
+{
+    std::vector<Fraction> partialResults(scheduler.getThreadsCount(), identity);
+
+    scheduler.parallelFor(fractions.size(), [fractions, &partialResults, &operation](size_t begin, size_t end, size_t workerIndex)
+    {
+        Fraction& partialResult{partialResults[workerIndex]};
+
+        for (size_t index{begin}; index < end; ++index)
+        {
+            partialResult = operation(partialResult, fractions[index]);
+        }
+    });
+
+    Fraction result{identity};
+
+    for (const Fraction& partialResult : partialResults)
+    {
+        result = operation(result, partialResult);
+    }
+
+    return result;
+}
+
+#endif // FRACTIONBATCH_H
@@ -0,0 +1,612 @@
+#ifndef FRACTIONBTREE_H
+#define FRACTIONBTREE_H
+
+#include <span>
+#include <array>
+#include <limits>
+#include <vector>
+#include <compare>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+#include "fraction.h"
+
+/* Ordered map from unique Fraction keys to values, stored as a B+ tree with wide nodes (an alternative to std::map<Fraction, Value> for range queries)
+   - the nodes are kept in two arrays (leaves and inner nodes) and refer to each other by index; the leaves are linked in key order
+   - each node stores the decimal values of its keys contiguously and the searches run on them (binary search within a node),
+     the keys are compared exactly only when the decimal values are equal (the decimal value never decreases when the fraction increases,
+     so this order is the exact order)
+   - the trees can be bulk loaded from sorted keys, which fills the leaves completely (suited for read-mostly indexes)
+   - Value must be default constructible; inserting invalidates the iterators and the value references
+*/
+template<typename Value>
+class FractionBTree
+{
+public:
+    static constexpr size_t scNodeCapacity{64};     // keys per leaf, separators per inner node
+
+    struct Entry
+    {
+        const Fraction& key;
+        const Value& value;
+    };
+
+    class Iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using reference = Entry;
+
+        Iterator();     // past the end iterator
+
+        Entry operator*() const;
+
+        Iterator& operator++();
+        Iterator operator++(int);
+
+        bool operator==(const Iterator& iterator) const;
+
+    private:
+        friend class FractionBTree;
+
+        Iterator(const FractionBTree* tree, size_t leaf, size_t position);
+
+        const FractionBTree* mTree;
+        size_t mLeaf;
+        size_t mPosition;
+    };
+
+    // constructors
+    FractionBTree();
+
+    // keys must be strictly increasing
+    static FractionBTree fromSorted(std::span<const Fraction> keys, std::span<const Value> values);
+
+    // getters
+    size_t getSize() const;
+    bool isEmpty() const;
+    size_t getHeight() const;       // levels of inner nodes above the leaves
+
+    // inserts the key if missing (the value of an existing key is not changed), true if inserted
+    std::pair<Iterator, bool> insert(const Fraction& key, const Value& value);
+    Value& operator[](const Fraction& key);
+    void clear();
+
+    Iterator begin() const;
+    Iterator end() const;
+
+    Iterator find(const Fraction& key) const;
+    Iterator lowerBound(const Fraction& key) const;     // first key not less than the given key
+    Iterator upperBound(const Fraction& key) const;     // first key greater than the given key
+
+    // calls function(key, value) for the keys within [lower, upper] in increasing order
+    template<typename Function>
+    void forEachInRange(const Fraction& lower, const Fraction& upper, Function function) const;
+
+private:
+    static constexpr size_t scNone{std::numeric_limits<size_t>::max()};
+    static constexpr size_t scMaxHeight{16};
+
+    struct Leaf
+    {
+        std::array<double, scNodeCapacity> searchKeys;
+        std::array<Fraction, scNodeCapacity> keys;
+        std::array<Value, scNodeCapacity> values;
+        size_t count;
+        size_t next;
+    };
+
+    // separator i is the smallest key of the subtree children[i + 1]
+    struct InnerNode
+    {
+        std::array<double, scNodeCapacity> searchKeys;
+        std::array<Fraction, scNodeCapacity> keys;
+        std::array<size_t, scNodeCapacity + 1> children;
+        size_t count;
+    };
+
+    // exact comparison (the products of the int terms fit into long long)
+    static std::strong_ordering compareKeys(const Fraction& first, const Fraction& second);
+
+    // number of the first count keys not greater (upper bound) or less (lower bound) than the key
+    static size_t getUpperBoundPosition(const double* searchKeys, const Fraction* keys, size_t count, double searchKey, const Fraction& key);
+    static size_t getLowerBoundPosition(const double* searchKeys, const Fraction* keys, size_t count, double searchKey, const Fraction& key);
+
+    // leaf which would contain the key, optionally recording the inner nodes and child positions on the way
+    size_t findLeaf(const Fraction& key, std::array<std::pair<size_t, size_t>, scMaxHeight>* path = nullptr) const;
+
+    // the position after the last key of a leaf is the first position of the next leaf
+    Iterator getIterator(size_t leaf, size_t position) const;
+
+    std::pair<std::pair<size_t, size_t>, bool> insertKey(const Fraction& key, const Value& value);
+
+    // adds the separator and the child to the right of it into the inner nodes of the path, splitting the full ones
+    void insertSeparator(const std::array<std::pair<size_t, size_t>, scMaxHeight>& path, const Fraction& key, size_t child);
+
+    // inserts the separator at the position and the child to the right of it (the node must not be full)
+    static void insertIntoInnerNode(InnerNode& innerNode, size_t position, const Fraction& separator, size_t child);
+
+    std::vector<Leaf> mLeaves;
+    std::vector<InnerNode> mInnerNodes;
+    size_t mRoot;
+    size_t mHeight;
+    size_t mSize;
+};
+
+template<typename Value>
+FractionBTree<Value>::Iterator::Iterator()
+    : mTree{nullptr}
+    , mLeaf{scNone}
+    , mPosition{0}
+{
+}
+
+template<typename Value>
+FractionBTree<Value>::Iterator::Iterator(const FractionBTree* tree, size_t leaf, size_t position)
+    : mTree{tree}
+    , mLeaf{leaf}
+    , mPosition{position}
+{
+}
+
+template<typename Value>
+typename FractionBTree<Value>::Entry FractionBTree<Value>::Iterator::operator*() const
+{
+    const Leaf& cLeaf{mTree->mLeaves[mLeaf]};
+
+    return Entry{cLeaf.keys[mPosition], cLeaf.values[mPosition]};
+}
+
+template<typename Value>
+typename FractionBTree<Value>::Iterator& FractionBTree<Value>::Iterator::operator++()
+{
+    if (++mPosition == mTree->mLeaves[mLeaf].count)
+    {
+        mLeaf = mTree->mLeaves[mLeaf].next;
+        mPosition = 0;
+    }
+
+    return *this;
+}
+
+template<typename Value>
+typename FractionBTree<Value>::Iterator FractionBTree<Value>::Iterator::operator++(int)
+{
+    const Iterator cResult{*this};
+    ++*this;
+
+    return cResult;
+}
+
+template<typename Value>
+bool FractionBTree<Value>::Iterator::operator==(const Iterator& iterator) const
+{
+    return mLeaf == iterator.mLeaf && mPosition == iterator.mPosition;
+}
+
+template<typename Value>
+FractionBTree<Value>::FractionBTree()
+    : mLeaves(1)
+    , mRoot{0}
+    , mHeight{0}
+    , mSize{0}
+{
+    mLeaves.front().count = 0;
+    mLeaves.front().next = scNone;
+}
+
+template<typename Value>
+FractionBTree<Value> FractionBTree<Value>::fromSorted(std::span<const Fraction> keys, std::span<const Value> values)
+{
+    if (keys.size() != values.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    for (size_t index{1}; index < keys.size(); ++index)
+    {
+        if (compareKeys(keys[index - 1], keys[index]) >= 0)
+        {
+            throw std::runtime_error{"Error! Keys not sorted"};
+        }
+    }
+
+    FractionBTree result;
+
+    if (keys.empty())
+    {
+        return result;
+    }
+
+    // full leaves, then the levels of inner nodes with the smallest key of each node of the level below
+    const size_t cLeavesCount{(keys.size() + scNodeCapacity - 1) / scNodeCapacity};
+    std::vector<size_t> levelNodes(cLeavesCount);
+    std::vector<Fraction> levelFirstKeys(cLeavesCount);
+
+    result.mLeaves.resize(cLeavesCount);
+
+    for (size_t leafIndex{0}; leafIndex < cLeavesCount; ++leafIndex)
+    {
+        Leaf& leaf{result.mLeaves[leafIndex]};
+        const size_t cBegin{leafIndex * scNodeCapacity};
+
+        leaf.count = std::min(scNodeCapacity, keys.size() - cBegin);
+        leaf.next = leafIndex + 1 < cLeavesCount ? leafIndex + 1 : scNone;
+
+        for (size_t position{0}; position < leaf.count; ++position)
+        {
+            leaf.searchKeys[position] = keys[cBegin + position].getDecimalValue();
+            leaf.keys[position] = keys[cBegin + position];
+            leaf.values[position] = values[cBegin + position];
+        }
+
+        levelNodes[leafIndex] = leafIndex;
+        levelFirstKeys[leafIndex] = leaf.keys[0];
+    }
+
+    while (levelNodes.size() > 1)
+    {
+        const size_t cNodesCount{(levelNodes.size() + scNodeCapacity) / (scNodeCapacity + 1)};
+        std::vector<size_t> parentNodes(cNodesCount);
+        std::vector<Fraction> parentFirstKeys(cNodesCount);
+
+        for (size_t nodeIndex{0}; nodeIndex < cNodesCount; ++nodeIndex)
+        {
+            const size_t cBegin{nodeIndex * (scNodeCapacity + 1)};
+            const size_t cChildrenCount{std::min(scNodeCapacity + 1, levelNodes.size() - cBegin)};
+            InnerNode node;
+
+            node.count = cChildrenCount - 1;
+
+            for (size_t child{0}; child < cChildrenCount; ++child)
+            {
+                node.children[child] = levelNodes[cBegin + child];
+
+                if (child > 0)
+                {
+                    node.searchKeys[child - 1] = levelFirstKeys[cBegin + child].getDecimalValue();
+                    node.keys[child - 1] = levelFirstKeys[cBegin + child];
+                }
+            }
+
+            parentNodes[nodeIndex] = result.mInnerNodes.size();
+            parentFirstKeys[nodeIndex] = levelFirstKeys[cBegin];
+            result.mInnerNodes.push_back(node);
+        }
+
+        levelNodes = std::move(parentNodes);
+        levelFirstKeys = std::move(parentFirstKeys);
+        ++result.mHeight;
+    }
+
+    result.mRoot = levelNodes.front();
+    result.mSize = keys.size();
+
+    return result;
+}
+
+template<typename Value>
+size_t FractionBTree<Value>::getSize() const
+{
+    return mSize;
+}
+
+template<typename Value>
+bool FractionBTree<Value>::isEmpty() const
+{
+    return 0 == mSize;
+}
+
+template<typename Value>
+size_t FractionBTree<Value>::getHeight() const
+{
+    return mHeight;
+}
+
+template<typename Value>
+std::pair<typename FractionBTree<Value>::Iterator, bool> FractionBTree<Value>::insert(const Fraction& key, const Value& value)
+{
+    const auto [cPosition, cIsInserted]{insertKey(key, value)};
+
+    return {Iterator{this, cPosition.first, cPosition.second}, cIsInserted};
+}
+
+template<typename Value>
+Value& FractionBTree<Value>::operator[](const Fraction& key)
+{
+    const auto [cPosition, cIsInserted]{insertKey(key, Value{})};
+
+    return mLeaves[cPosition.first].values[cPosition.second];
+}
+
+template<typename Value>
+void FractionBTree<Value>::clear()
+{
+    *this = FractionBTree{};
+}
+
+template<typename Value>
+typename FractionBTree<Value>::Iterator FractionBTree<Value>::begin() const
+{
+    // the leftmost leaf is always the first one (the splits append the right halves)
+    return getIterator(0, 0);
+}
+
+template<typename Value>
+typename FractionBTree<Value>::Iterator FractionBTree<Value>::end() const
+{
+    return Iterator{this, scNone, 0};
+}
+
+template<typename Value>
+typename FractionBTree<Value>::Iterator FractionBTree<Value>::find(const Fraction& key) const
+{
+    const Iterator cIterator{lowerBound(key)};
+
+    return end() != cIterator && compareKeys((*cIterator).key, key) == 0 ? cIterator : end();
+}
+
+template<typename Value>
+typename FractionBTree<Value>::Iterator FractionBTree<Value>::lowerBound(const Fraction& key) const
+{
+    const size_t cLeafIndex{findLeaf(key)};
+    const Leaf& cLeaf{mLeaves[cLeafIndex]};
+
+    return getIterator(cLeafIndex, getLowerBoundPosition(cLeaf.searchKeys.data(), cLeaf.keys.data(), cLeaf.count, key.getDecimalValue(), key));
+}
+
+template<typename Value>
+typename FractionBTree<Value>::Iterator FractionBTree<Value>::upperBound(const Fraction& key) const
+{
+    const size_t cLeafIndex{findLeaf(key)};
+    const Leaf& cLeaf{mLeaves[cLeafIndex]};
+
+    return getIterator(cLeafIndex, getUpperBoundPosition(cLeaf.searchKeys.data(), cLeaf.keys.data(), cLeaf.count, key.getDecimalValue(), key));
+}
+
+template<typename Value>
+template<typename Function>
+void FractionBTree<Value>::forEachInRange(const Fraction& lower, const Fraction& upper, Function function) const
+{
+    const double cUpperSearchKey{upper.getDecimalValue()};
+    size_t leafIndex{findLeaf(lower)};
+    const Leaf* leaf{&mLeaves[leafIndex]};
+    size_t position{getLowerBoundPosition(leaf->searchKeys.data(), leaf->keys.data(), leaf->count, lower.getDecimalValue(), lower)};
+
+    // the leaves are scanned directly, the exact comparison is needed only for the keys with the decimal value of the upper bound
+    while (true)
+    {
+        for (; position < leaf->count; ++position)
+        {
+            if (leaf->searchKeys[position] > cUpperSearchKey ||
+                (leaf->searchKeys[position] == cUpperSearchKey && compareKeys(leaf->keys[position], upper) > 0))
+            {
+                return;
+            }
+
+            function(leaf->keys[position], leaf->values[position]);
+        }
+
+        leafIndex = leaf->next;
+
+        if (scNone == leafIndex)
+        {
+            return;
+        }
+
+        leaf = &mLeaves[leafIndex];
+        position = 0;
+    }
+}
+
+template<typename Value>
+std::strong_ordering FractionBTree<Value>::compareKeys(const Fraction& first, const Fraction& second)
+{
+    return static_cast<long long>(first.getNumerator()) * second.getDenominator() <=> static_cast<long long>(second.getNumerator()) * first.getDenominator();
+}
+
+template<typename Value>
+size_t FractionBTree<Value>::getUpperBoundPosition(const double* searchKeys, const Fraction* keys, size_t count, double searchKey, const Fraction& key)
+{
+    size_t position{static_cast<size_t>(std::upper_bound(searchKeys, searchKeys + count, searchKey) - searchKeys)};
+
+    // the keys with the same decimal value are ordered exactly
+    while (position > 0 && searchKeys[position - 1] == searchKey && compareKeys(keys[position - 1], key) > 0)
+    {
+        --position;
+    }
+
+    return position;
+}
+
+template<typename Value>
+size_t FractionBTree<Value>::getLowerBoundPosition(const double* searchKeys, const Fraction* keys, size_t count, double searchKey, const Fraction& key)
+{
+    size_t position{static_cast<size_t>(std::lower_bound(searchKeys, searchKeys + count, searchKey) - searchKeys)};
+
+    while (position < count && searchKeys[position] == searchKey && compareKeys(keys[position], key) < 0)
+    {
+        ++position;
+    }
+
+    return position;
+}
+
+template<typename Value>
+size_t FractionBTree<Value>::findLeaf(const Fraction& key, std::array<std::pair<size_t, size_t>, scMaxHeight>* path) const
+{
+    const double cSearchKey{key.getDecimalValue()};
+    size_t node{mRoot};
+
+    for (size_t level{0}; level < mHeight; ++level)
+    {
+        const InnerNode& cInnerNode{mInnerNodes[node]};
+        const size_t cChild{getUpperBoundPosition(cInnerNode.searchKeys.data(), cInnerNode.keys.data(), cInnerNode.count, cSearchKey, key)};
+
+        if (path)
+        {
+            (*path)[level] = {node, cChild};
+        }
+
+        node = cInnerNode.children[cChild];
+    }
+
+    return node;
+}
+
+template<typename Value>
+typename FractionBTree<Value>::Iterator FractionBTree<Value>::getIterator(size_t leaf, size_t position) const
+{
+    if (position == mLeaves[leaf].count)
+    {
+        leaf = mLeaves[leaf].next;
+        position = 0;
+    }
+
+    return Iterator{this, leaf, position};
+}
+
+template<typename Value>
+std::pair<std::pair<size_t, size_t>, bool> FractionBTree<Value>::insertKey(const Fraction& key, const Value& value)
+{
+    std::array<std::pair<size_t, size_t>, scMaxHeight> path;
+    const double cSearchKey{key.getDecimalValue()};
+    size_t leafIndex{findLeaf(key, &path)};
+    size_t position{getLowerBoundPosition(mLeaves[leafIndex].searchKeys.data(), mLeaves[leafIndex].keys.data(), mLeaves[leafIndex].count, cSearchKey, key)};
+
+    if (position < mLeaves[leafIndex].count && compareKeys(mLeaves[leafIndex].keys[position], key) == 0)
+    {
+        return {{leafIndex, position}, false};
+    }
+
+    if (scNodeCapacity == mLeaves[leafIndex].count)
+    {
+        if (scMaxHeight == mHeight)
+        {
+            throw std::runtime_error{"Error! Tree too high"};
+        }
+
+        // the upper half moves to a new leaf, linked after the split one
+        const size_t cNewLeafIndex{mLeaves.size()};
+        const size_t cHalf{scNodeCapacity / 2};
+
+        mLeaves.emplace_back();
+
+        Leaf& leaf{mLeaves[leafIndex]};
+        Leaf& newLeaf{mLeaves[cNewLeafIndex]};
+
+        std::copy(leaf.searchKeys.begin() + cHalf, leaf.searchKeys.end(), newLeaf.searchKeys.begin());
+        std::copy(leaf.keys.begin() + cHalf, leaf.keys.end(), newLeaf.keys.begin());
+        std::move(leaf.values.begin() + cHalf, leaf.values.end(), newLeaf.values.begin());
+
+        newLeaf.count = scNodeCapacity - cHalf;
+        newLeaf.next = leaf.next;
+        leaf.count = cHalf;
+        leaf.next = cNewLeafIndex;
+
+        insertSeparator(path, newLeaf.keys[0], cNewLeafIndex);
+
+        // a key between the halves goes to the end of the split leaf, so the new leaf still starts with the separator
+        if (position > cHalf)
+        {
+            leafIndex = cNewLeafIndex;
+            position -= cHalf;
+        }
+    }
+
+    Leaf& leaf{mLeaves[leafIndex]};
+
+    std::copy_backward(leaf.searchKeys.begin() + position, leaf.searchKeys.begin() + leaf.count, leaf.searchKeys.begin() + leaf.count + 1);
+    std::copy_backward(leaf.keys.begin() + position, leaf.keys.begin() + leaf.count, leaf.keys.begin() + leaf.count + 1);
+    std::move_backward(leaf.values.begin() + position, leaf.values.begin() + leaf.count, leaf.values.begin() + leaf.count + 1);
+
+    leaf.searchKeys[position] = cSearchKey;
+    leaf.keys[position] = key;
+    leaf.values[position] = value;
+    ++leaf.count;
+    ++mSize;
+
+    return {{leafIndex, position}, true};
+}
+
+template<typename Value>
+void FractionBTree<Value>::insertSeparator(const std::array<std::pair<size_t, size_t>, scMaxHeight>& path, const Fraction& key, size_t child)
+{
+    Fraction separator{key};
+    size_t newChild{child};
+
+    for (size_t level{mHeight}; level-- > 0; )
+    {
+        size_t node{path[level].first};
+        size_t position{path[level].second};
+
+        if (scNodeCapacity == mInnerNodes[node].count)
+        {
+            // the middle separator moves up, the children to the right of it move to a new node
+            const size_t cNewNode{mInnerNodes.size()};
+            const size_t cMiddle{scNodeCapacity / 2};
+
+            mInnerNodes.emplace_back();
+
+            InnerNode& innerNode{mInnerNodes[node]};
+            InnerNode& newInnerNode{mInnerNodes[cNewNode]};
+            const Fraction cMiddleSeparator{innerNode.keys[cMiddle]};
+
+            std::copy(innerNode.searchKeys.begin() + cMiddle + 1, innerNode.searchKeys.end(), newInnerNode.searchKeys.begin());
+            std::copy(innerNode.keys.begin() + cMiddle + 1, innerNode.keys.end(), newInnerNode.keys.begin());
+            std::copy(innerNode.children.begin() + cMiddle + 1, innerNode.children.end(), newInnerNode.children.begin());
+
+            newInnerNode.count = scNodeCapacity - cMiddle - 1;
+            innerNode.count = cMiddle;
+
+            if (position > cMiddle)
+            {
+                node = cNewNode;
+                position -= cMiddle + 1;
+            }
+
+            // the separator goes into the half which contains the split child
+            insertIntoInnerNode(mInnerNodes[node], position, separator, newChild);
+
+            separator = cMiddleSeparator;
+            newChild = cNewNode;
+            continue;
+        }
+
+        insertIntoInnerNode(mInnerNodes[node], position, separator, newChild);
+
+        return;
+    }
+
+    // the root was split: new root with the two halves
+    InnerNode root;
+
+    root.children[0] = mRoot;
+    root.count = 0;
+    insertIntoInnerNode(root, 0, separator, newChild);
+
+    mRoot = mInnerNodes.size();
+    mInnerNodes.push_back(root);
+    ++mHeight;
+}
+
+template<typename Value>
+void FractionBTree<Value>::insertIntoInnerNode(InnerNode& innerNode, size_t position, const Fraction& separator, size_t child)
+{
+    std::copy_backward(innerNode.searchKeys.begin() + position, innerNode.searchKeys.begin() + innerNode.count, innerNode.searchKeys.begin() + innerNode.count + 1);
+    std::copy_backward(innerNode.keys.begin() + position, innerNode.keys.begin() + innerNode.count, innerNode.keys.begin() + innerNode.count + 1);
+    std::copy_backward(innerNode.children.begin() + position + 1, innerNode.children.begin() + innerNode.count + 1, innerNode.children.begin() + innerNode.count + 2);
+
+    innerNode.searchKeys[position] = separator.getDecimalValue();
+    innerNode.keys[position] = separator;
+    innerNode.children[position + 1] = child;
+    ++innerNode.count;
+}
+
+#endif // FRACTIONBTREE_H
@@ -0,0 +1,265 @@
+#include <vector>
+#include <string_view>
+#include <cstring>
+#include <charconv>
+#include <expected>
+#include <algorithm>
+
+#include "fraction.h"
+#include "fractioncapi.h"
+
+static constexpr FractionLibValue scFailedValue{0, 1};
+
+static int32_t toStatus(FractionError error)
+{
+    int32_t status{FRACTIONLIB_STATUS_INVALID_FORMAT};
+
+    switch (error)
+    {
+    case FractionError::DIVISION_BY_ZERO:
+        status = FRACTIONLIB_STATUS_DIVISION_BY_ZERO;
+        break;
+    case FractionError::ARITHMETIC_OVERFLOW:
+        status = FRACTIONLIB_STATUS_ARITHMETIC_OVERFLOW;
+        break;
+    default:
+        break;
+    }
+
+    return status;
+}
+
+// fills the statuses when a required array is missing, returns the number of failed elements
+static size_t reportNullPointer(size_t count, int32_t* statuses)
+{
+    if (nullptr != statuses)
+    {
+        std::fill(statuses, statuses + count, FRACTIONLIB_STATUS_NULL_POINTER);
+    }
+
+    return count;
+}
+
+// writes the element result and its status, returns 1 for a failed element
+static size_t storeResult(const std::expected<Fraction, FractionError>& result, FractionLibValue& value, int32_t* statuses, size_t index)
+{
+    value = result ? FractionLibValue{result->getNumerator(), result->getDenominator()} : scFailedValue;
+
+    if (nullptr != statuses)
+    {
+        statuses[index] = result ? FRACTIONLIB_STATUS_OK : toStatus(result.error());
+    }
+
+    return result ? 0 : 1;
+}
+
+static std::expected<Fraction, FractionError> toFraction(const FractionLibValue& value)
+{
+    return Fraction::tryMake(value.numerator, value.denominator);
+}
+
+template<typename Operation>
+static size_t applyOperation(const FractionLibValue* first, const FractionLibValue* second, size_t count, FractionLibValue* results, int32_t* statuses,
+                             const Operation& operation)
+{
+    if (nullptr == first || nullptr == second || nullptr == results)
+    {
+        return 0 == count ? 0 : reportNullPointer(count, statuses);
+    }
+
+    size_t failedCount{0};
+
+    for (size_t index{0}; index < count; ++index)
+    {
+        const std::expected<Fraction, FractionError> cFirst{toFraction(first[index])};
+        const std::expected<Fraction, FractionError> cSecond{toFraction(second[index])};
+
+        failedCount += storeResult(!cFirst ? cFirst : !cSecond ? cSecond : operation(*cFirst, *cSecond), results[index], statuses, index);
+    }
+
+    return failedCount;
+}
+
+// exact order of normalized fractions (the products of 32 bit terms fit into 64 bits)
+static int compareNormalized(const Fraction& first, const Fraction& second)
+{
+    const long long cFirstProduct{static_cast<long long>(first.getNumerator()) * second.getDenominator()};
+    const long long cSecondProduct{static_cast<long long>(second.getNumerator()) * first.getDenominator()};
+
+    return cFirstProduct < cSecondProduct ? -1 : cFirstProduct > cSecondProduct ? 1 : 0;
+}
+
+int32_t fractionlib_get_api_version(void)
+{
+    return FRACTIONLIB_C_API_VERSION;
+}
+
+size_t fractionlib_parse_batch(const char* const* strings, const size_t* lengths, size_t count, FractionLibValue* results, int32_t* statuses)
+{
+    if (nullptr == strings || nullptr == results)
+    {
+        return 0 == count ? 0 : reportNullPointer(count, statuses);
+    }
+
+    size_t failedCount{0};
+
+    for (size_t index{0}; index < count; ++index)
+    {
+        if (nullptr == strings[index])
+        {
+            results[index] = scFailedValue;
+            failedCount += reportNullPointer(1, nullptr == statuses ? nullptr : statuses + index);
+            continue;
+        }
+
+        // the strings are parsed in place (no copy)
+        const std::string_view cFractionString{strings[index], nullptr == lengths ? std::strlen(strings[index]) : lengths[index]};
+        failedCount += storeResult(Fraction::tryParse(cFractionString), results[index], statuses, index);
+    }
+
+    return failedCount;
+}
+
+size_t fractionlib_normalize_batch(const FractionLibValue* values, size_t count, FractionLibValue* results, int32_t* statuses)
+{
+    if (nullptr == values || nullptr == results)
+    {
+        return 0 == count ? 0 : reportNullPointer(count, statuses);
+    }
+
+    size_t failedCount{0};
+
+    for (size_t index{0}; index < count; ++index)
+    {
+        failedCount += storeResult(toFraction(values[index]), results[index], statuses, index);
+    }
+
+    return failedCount;
+}
+
+size_t fractionlib_add_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count, FractionLibValue* results, int32_t* statuses)
+{
+    return applyOperation(first, second, count, results, statuses, [](const Fraction& firstValue, const Fraction& secondValue) {return firstValue.tryAdd(secondValue);});
+}
+
+size_t fractionlib_subtract_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count, FractionLibValue* results, int32_t* statuses)
+{
+    return applyOperation(first, second, count, results, statuses, [](const Fraction& firstValue, const Fraction& secondValue) {return firstValue.trySubtract(secondValue);});
+}
+
+size_t fractionlib_multiply_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count, FractionLibValue* results, int32_t* statuses)
+{
+    return applyOperation(first, second, count, results, statuses, [](const Fraction& firstValue, const Fraction& secondValue) {return firstValue.tryMultiply(secondValue);});
+}
+
+size_t fractionlib_divide_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count, FractionLibValue* results, int32_t* statuses)
+{
+    return applyOperation(first, second, count, results, statuses, [](const Fraction& firstValue, const Fraction& secondValue) {return firstValue.tryDivide(secondValue);});
+}
+
+size_t fractionlib_compare_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count, int32_t* results, int32_t* statuses)
+{
+    if (nullptr == first || nullptr == second || nullptr == results)
+    {
+        return 0 == count ? 0 : reportNullPointer(count, statuses);
+    }
+
+    size_t failedCount{0};
+
+    for (size_t index{0}; index < count; ++index)
+    {
+        const std::expected<Fraction, FractionError> cFirst{toFraction(first[index])};
+        const std::expected<Fraction, FractionError> cSecond{toFraction(second[index])};
+        const bool cIsValid{cFirst && cSecond};
+
+        results[index] = cIsValid ? compareNormalized(*cFirst, *cSecond) : 0;
+
+        if (nullptr != statuses)
+        {
+            statuses[index] = cIsValid ? FRACTIONLIB_STATUS_OK : toStatus(!cFirst ? cFirst.error() : cSecond.error());
+        }
+
+        failedCount += cIsValid ? 0 : 1;
+    }
+
+    return failedCount;
+}
+
+size_t fractionlib_sort(FractionLibValue* values, size_t count, int32_t* statuses)
+{
+    if (nullptr == values)
+    {
+        return 0 == count ? 0 : reportNullPointer(count, statuses);
+    }
+
+    std::vector<Fraction> validValues;
+    std::vector<int32_t> failedStatuses;
+
+    validValues.reserve(count);
+
+    for (size_t index{0}; index < count; ++index)
+    {
+        const std::expected<Fraction, FractionError> cValue{toFraction(values[index])};
+
+        if (cValue)
+        {
+            validValues.push_back(*cValue);
+        }
+        else
+        {
+            failedStatuses.push_back(toStatus(cValue.error()));
+        }
+    }
+
+    std::sort(validValues.begin(), validValues.end(), [](const Fraction& first, const Fraction& second) {return compareNormalized(first, second) < 0;});
+
+    for (size_t index{0}; index < count; ++index)
+    {
+        const bool cIsValid{index < validValues.size()};
+
+        values[index] = cIsValid ? FractionLibValue{validValues[index].getNumerator(), validValues[index].getDenominator()} : scFailedValue;
+
+        if (nullptr != statuses)
+        {
+            statuses[index] = cIsValid ? FRACTIONLIB_STATUS_OK : failedStatuses[index - validValues.size()];
+        }
+    }
+
+    return failedStatuses.size();
+}
+
+size_t fractionlib_format_batch(const FractionLibValue* values, size_t count, char* buffer, int32_t* statuses)
+{
+    if (nullptr == values || nullptr == buffer)
+    {
+        return 0 == count ? 0 : reportNullPointer(count, statuses);
+    }
+
+    size_t failedCount{0};
+
+    for (size_t index{0}; index < count; ++index)
+    {
+        const std::expected<Fraction, FractionError> cValue{toFraction(values[index])};
+        char* const cSlot{buffer + index * FRACTIONLIB_FORMAT_SLOT_SIZE};
+        char* slotEnd{cSlot};
+
+        if (cValue)
+        {
+            // the slot is large enough for any pair of 32 bit terms
+            slotEnd = std::to_chars(slotEnd, cSlot + FRACTIONLIB_FORMAT_SLOT_SIZE, cValue->getNumerator()).ptr;
+            *slotEnd++ = '/';
+            slotEnd = std::to_chars(slotEnd, cSlot + FRACTIONLIB_FORMAT_SLOT_SIZE, cValue->getDenominator()).ptr;
+        }
+
+        *slotEnd = '\0';
+
+        if (nullptr != statuses)
+        {
+            statuses[index] = cValue ? FRACTIONLIB_STATUS_OK : toStatus(cValue.error());
+        }
+
+        failedCount += cValue ? 0 : 1;
+    }
+
+    return failedCount;
+}
@@ -0,0 +1,79 @@
+#ifndef FRACTIONCAPI_H
+#define FRACTIONCAPI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fractionlib_global.h"
+
+/* Stable C interface for foreign function callers (Python ctypes/cffi, Go cgo, ...)
+   - the values are plain structs, the batch functions work on caller-owned arrays so that the FFI boundary is crossed once per batch
+   - no function throws: the result of each element is written into a status array (which may be NULL when the statuses are not needed)
+     and the functions return the number of elements whose status is not FRACTIONLIB_STATUS_OK
+   - the input values need not be normalized, the results always are (coprime terms, positive denominator); a failed element gets 0/1
+   - the input and output arrays of the element-wise functions may be the same array
+   - new functions may be added, the existing signatures and struct layouts are never changed (see fractionlib_get_api_version())
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FRACTIONLIB_C_API_VERSION 1
+
+// bytes of a format slot: the longest fraction ("-2147483648/2147483647") and the terminating null character
+#define FRACTIONLIB_FORMAT_SLOT_SIZE 24
+
+typedef struct FractionLibValue
+{
+    int32_t numerator;
+    int32_t denominator;
+} FractionLibValue;
+
+// element statuses (int32_t in the arrays to keep their size independent of the compiler)
+enum
+{
+    FRACTIONLIB_STATUS_OK = 0,
+    FRACTIONLIB_STATUS_INVALID_FORMAT = 1,
+    FRACTIONLIB_STATUS_DIVISION_BY_ZERO = 2,
+    FRACTIONLIB_STATUS_ARITHMETIC_OVERFLOW = 3,     // the reduced result does not fit into 32 bit terms
+    FRACTIONLIB_STATUS_NULL_POINTER = 4             // a required array or string is NULL
+};
+
+FRACTIONLIBSHARED_EXPORT int32_t fractionlib_get_api_version(void);
+
+// parses strings in any of the formats accepted by the library (fraction, decimal or integer); lengths may be NULL for null terminated strings
+FRACTIONLIBSHARED_EXPORT size_t fractionlib_parse_batch(const char* const* strings, const size_t* lengths, size_t count,
+                                                         FractionLibValue* results, int32_t* statuses);
+
+FRACTIONLIBSHARED_EXPORT size_t fractionlib_normalize_batch(const FractionLibValue* values, size_t count, FractionLibValue* results, int32_t* statuses);
+
+// results[i] = first[i] op second[i]
+FRACTIONLIBSHARED_EXPORT size_t fractionlib_add_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count,
+                                                       FractionLibValue* results, int32_t* statuses);
+FRACTIONLIBSHARED_EXPORT size_t fractionlib_subtract_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count,
+                                                            FractionLibValue* results, int32_t* statuses);
+FRACTIONLIBSHARED_EXPORT size_t fractionlib_multiply_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count,
+                                                            FractionLibValue* results, int32_t* statuses);
+FRACTIONLIBSHARED_EXPORT size_t fractionlib_divide_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count,
+                                                          FractionLibValue* results, int32_t* statuses);
+
+// results[i] = -1, 0 or 1 as first[i] is smaller than, equal to or larger than second[i] (exact, the results of failed elements are 0)
+FRACTIONLIBSHARED_EXPORT size_t fractionlib_compare_batch(const FractionLibValue* first, const FractionLibValue* second, size_t count,
+                                                           int32_t* results, int32_t* statuses);
+
+/* Sorts the values in place in ascending order (exact comparisons, the values are normalized)
+   - the values with a zero denominator are moved after the valid ones, the statuses are given for the sorted positions
+*/
+FRACTIONLIBSHARED_EXPORT size_t fractionlib_sort(FractionLibValue* values, size_t count, int32_t* statuses);
+
+/* Writes the normalized values as "numerator/denominator" (null terminated) into the slots buffer + i * FRACTIONLIB_FORMAT_SLOT_SIZE
+   - the buffer must hold count slots, the slots of the failed elements get an empty string
+*/
+FRACTIONLIBSHARED_EXPORT size_t fractionlib_format_batch(const FractionLibValue* values, size_t count, char* buffer, int32_t* statuses);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FRACTIONCAPI_H
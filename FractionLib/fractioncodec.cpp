@@ -0,0 +1,696 @@
+#include <bit>
+#include <limits>
+#include <numeric>
+#include <cstring>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FRACTIONCODEC_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "fractioncodec.h"
+
+static constexpr std::string_view scMagic{"FRCZ"};
+static constexpr std::uint8_t scFormatVersion{1};
+static constexpr size_t scBlockSizeBytesCount{4};
+static constexpr size_t scMaxDictionarySize{256};
+static constexpr size_t scMaxVarintLength{10};
+static constexpr size_t scMaskBytesCount{16};              // bytes classified at once by the varint decoder
+
+// the payload size has to fit into its 4 bytes: a block header takes at most the fractions count, the coding modes byte and a full dictionary,
+// a fraction less than two full length varints (a numerator of at most 5 bytes, then a denominator, an index or a run of at most 9 bytes)
+static constexpr size_t scMaxBlockHeaderBytesCount{1 + scMaxVarintLength * (2 + scMaxDictionarySize)};
+static constexpr size_t scMaxBlockSize{(std::numeric_limits<std::uint32_t>::max() - scMaxBlockHeaderBytesCount) / (2 * scMaxVarintLength)};
+static constexpr long long scMinNumeratorDelta{static_cast<long long>(std::numeric_limits<int>::min()) - std::numeric_limits<int>::max()};
+static constexpr long long scMaxNumeratorDelta{-scMinNumeratorDelta};
+static constexpr std::uint8_t scContinuationBit{0x80};
+static constexpr std::uint8_t scPayloadBits{0x7F};
+
+// coding modes byte: numerator mode in the low 2 bits, denominator mode in the next 2 bits
+enum class NumeratorMode : std::uint8_t
+{
+    VALUES = 0,
+    DELTAS
+};
+
+enum class DenominatorMode : std::uint8_t
+{
+    VALUES = 0,
+    RUNS,
+    DICTIONARY
+};
+
+static std::uint64_t encodeZigzag(long long value)
+{
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+static long long decodeZigzag(std::uint64_t value)
+{
+    return static_cast<long long>(value >> 1) ^ -static_cast<long long>(value & 1u);
+}
+
+static size_t getVarintLength(std::uint64_t value)
+{
+    return 1 + (std::bit_width(value | 1u) - 1) / 7;
+}
+
+static void appendVarint(std::string& bytes, std::uint64_t value)
+{
+    while (value >= scContinuationBit)
+    {
+        bytes.push_back(static_cast<char>(static_cast<std::uint8_t>(value) | scContinuationBit));
+        value >>= 7;
+    }
+
+    bytes.push_back(static_cast<char>(value));
+}
+
+[[noreturn]] static void throwInvalidStream()
+{
+    throw std::runtime_error{"Error! Invalid compressed fraction stream"};
+}
+
+// the continuation (high) bits of 16 bytes, bit i for byte i
+static std::uint32_t getContinuationMask(const std::uint8_t* bytes)
+{
+#ifdef FRACTIONCODEC_SSE2
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes))));
+#else
+    std::uint32_t mask{0};
+
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        // the high bits of a word are gathered into its top byte by the multiplication (SWAR movemask)
+        for (size_t wordIndex{0}; wordIndex < 2; ++wordIndex)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + wordIndex * sizeof(word), sizeof(word));
+
+            mask |= static_cast<std::uint32_t>((word & 0x8080808080808080ull) * 0x0002040810204081ull >> 56) << (wordIndex * 8);
+        }
+    }
+    else
+    {
+        for (size_t byteIndex{0}; byteIndex < scMaskBytesCount; ++byteIndex)
+        {
+            mask |= static_cast<std::uint32_t>(bytes[byteIndex] >> 7) << byteIndex;
+        }
+    }
+
+    return mask;
+#endif
+}
+
+/* Decodes values.size() varints, returns the position after the last one
+   - while 16 bytes are available the end bytes of the varints are found from the continuation mask, 16 one byte values being copied directly
+   - the remaining bytes are decoded one by one; throws on truncated or too long varints
+*/
+static const std::uint8_t* decodeVarints(const std::uint8_t* position, const std::uint8_t* end, std::span<std::uint64_t> values)
+{
+    size_t index{0};
+
+    while (values.size() - index >= scMaskBytesCount && static_cast<size_t>(end - position) >= scMaskBytesCount)
+    {
+        const std::uint32_t cContinuationMask{getContinuationMask(position)};
+
+        if (0u == cContinuationMask)
+        {
+            for (size_t byteIndex{0}; byteIndex < scMaskBytesCount; ++byteIndex)
+            {
+                values[index + byteIndex] = position[byteIndex];
+            }
+
+            index += scMaskBytesCount;
+            position += scMaskBytesCount;
+            continue;
+        }
+
+        std::uint32_t endMask{~cContinuationMask & 0xFFFFu};
+
+        if (0u == endMask)
+        {
+            break;
+        }
+
+        size_t begin{0};
+
+        for (; 0u != endMask; endMask &= endMask - 1)
+        {
+            const size_t cEnd{static_cast<size_t>(std::countr_zero(endMask))};
+
+            if (cEnd - begin >= scMaxVarintLength)
+            {
+                throwInvalidStream();
+            }
+
+            std::uint64_t value{0};
+
+            for (size_t byteIndex{cEnd + 1}; byteIndex > begin; --byteIndex)
+            {
+                value = value << 7 | (position[byteIndex - 1] & scPayloadBits);
+            }
+
+            values[index++] = value;
+            begin = cEnd + 1;
+        }
+
+        position += begin;
+    }
+
+    for (; index < values.size(); ++index)
+    {
+        std::uint64_t value{0};
+        size_t length{0};
+        std::uint8_t byte{scContinuationBit};
+
+        while (0u != (byte & scContinuationBit))
+        {
+            if (position == end || length == scMaxVarintLength)
+            {
+                throwInvalidStream();
+            }
+
+            byte = *position++;
+            value |= static_cast<std::uint64_t>(byte & scPayloadBits) << (7 * length);
+            ++length;
+        }
+
+        values[index] = value;
+    }
+
+    return position;
+}
+
+static const std::uint8_t* decodeVarint(const std::uint8_t* position, const std::uint8_t* end, std::uint64_t& value)
+{
+    return decodeVarints(position, end, std::span<std::uint64_t>{&value, 1});
+}
+
+static int toDenominator(std::uint64_t value)
+{
+    if (0u == value || value > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+    {
+        throwInvalidStream();
+    }
+
+    return static_cast<int>(value);
+}
+
+// smallest coding of the block denominators (the runs and the distinct values are counted once)
+static DenominatorMode chooseDenominatorMode(std::span<const Fraction> fractions, std::unordered_map<int, std::uint8_t>& dictionary)
+{
+    size_t valuesSize{0};
+    size_t runsSize{0};
+    size_t runsCount{0};
+    size_t dictionarySize{0};
+    size_t runLength{0};
+
+    dictionary.clear();
+
+    for (size_t index{0}; index < fractions.size(); ++index)
+    {
+        const int cDenominator{fractions[index].getDenominator()};
+        const size_t cLength{getVarintLength(static_cast<std::uint64_t>(cDenominator))};
+
+        valuesSize += cLength;
+        ++runLength;
+
+        if (index + 1 == fractions.size() || fractions[index + 1].getDenominator() != cDenominator)
+        {
+            runsSize += getVarintLength(runLength) + cLength;
+            runLength = 0;
+            ++runsCount;
+        }
+
+        if (dictionary.size() <= scMaxDictionarySize && dictionary.try_emplace(cDenominator, static_cast<std::uint8_t>(dictionary.size())).second)
+        {
+            dictionarySize += cLength;
+        }
+    }
+
+    const bool cIsDictionaryUsable{dictionary.size() <= scMaxDictionarySize};
+    runsSize += getVarintLength(runsCount);
+    dictionarySize += getVarintLength(dictionary.size()) + fractions.size();
+
+    DenominatorMode mode{DenominatorMode::VALUES};
+
+    if (runsSize < valuesSize && (!cIsDictionaryUsable || runsSize < dictionarySize))
+    {
+        mode = DenominatorMode::RUNS;
+    }
+    else if (cIsDictionaryUsable && dictionarySize < valuesSize)
+    {
+        mode = DenominatorMode::DICTIONARY;
+    }
+
+    return mode;
+}
+
+FractionEncoder::FractionEncoder(std::ostream& outputStream, size_t blockSize)
+    : mOutputStream{outputStream}
+    , mBlockSize{blockSize}
+    , mFractionsCount{0}
+    , mBytesCount{0}
+    , mIsFinished{false}
+{
+    if (0 == mBlockSize || mBlockSize > scMaxBlockSize)
+    {
+        throw std::runtime_error{"Error! Invalid block size"};
+    }
+
+    mPendingFractions.reserve(mBlockSize);
+    mBlockBytes.append(scMagic);
+    mBlockBytes.push_back(static_cast<char>(scFormatVersion));
+}
+
+FractionEncoder::~FractionEncoder()
+{
+    try
+    {
+        finish();
+    }
+    catch (...)
+    {
+    }
+}
+
+void FractionEncoder::write(const Fraction& fraction)
+{
+    if (mIsFinished)
+    {
+        throw std::runtime_error{"Error! The fraction stream is finished"};
+    }
+
+    mPendingFractions.push_back(fraction);
+    ++mFractionsCount;
+
+    if (mPendingFractions.size() == mBlockSize)
+    {
+        writeBlock();
+    }
+}
+
+void FractionEncoder::write(std::span<const Fraction> fractions)
+{
+    for (const Fraction& fraction : fractions)
+    {
+        write(fraction);
+    }
+}
+
+void FractionEncoder::finish()
+{
+    if (!mIsFinished)
+    {
+        mIsFinished = true;
+        writeBlock();
+        mOutputStream.flush();
+    }
+}
+
+size_t FractionEncoder::getFractionsCount() const
+{
+    return mFractionsCount;
+}
+
+size_t FractionEncoder::getBytesCount() const
+{
+    return mBytesCount;
+}
+
+/* The block is appended to the header for the first block (so an empty sequence is still a valid stream), the payload size is patched
+   once the payload is encoded
+*/
+void FractionEncoder::writeBlock()
+{
+    if (!mPendingFractions.empty())
+    {
+        const size_t cSizeOffset{mBlockBytes.size()};
+        mBlockBytes.append(scBlockSizeBytesCount, '\0');
+        appendVarint(mBlockBytes, mPendingFractions.size());
+
+        // numerators: the deltas are kept only when they are shorter (e.g. sorted sequences with common denominators)
+        size_t valuesSize{0};
+        size_t deltasSize{0};
+        long long previousNumerator{0};
+
+        for (const Fraction& fraction : mPendingFractions)
+        {
+            valuesSize += getVarintLength(encodeZigzag(fraction.getNumerator()));
+            deltasSize += getVarintLength(encodeZigzag(fraction.getNumerator() - previousNumerator));
+            previousNumerator = fraction.getNumerator();
+        }
+
+        const NumeratorMode cNumeratorMode{deltasSize < valuesSize ? NumeratorMode::DELTAS : NumeratorMode::VALUES};
+        std::unordered_map<int, std::uint8_t> dictionary;
+        const DenominatorMode cDenominatorMode{chooseDenominatorMode(mPendingFractions, dictionary)};
+
+        mBlockBytes.push_back(static_cast<char>(static_cast<std::uint8_t>(cNumeratorMode) | static_cast<std::uint8_t>(cDenominatorMode) << 2));
+        previousNumerator = 0;
+
+        for (const Fraction& fraction : mPendingFractions)
+        {
+            appendVarint(mBlockBytes, encodeZigzag(NumeratorMode::DELTAS == cNumeratorMode ? fraction.getNumerator() - previousNumerator
+                                                                                            : fraction.getNumerator()));
+            previousNumerator = fraction.getNumerator();
+        }
+
+        if (DenominatorMode::RUNS == cDenominatorMode)
+        {
+            std::vector<std::pair<size_t, int>> runs;
+
+            for (const Fraction& fraction : mPendingFractions)
+            {
+                if (runs.empty() || runs.back().second != fraction.getDenominator())
+                {
+                    runs.emplace_back(0, fraction.getDenominator());
+                }
+
+                ++runs.back().first;
+            }
+
+            appendVarint(mBlockBytes, runs.size());
+
+            for (const auto& [cRunLength, cDenominator] : runs)
+            {
+                appendVarint(mBlockBytes, cRunLength);
+                appendVarint(mBlockBytes, static_cast<std::uint64_t>(cDenominator));
+            }
+        }
+        else if (DenominatorMode::DICTIONARY == cDenominatorMode)
+        {
+            std::vector<int> denominators(dictionary.size());
+
+            for (const auto& [cDenominator, cIndex] : dictionary)
+            {
+                denominators[cIndex] = cDenominator;
+            }
+
+            appendVarint(mBlockBytes, denominators.size());
+
+            for (const int cDenominator : denominators)
+            {
+                appendVarint(mBlockBytes, static_cast<std::uint64_t>(cDenominator));
+            }
+
+            for (const Fraction& fraction : mPendingFractions)
+            {
+                mBlockBytes.push_back(static_cast<char>(dictionary[fraction.getDenominator()]));
+            }
+        }
+        else
+        {
+            for (const Fraction& fraction : mPendingFractions)
+            {
+                appendVarint(mBlockBytes, static_cast<std::uint64_t>(fraction.getDenominator()));
+            }
+        }
+
+        const size_t cPayloadSize{mBlockBytes.size() - cSizeOffset - scBlockSizeBytesCount};
+
+        for (size_t byteIndex{0}; byteIndex < scBlockSizeBytesCount; ++byteIndex)
+        {
+            mBlockBytes[cSizeOffset + byteIndex] = static_cast<char>(cPayloadSize >> (8 * byteIndex));
+        }
+
+        mPendingFractions.clear();
+    }
+
+    if (!mBlockBytes.empty())
+    {
+        if (!mOutputStream.write(mBlockBytes.data(), static_cast<std::streamsize>(mBlockBytes.size())))
+        {
+            throw std::runtime_error{"Error! Cannot write the fraction stream"};
+        }
+
+        mBytesCount += mBlockBytes.size();
+        mBlockBytes.clear();
+    }
+}
+
+FractionDecoder::FractionDecoder(std::string_view encoded)
+    : mEncoded{encoded}
+    , mFractionsCount{0}
+{
+    if (encoded.size() < scMagic.size() + 1 || encoded.substr(0, scMagic.size()) != scMagic ||
+        scFormatVersion != static_cast<std::uint8_t>(encoded[scMagic.size()]))
+    {
+        throwInvalidStream();
+    }
+
+    const std::uint8_t* const cBegin{reinterpret_cast<const std::uint8_t*>(encoded.data())};
+    const std::uint8_t* const cEnd{cBegin + encoded.size()};
+
+    for (const std::uint8_t* position{cBegin + scMagic.size() + 1}; position != cEnd;)
+    {
+        if (static_cast<size_t>(cEnd - position) < scBlockSizeBytesCount)
+        {
+            throwInvalidStream();
+        }
+
+        size_t payloadSize{0};
+
+        for (size_t byteIndex{0}; byteIndex < scBlockSizeBytesCount; ++byteIndex)
+        {
+            payloadSize |= static_cast<size_t>(position[byteIndex]) << (8 * byteIndex);
+        }
+
+        position += scBlockSizeBytesCount;
+
+        if (static_cast<size_t>(cEnd - position) < payloadSize)
+        {
+            throwInvalidStream();
+        }
+
+        const std::uint8_t* const cPayloadEnd{position + payloadSize};
+        std::uint64_t fractionsCount{0};
+
+        position = decodeVarint(position, cPayloadEnd, fractionsCount);
+
+        // each fraction takes at least its numerator byte
+        if (0u == fractionsCount || fractionsCount > static_cast<std::uint64_t>(cPayloadEnd - position))
+        {
+            throwInvalidStream();
+        }
+
+        mBlocks.push_back(Block{static_cast<size_t>(position - cBegin), static_cast<size_t>(cPayloadEnd - position), mFractionsCount,
+                                static_cast<size_t>(fractionsCount)});
+        mFractionsCount += static_cast<size_t>(fractionsCount);
+        position = cPayloadEnd;
+    }
+}
+
+size_t FractionDecoder::getFractionsCount() const
+{
+    return mFractionsCount;
+}
+
+size_t FractionDecoder::getBlocksCount() const
+{
+    return mBlocks.size();
+}
+
+FractionArray FractionDecoder::decode(FractionScheduler& scheduler, std::pmr::memory_resource* memoryResource) const
+{
+    FractionArray result(mFractionsCount, memoryResource);
+
+    auto decodeBlocks{[this, &result](size_t begin, size_t end, size_t)
+    {
+        for (size_t block{begin}; block < end; ++block)
+        {
+            decodeBlock(mBlocks[block], std::span<Fraction>{result.data() + mBlocks[block].firstIndex, mBlocks[block].fractionsCount});
+        }
+    }};
+
+    // a single block is decoded by the calling thread
+    if (mBlocks.size() <= 1)
+    {
+        decodeBlocks(0, mBlocks.size(), 0);
+    }
+    else
+    {
+        scheduler.parallelFor(mBlocks.size(), decodeBlocks, 1);
+    }
+
+    return result;
+}
+
+void FractionDecoder::decode(size_t first, std::span<Fraction> results) const
+{
+    if (first > mFractionsCount || results.size() > mFractionsCount - first)
+    {
+        throw std::runtime_error{"Error! Fraction range out of the stream"};
+    }
+
+    // first block containing the range, then the blocks are decoded into a buffer unless they are fully covered by the range
+    auto blockIterator{std::upper_bound(mBlocks.cbegin(), mBlocks.cend(), first, [](size_t index, const Block& block) {return index < block.firstIndex;})};
+    std::vector<Fraction> blockFractions;
+
+    for (size_t decodedCount{0}; decodedCount < results.size(); ++blockIterator)
+    {
+        const Block& cBlock{*std::prev(blockIterator)};
+        const size_t cBegin{first + decodedCount - cBlock.firstIndex};
+        const size_t cCount{std::min(cBlock.fractionsCount - cBegin, results.size() - decodedCount)};
+
+        if (cCount == cBlock.fractionsCount)
+        {
+            decodeBlock(cBlock, results.subspan(decodedCount, cCount));
+        }
+        else
+        {
+            blockFractions.resize(cBlock.fractionsCount);
+            decodeBlock(cBlock, blockFractions);
+            std::copy_n(blockFractions.cbegin() + static_cast<std::ptrdiff_t>(cBegin), cCount, results.begin() + static_cast<std::ptrdiff_t>(decodedCount));
+        }
+
+        decodedCount += cCount;
+    }
+}
+
+Fraction FractionDecoder::get(size_t index) const
+{
+    Fraction result;
+    decode(index, std::span<Fraction>{&result, 1});
+
+    return result;
+}
+
+void FractionDecoder::decodeBlock(const Block& block, std::span<Fraction> results) const
+{
+    const std::uint8_t* position{reinterpret_cast<const std::uint8_t*>(mEncoded.data()) + block.offset};
+    const std::uint8_t* const cEnd{position + block.size};
+
+    if (position == cEnd)
+    {
+        throwInvalidStream();
+    }
+
+    const std::uint8_t cModes{*position++};
+    const NumeratorMode cNumeratorMode{static_cast<NumeratorMode>(cModes & 0x3u)};
+    const DenominatorMode cDenominatorMode{static_cast<DenominatorMode>(cModes >> 2)};
+
+    if (cNumeratorMode > NumeratorMode::DELTAS || cDenominatorMode > DenominatorMode::DICTIONARY)
+    {
+        throwInvalidStream();
+    }
+
+    std::vector<std::uint64_t> numerators(block.fractionsCount);
+    std::vector<int> denominators(block.fractionsCount);
+
+    position = decodeVarints(position, cEnd, numerators);
+
+    if (DenominatorMode::VALUES == cDenominatorMode)
+    {
+        std::vector<std::uint64_t> values(block.fractionsCount);
+        position = decodeVarints(position, cEnd, values);
+        std::transform(values.cbegin(), values.cend(), denominators.begin(), toDenominator);
+    }
+    else
+    {
+        std::uint64_t entriesCount{0};
+        position = decodeVarint(position, cEnd, entriesCount);
+
+        if (entriesCount > block.fractionsCount || (DenominatorMode::DICTIONARY == cDenominatorMode && entriesCount > scMaxDictionarySize))
+        {
+            throwInvalidStream();
+        }
+
+        // (run length, denominator) pairs or the dictionary values
+        const size_t cValuesPerEntry{DenominatorMode::RUNS == cDenominatorMode ? 2u : 1u};
+        std::vector<std::uint64_t> entries(static_cast<size_t>(entriesCount) * cValuesPerEntry);
+        position = decodeVarints(position, cEnd, entries);
+
+        if (DenominatorMode::RUNS == cDenominatorMode)
+        {
+            size_t index{0};
+
+            for (size_t entry{0}; entry < entries.size(); entry += 2)
+            {
+                if (entries[entry] > block.fractionsCount - index)
+                {
+                    throwInvalidStream();
+                }
+
+                std::fill_n(denominators.begin() + static_cast<std::ptrdiff_t>(index), entries[entry], toDenominator(entries[entry + 1]));
+                index += static_cast<size_t>(entries[entry]);
+            }
+
+            if (index != block.fractionsCount)
+            {
+                throwInvalidStream();
+            }
+        }
+        else
+        {
+            if (static_cast<size_t>(cEnd - position) < block.fractionsCount)
+            {
+                throwInvalidStream();
+            }
+
+            std::vector<int> dictionary(entries.size());
+            std::transform(entries.cbegin(), entries.cend(), dictionary.begin(), toDenominator);
+
+            for (int& denominator : denominators)
+            {
+                const std::uint8_t cIndex{*position++};
+
+                if (cIndex >= dictionary.size())
+                {
+                    throwInvalidStream();
+                }
+
+                denominator = dictionary[cIndex];
+            }
+        }
+    }
+
+    if (position != cEnd)
+    {
+        throwInvalidStream();
+    }
+
+    long long numerator{0};
+
+    for (size_t index{0}; index < block.fractionsCount; ++index)
+    {
+        const long long cValue{decodeZigzag(numerators[index])};
+
+        // the values and the deltas of int numerators are within +/-2^32, so the sum cannot overflow
+        if (cValue < scMinNumeratorDelta || cValue > scMaxNumeratorDelta)
+        {
+            throwInvalidStream();
+        }
+
+        numerator = NumeratorMode::DELTAS == cNumeratorMode ? numerator + cValue : cValue;
+
+        if (numerator < std::numeric_limits<int>::min() || numerator > std::numeric_limits<int>::max() ||
+            1 != std::gcd(static_cast<int>(numerator), denominators[index]))
+        {
+            throwInvalidStream();
+        }
+
+        results[index] = Fraction::fromReducedTerms(static_cast<int>(numerator), denominators[index]);
+    }
+}
+
+std::string encodeFractions(std::span<const Fraction> fractions, size_t blockSize)
+{
+    std::ostringstream encodedStream;
+    FractionEncoder encoder{encodedStream, blockSize};
+
+    encoder.write(fractions);
+    encoder.finish();
+
+    return std::move(encodedStream).str();
+}
+
+FractionArray decodeFractions(std::string_view encoded, FractionScheduler& scheduler, std::pmr::memory_resource* memoryResource)
+{
+    const FractionDecoder cDecoder{encoded};
+    return cDecoder.decode(scheduler, memoryResource);
+}
@@ -0,0 +1,98 @@
+#ifndef FRACTIONCODEC_H
+#define FRACTIONCODEC_H
+
+#include <span>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <string_view>
+#include <memory_resource>
+
+#include "fraction.h"
+#include "fractionarray.h"
+#include "fractionscheduler.h"
+
+/* Compressed binary format of fraction sequences, split into independent blocks so they can be decoded in parallel or individually (seeking):
+   - stream: "FRCZ" magic, format version byte, then the blocks
+   - block: payload size (4 bytes, little endian, so the block size is limited), fractions count (varint), coding modes byte, numerators, denominators
+   - numerators: zigzag varints of the values or of the differences to the previous numerator of the block (sorted sequences)
+   - denominators: varints, runs (count and denominator varints) or a dictionary of up to 256 denominators followed by one index byte per fraction
+   - the encoder chooses the smallest coding of each block, the varints are 7 bits per byte (LEB128), e.g. 1/2 takes 2 bytes
+*/
+class FractionEncoder
+{
+public:
+    // constructors
+    explicit FractionEncoder(std::ostream& outputStream, size_t blockSize = 4096);    // throws for a 0 block size or one over 200 million fractions
+    ~FractionEncoder();     // finishes the stream, call finish() to get the write errors
+
+    FractionEncoder(const FractionEncoder&) = delete;
+    FractionEncoder& operator=(const FractionEncoder&) = delete;
+
+    // the fractions are encoded and written whenever a block is full, throw when the stream cannot be written
+    void write(const Fraction& fraction);
+    void write(std::span<const Fraction> fractions);
+    void finish();          // writes the last (partial) block, the encoder cannot be written afterwards
+
+    // getters
+    size_t getFractionsCount() const;
+    size_t getBytesCount() const;       // written so far (the pending fractions are not included)
+
+private:
+    void writeBlock();
+
+    std::ostream& mOutputStream;
+    size_t mBlockSize;
+    std::vector<Fraction> mPendingFractions;
+    std::string mBlockBytes;
+    size_t mFractionsCount;
+    size_t mBytesCount;
+    bool mIsFinished;
+};
+
+/* Random access decoder of an encoded buffer (which must outlive the decoder): the block headers are read by the constructor,
+   so any range of fractions is decoded from the blocks containing it only
+   - the varints are decoded 16 bytes at a time: the continuation bits are extracted at once (SSE2 where available, SWAR otherwise)
+     and a run of one byte values is copied without any branch per byte
+   - the terms are validated (int numerators, positive denominators, reduced fractions), so corrupted streams are reported as errors
+*/
+class FractionDecoder
+{
+public:
+    // constructors
+    explicit FractionDecoder(std::string_view encoded);    // throws when the header or the block framing is invalid
+
+    // getters
+    size_t getFractionsCount() const;
+    size_t getBlocksCount() const;
+
+    // all fractions, the blocks are distributed among the scheduler workers; throws on invalid payloads
+    FractionArray decode(FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler(),
+                         std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource()) const;
+
+    // fractions [first, first + results.size()), throws when the range exceeds the fractions count
+    void decode(size_t first, std::span<Fraction> results) const;
+    Fraction get(size_t index) const;
+
+private:
+    struct Block
+    {
+        size_t offset;          // of the payload within the encoded buffer
+        size_t size;            // payload bytes
+        size_t firstIndex;      // index of the first fraction of the block within the sequence
+        size_t fractionsCount;
+    };
+
+    void decodeBlock(const Block& block, std::span<Fraction> results) const;
+
+    std::string_view mEncoded;
+    std::vector<Block> mBlocks;
+    size_t mFractionsCount;
+};
+
+// helpers for the sequences held in memory
+std::string encodeFractions(std::span<const Fraction> fractions, size_t blockSize = 4096);
+FractionArray decodeFractions(std::string_view encoded, FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler(),
+                              std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
+
+#endif // FRACTIONCODEC_H
@@ -0,0 +1,188 @@
+#include <limits>
+#include <cstdlib>
+
+#include "fractioncontext.h"
+#include "checkedfraction.h"
+
+static constexpr long long scMaxTermMagnitude{std::numeric_limits<int>::max()};
+
+// last convergent of numerator / denominator (reduced, positive denominator) whose terms fit into int
+static Fraction getClosestFraction(long long numerator, long long denominator)
+{
+    const long long cMagnitude{std::llabs(numerator)};
+
+    // p0 / q0 and p1 / q1 are the last two convergents (starting with 0 / 1 and 1 / 0)
+    long long previousNumerator{0};
+    long long previousDenominator{1};
+    long long resultNumerator{scMaxTermMagnitude};
+    long long resultDenominator{1};
+
+    if (cMagnitude / denominator < scMaxTermMagnitude)
+    {
+        long long currentNumerator{cMagnitude};
+        long long currentDenominator{denominator};
+
+        resultNumerator = 1;
+        resultDenominator = 0;
+
+        while (0 != currentDenominator)
+        {
+            const long long cTerm{currentNumerator / currentDenominator};
+
+            // the convergent terms only grow, so the walk ends at the first convergent out of range
+            if ((0 != resultNumerator && cTerm > (scMaxTermMagnitude - previousNumerator) / resultNumerator) ||
+                (0 != resultDenominator && cTerm > (scMaxTermMagnitude - previousDenominator) / resultDenominator))
+            {
+                break;
+            }
+
+            const long long cNextNumerator{cTerm * resultNumerator + previousNumerator};
+            const long long cNextDenominator{cTerm * resultDenominator + previousDenominator};
+            const long long cRemainder{currentNumerator - cTerm * currentDenominator};
+
+            previousNumerator = resultNumerator;
+            previousDenominator = resultDenominator;
+            resultNumerator = cNextNumerator;
+            resultDenominator = cNextDenominator;
+            currentNumerator = currentDenominator;
+            currentDenominator = cRemainder;
+        }
+    }
+
+    const Fraction cResult{static_cast<int>(numerator < 0 ? -resultNumerator : resultNumerator), static_cast<int>(resultDenominator)};
+
+    return cResult;
+}
+
+/* The exact result if it fits, the closest convergent otherwise (raising the overflow flag);
+   the operations try the faster non-throwing Fraction API first and only compute the result as CheckedFraction when it overflows
+*/
+static Fraction toFraction(const CheckedFraction& result, FractionContext& context)
+{
+    if (result.fitsFraction())
+    {
+        return result.toFraction();
+    }
+
+    context.raise(FractionError::ARITHMETIC_OVERFLOW);
+
+    return getClosestFraction(result.getNumerator(), result.getDenominator());
+}
+
+FractionContext::FractionContext()
+    : mFlags{0}
+{
+}
+
+bool FractionContext::isRaised(FractionError error) const
+{
+    return 0 != (mFlags & getFlag(error));
+}
+
+bool FractionContext::hasRaisedFlags() const
+{
+    return 0 != mFlags;
+}
+
+unsigned FractionContext::getFlags() const
+{
+    return mFlags;
+}
+
+void FractionContext::raise(FractionError error)
+{
+    mFlags |= getFlag(error);
+}
+
+void FractionContext::raiseFlags(unsigned flags)
+{
+    mFlags |= flags;
+}
+
+void FractionContext::clear()
+{
+    mFlags = 0;
+}
+
+unsigned FractionContext::getFlag(FractionError error)
+{
+    return 1u << static_cast<unsigned>(error);
+}
+
+Fraction FractionContext::make(int numerator, int denominator)
+{
+    Fraction result;
+
+    if (0 != denominator)
+    {
+        result = toFraction(CheckedFraction{numerator, denominator}, *this);
+    }
+    else
+    {
+        raise(FractionError::DIVISION_BY_ZERO);
+    }
+
+    return result;
+}
+
+Fraction FractionContext::parse(std::string_view fractionString)
+{
+    const std::expected<Fraction, FractionError> cResult{Fraction::tryParse(fractionString)};
+
+    if (!cResult)
+    {
+        raise(cResult.error());
+    }
+
+    return cResult.value_or(Fraction{});
+}
+
+Fraction FractionContext::add(const Fraction& first, const Fraction& second)
+{
+    const std::expected<Fraction, FractionError> cResult{first.tryAdd(second)};
+
+    return cResult ? *cResult : toFraction(CheckedFraction{first} + CheckedFraction{second}, *this);
+}
+
+Fraction FractionContext::subtract(const Fraction& first, const Fraction& second)
+{
+    const std::expected<Fraction, FractionError> cResult{first.trySubtract(second)};
+
+    return cResult ? *cResult : toFraction(CheckedFraction{first} - CheckedFraction{second}, *this);
+}
+
+Fraction FractionContext::multiply(const Fraction& first, const Fraction& second)
+{
+    const std::expected<Fraction, FractionError> cResult{first.tryMultiply(second)};
+
+    return cResult ? *cResult : toFraction(CheckedFraction{first} * CheckedFraction{second}, *this);
+}
+
+Fraction FractionContext::divide(const Fraction& first, const Fraction& second)
+{
+    Fraction result;
+
+    if (0 != second.getNumerator())
+    {
+        const std::expected<Fraction, FractionError> cResult{first.tryDivide(second)};
+
+        result = cResult ? *cResult : toFraction(CheckedFraction{first} / CheckedFraction{second}, *this);
+    }
+    else
+    {
+        raise(FractionError::DIVISION_BY_ZERO);
+    }
+
+    return result;
+}
+
+Fraction FractionContext::inverse(const Fraction& fraction)
+{
+    return divide(Fraction{1}, fraction);
+}
+
+FractionContext& FractionContext::getThreadContext()
+{
+    thread_local FractionContext tContext;
+    return tContext;
+}
@@ -0,0 +1,49 @@
+#ifndef FRACTIONCONTEXT_H
+#define FRACTIONCONTEXT_H
+
+#include <string>
+#include <string_view>
+
+#include "fraction.h"
+
+/* Sticky status flags (similar to the IEEE 754 floating point exception flags): the operations of a context never throw, they raise the flag
+   matching the error and continue with a defined result, the flags staying raised until cleared, so a whole computation can be checked once at the end
+   - division by zero (or inverse of zero): the result is 0
+   - overflow: the result is the last continued fraction convergent of the exact value that fits into int terms
+     (the value is saturated to +/- the maximum int if its magnitude is out of range)
+   - invalid format (parsing): the result is 0
+   Each thread has its own default context, other contexts can be created for isolating the flags of a computation.
+*/
+class FractionContext
+{
+public:
+    // constructors
+    FractionContext();
+
+    // flags
+    bool isRaised(FractionError error) const;
+    bool hasRaisedFlags() const;
+    unsigned getFlags() const;
+
+    void raise(FractionError error);
+    void raiseFlags(unsigned flags);
+    void clear();
+
+    static unsigned getFlag(FractionError error);
+
+    // operations with sticky error reporting
+    Fraction make(int numerator, int denominator);
+    Fraction parse(std::string_view fractionString);
+    Fraction add(const Fraction& first, const Fraction& second);
+    Fraction subtract(const Fraction& first, const Fraction& second);
+    Fraction multiply(const Fraction& first, const Fraction& second);
+    Fraction divide(const Fraction& first, const Fraction& second);
+    Fraction inverse(const Fraction& fraction);
+
+    static FractionContext& getThreadContext();
+
+private:
+    unsigned mFlags;
+};
+
+#endif // FRACTIONCONTEXT_H
@@ -0,0 +1,362 @@
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+#include "fractioncsvreader.h"
+
+static constexpr char scQuote{'"'};
+static constexpr char scLineBreak{'\n'};
+static constexpr char scCarriageReturn{'\r'};
+static constexpr size_t scDefaultChunkSize{1 << 20};
+static constexpr double scBytesPerMegabyte{1024.0 * 1024.0};
+
+using Clock = std::chrono::steady_clock;
+
+static double getElapsedMilliseconds(const Clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/* Reads the field starting at position, returns the position of the next field or of the next record
+   - an unquoted field is returned as a view of the text, a quoted one is unquoted into quotedField (the view is valid until the next call)
+   - isLastField is set when the field ends the record (line break or end of the text)
+*/
+static size_t readField(std::string_view text, size_t position, char delimiter, std::string& quotedField, std::string_view& field, bool& isLastField)
+{
+    const bool cIsQuoted{position < text.size() && scQuote == text[position]};
+
+    quotedField.clear();
+
+    if (cIsQuoted)
+    {
+        ++position;
+
+        while (position < text.size())
+        {
+            const size_t cQuotePosition{text.find(scQuote, position)};
+
+            if (std::string_view::npos == cQuotePosition)
+            {
+                // unterminated quoted field: the rest of the text is its content
+                quotedField.append(text.substr(position));
+                position = text.size();
+                break;
+            }
+
+            quotedField.append(text.substr(position, cQuotePosition - position));
+            position = cQuotePosition + 1;
+
+            if (position < text.size() && scQuote == text[position])
+            {
+                // doubled quote
+                quotedField.push_back(scQuote);
+                ++position;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    // unquoted field or the characters following the closing quote (appended to the quoted content)
+    const size_t cBegin{position};
+
+    while (position < text.size() && delimiter != text[position] && scLineBreak != text[position])
+    {
+        ++position;
+    }
+
+    if (cIsQuoted)
+    {
+        quotedField.append(text.substr(cBegin, position - cBegin));
+        field = quotedField;
+    }
+    else
+    {
+        field = text.substr(cBegin, position - cBegin);
+    }
+
+    if (!field.empty() && scCarriageReturn == field.back() && (position == text.size() || scLineBreak == text[position]))
+    {
+        field.remove_suffix(1);
+    }
+
+    isLastField = position == text.size() || scLineBreak == text[position];
+
+    return position < text.size() ? position + 1 : position;
+}
+
+// calls function(chunk) for all chunks, the chunks being shared by the scheduler workers (the first exception is rethrown)
+template<typename Function>
+static void forEachChunk(size_t chunksCount, FractionScheduler& scheduler, const Function& function)
+{
+    scheduler.parallelFor(chunksCount, [&function](size_t begin, size_t end, size_t)
+    {
+        for (size_t chunk{begin}; chunk < end; ++chunk)
+        {
+            function(chunk);
+        }
+    }, 1);
+}
+
+FractionCsvTable::FractionCsvTable(std::pmr::memory_resource* memoryResource)
+    : mColumns{memoryResource}
+    , mBytesCount{0}
+    , mMilliseconds{0.0}
+{
+}
+
+size_t FractionCsvTable::getRowsCount() const
+{
+    return mColumns.empty() ? 0 : mColumns.front().size();
+}
+
+size_t FractionCsvTable::getColumnsCount() const
+{
+    return mColumns.size();
+}
+
+const std::vector<std::string>& FractionCsvTable::getColumnNames() const
+{
+    return mColumnNames;
+}
+
+const FractionArray& FractionCsvTable::getColumn(size_t column) const
+{
+    if (column >= mColumns.size())
+    {
+        throw std::runtime_error{"Error! Invalid column index"};
+    }
+
+    return mColumns[column];
+}
+
+const FractionArray& FractionCsvTable::getColumn(const std::string& columnName) const
+{
+    const auto cIt{std::find(mColumnNames.cbegin(), mColumnNames.cend(), columnName)};
+
+    if (mColumnNames.cend() == cIt)
+    {
+        throw std::runtime_error{"Error! Unknown column name"};
+    }
+
+    return mColumns[static_cast<size_t>(std::distance(mColumnNames.cbegin(), cIt))];
+}
+
+const std::vector<FractionCsvCellError>& FractionCsvTable::getErrors() const
+{
+    return mErrors;
+}
+
+size_t FractionCsvTable::getBytesCount() const
+{
+    return mBytesCount;
+}
+
+double FractionCsvTable::getMilliseconds() const
+{
+    return mMilliseconds;
+}
+
+double FractionCsvTable::getMegabytesPerSecond() const
+{
+    return mMilliseconds > 0.0 ? mBytesCount / scBytesPerMegabyte / (mMilliseconds / 1000.0) : 0.0;
+}
+
+FractionCsvReader::FractionCsvReader(char delimiter, bool hasHeader, FractionScheduler& scheduler)
+    : mDelimiter{delimiter}
+    , mHasHeader{hasHeader}
+    , mScheduler{scheduler}
+    , mChunkSize{scDefaultChunkSize}
+{
+    if (scQuote == delimiter || scLineBreak == delimiter || scCarriageReturn == delimiter)
+    {
+        throw std::runtime_error{"Error! Invalid delimiter"};
+    }
+}
+
+FractionCsvTable FractionCsvReader::read(std::string_view text, std::pmr::memory_resource* memoryResource) const
+{
+    const Clock::time_point cStart{Clock::now()};
+    FractionCsvTable table{memoryResource};
+
+    parse(text, table);
+    table.mBytesCount = text.size();
+    table.mMilliseconds = getElapsedMilliseconds(cStart);
+
+    return table;
+}
+
+FractionCsvTable FractionCsvReader::readFile(const std::string& filePath, std::pmr::memory_resource* memoryResource) const
+{
+    const Clock::time_point cStart{Clock::now()};
+    std::ifstream file{filePath, std::ios::binary};
+
+    if (!file.is_open())
+    {
+        throw std::runtime_error{"Error! Cannot open file " + filePath};
+    }
+
+    file.seekg(0, std::ios::end);
+    std::pmr::string text(static_cast<size_t>(std::max<std::streamoff>(file.tellg(), 0)), '\0', memoryResource);
+    file.seekg(0, std::ios::beg);
+
+    if (!file.read(text.data(), static_cast<std::streamsize>(text.size())))
+    {
+        throw std::runtime_error{"Error! Cannot read file " + filePath};
+    }
+
+    FractionCsvTable table{memoryResource};
+
+    parse(text, table);
+    table.mBytesCount = text.size();
+    table.mMilliseconds = getElapsedMilliseconds(cStart);
+
+    return table;
+}
+
+void FractionCsvReader::setChunkSize(size_t chunkSize)
+{
+    mChunkSize = std::max<size_t>(chunkSize, 1);
+}
+
+void FractionCsvReader::parse(std::string_view text, FractionCsvTable& table) const
+{
+    if (text.empty())
+    {
+        return;
+    }
+
+    // the first record gives the number of columns (and their names)
+    std::string quotedField;
+    std::string_view field;
+    size_t columnsCount{0};
+    size_t position{0};
+
+    for (bool isLastField{false}; !isLastField; ++columnsCount)
+    {
+        position = readField(text, position, mDelimiter, quotedField, field, isLastField);
+
+        if (mHasHeader)
+        {
+            table.mColumnNames.emplace_back(field);
+        }
+    }
+
+    const std::string_view cData{mHasHeader ? text.substr(position) : text};
+
+    table.mColumns.resize(columnsCount);
+
+    if (cData.empty())
+    {
+        return;
+    }
+
+    // first pass: quotes and line breaks of each chunk
+    const size_t cChunksCount{(cData.size() + mChunkSize - 1) / mChunkSize};
+    std::vector<ChunkScan> chunkScans(cChunksCount);
+
+    forEachChunk(cChunksCount, mScheduler, [this, cData, &chunkScans](size_t chunk)
+    {
+        const std::string_view cChunk{cData.substr(chunk * mChunkSize, mChunkSize)};
+        ChunkScan& chunkScan{chunkScans[chunk]};
+
+        for (const char cCharacter : cChunk)
+        {
+            chunkScan.quotesCount += scQuote == cCharacter;
+            chunkScan.lineBreaksCount[chunkScan.quotesCount % 2] += scLineBreak == cCharacter;
+        }
+    });
+
+    // quoting state at the beginning of each chunk and index of the first record starting in it (after its first record separator)
+    std::vector<size_t> chunkQuoting(cChunksCount);
+    std::vector<size_t> chunkFirstRows(cChunksCount + 1);
+    size_t quotesCount{0};
+
+    chunkFirstRows[0] = 0;
+
+    for (size_t chunk{0}; chunk < cChunksCount; ++chunk)
+    {
+        chunkQuoting[chunk] = quotesCount % 2;
+        chunkFirstRows[chunk + 1] = chunkFirstRows[chunk] + chunkScans[chunk].lineBreaksCount[chunkQuoting[chunk]] + (0 == chunk ? 1 : 0);
+        quotesCount += chunkScans[chunk].quotesCount;
+    }
+
+    // a line break ending the text does not start a record
+    const size_t cRowsCount{chunkFirstRows[cChunksCount] - ((scLineBreak == cData.back() && 0 == quotesCount % 2) ? 1 : 0)};
+
+    for (FractionArray& column : table.mColumns)
+    {
+        column.resize(cRowsCount);
+    }
+
+    // second pass: the records are parsed directly into their rows, the errors are kept per chunk to stay sorted
+    std::vector<std::vector<FractionCsvCellError>> chunkErrors(cChunksCount);
+
+    forEachChunk(cChunksCount, mScheduler, [this, cData, cRowsCount, columnsCount, &chunkQuoting, &chunkFirstRows, &chunkErrors, &table](size_t chunk)
+    {
+        const size_t cEndRow{std::min(chunkFirstRows[chunk + 1], cRowsCount)};
+        size_t position{chunk * mChunkSize};
+
+        if (chunkFirstRows[chunk] >= cEndRow)
+        {
+            return;
+        }
+
+        if (0 != chunk)
+        {
+            // the first record separator of the chunk (it exists as at least one record starts in the chunk)
+            for (size_t quoting{chunkQuoting[chunk]}; scLineBreak != cData[position] || 0 != quoting; ++position)
+            {
+                quoting ^= scQuote == cData[position] ? 1 : 0;
+            }
+
+            ++position;
+        }
+
+        std::string quotedField;
+        std::string_view field;
+        std::vector<FractionCsvCellError>& errors{chunkErrors[chunk]};
+
+        for (size_t row{chunkFirstRows[chunk]}; row < cEndRow; ++row)
+        {
+            size_t column{0};
+
+            for (bool isLastField{false}; !isLastField; ++column)
+            {
+                position = readField(cData, position, mDelimiter, quotedField, field, isLastField);
+
+                if (column < columnsCount)
+                {
+                    const std::expected<Fraction, FractionError> cValue{Fraction::tryParse(field)};
+
+                    if (cValue)
+                    {
+                        table.mColumns[column][row] = *cValue;
+                    }
+                    else
+                    {
+                        errors.push_back(FractionCsvCellError{row, column, cValue.error(), std::string{field}});
+                    }
+                }
+                else if (column == columnsCount)
+                {
+                    errors.push_back(FractionCsvCellError{row, column, FractionError::INVALID_FORMAT, std::string{field}});
+                }
+            }
+
+            for (; column < columnsCount; ++column)
+            {
+                errors.push_back(FractionCsvCellError{row, column, FractionError::INVALID_FORMAT, std::string{}});
+            }
+        }
+    });
+
+    for (std::vector<FractionCsvCellError>& errors : chunkErrors)
+    {
+        std::move(errors.begin(), errors.end(), std::back_inserter(table.mErrors));
+    }
+}
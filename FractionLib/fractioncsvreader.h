@@ -0,0 +1,93 @@
+#ifndef FRACTIONCSVREADER_H
+#define FRACTIONCSVREADER_H
+
+#include <string>
+#include <vector>
+#include <string_view>
+#include <memory_resource>
+
+#include "fraction.h"
+#include "fractionarray.h"
+#include "fractionscheduler.h"
+
+// cell which could not be converted to a Fraction (the row index does not count the header, the column index is 0 based)
+struct FractionCsvCellError
+{
+    size_t row;
+    size_t column;
+    FractionError error;
+    std::string text;       // the unquoted cell content, empty for a missing cell
+};
+
+/* Columns of fractions read from CSV text, the bad cells are set to 0 and reported in getErrors() (sorted by row and column)
+   - the columns are allocated from the memory resource given to the reader
+*/
+class FractionCsvTable
+{
+public:
+    // constructors
+    explicit FractionCsvTable(std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
+
+    // getters
+    size_t getRowsCount() const;
+    size_t getColumnsCount() const;
+    const std::vector<std::string>& getColumnNames() const;     // empty when the text has no header
+    const FractionArray& getColumn(size_t column) const;
+    const FractionArray& getColumn(const std::string& columnName) const;
+    const std::vector<FractionCsvCellError>& getErrors() const;
+
+    // throughput of the last read (for readFile() the reading of the file is included)
+    size_t getBytesCount() const;
+    double getMilliseconds() const;
+    double getMegabytesPerSecond() const;
+
+private:
+    friend class FractionCsvReader;
+
+    std::vector<std::string> mColumnNames;
+    std::pmr::vector<FractionArray> mColumns;
+    std::vector<FractionCsvCellError> mErrors;
+    size_t mBytesCount;
+    double mMilliseconds;
+};
+
+/* Parallel reader of CSV columns in any of the formats accepted by Fraction::tryParse() (fraction, decimal or integer)
+   - the text is split into chunks of equal size, each thread counts the quotes and the line breaks of its chunks, so that the line boundaries
+     outside the quoted fields (and the index of the first row of each chunk) are known without a serial scan of the text
+   - the chunks are then parsed in parallel directly into the (preallocated) columns, both passes running on the scheduler given to the constructor
+   - quoted fields follow RFC 4180: they may contain the delimiter, line breaks and doubled quotes, the line breaks may be "\n" or "\r\n"
+   - the number of columns is given by the first line, missing cells are reported as errors with empty text, extra cells are reported once per row
+     (with the index of the first extra column) and ignored
+   - the columns (and the text read by readFile()) are allocated from the given memory resource, only by the calling thread,
+     so an unsynchronized arena (e.g. std::pmr::monotonic_buffer_resource) can be used
+*/
+class FractionCsvReader
+{
+public:
+    // constructors
+    explicit FractionCsvReader(char delimiter = ',', bool hasHeader = true, FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler());
+
+    FractionCsvTable read(std::string_view text, std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource()) const;
+
+    // throws when the file cannot be read
+    FractionCsvTable readFile(const std::string& filePath, std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource()) const;
+
+    void setChunkSize(size_t chunkSize);     // bytes per chunk (1 MB by default), mainly for testing the chunk boundaries
+
+private:
+    // statistics of a chunk computed before its parsing, the counts are given for both possible quoting states at the chunk beginning
+    struct ChunkScan
+    {
+        size_t quotesCount{0};
+        size_t lineBreaksCount[2]{0, 0};     // line breaks seen while an even/odd number of quotes preceded them within the chunk
+    };
+
+    void parse(std::string_view text, FractionCsvTable& table) const;
+
+    char mDelimiter;
+    bool mHasHeader;
+    FractionScheduler& mScheduler;
+    size_t mChunkSize;
+};
+
+#endif // FRACTIONCSVREADER_H
@@ -0,0 +1,457 @@
+#include <limits>
+#include <cctype>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+
+#include "fractionformula.h"
+
+// rows evaluated by a worker at a time (batches up to this size are evaluated by the calling thread)
+static constexpr size_t scRowsChunkSize{1024};
+
+/* Grammar (lowest precedence first):
+   expression := term (('+' | '-') term)*
+   term       := unary (('*' | '/') unary)*
+   unary      := ('+' | '-') unary | power
+   power      := primary ('^' exponent)?
+   exponent   := ['+' | '-'] integer | '(' ['+' | '-'] integer ')'
+   primary    := number | variable | '(' expression ')'
+*/
+class FractionFormula::Compiler
+{
+public:
+    Compiler(const std::string& formula, FractionFormula& compiledFormula, bool canAddVariables)
+        : mFormula{formula}
+        , mPosition{0}
+        , mCompiledFormula{compiledFormula}
+        , mCanAddVariables{canAddVariables}
+    {
+    }
+
+    void compile()
+    {
+        parseExpression();
+        skipSpaces();
+
+        if (mPosition != mFormula.size())
+        {
+            throwError("unexpected character");
+        }
+    }
+
+private:
+    void parseExpression()
+    {
+        parseTerm();
+
+        for (char sign{getNextChar()}; '+' == sign || '-' == sign; sign = getNextChar())
+        {
+            ++mPosition;
+            parseTerm();
+            emitOperation('+' == sign ? OpCode::ADD : OpCode::SUBTRACT);
+        }
+    }
+
+    void parseTerm()
+    {
+        parseUnary();
+
+        for (char sign{getNextChar()}; '*' == sign || '/' == sign; sign = getNextChar())
+        {
+            ++mPosition;
+            parseUnary();
+            emitOperation('*' == sign ? OpCode::MULTIPLY : OpCode::DIVIDE);
+        }
+    }
+
+    void parseUnary()
+    {
+        const char cSign{getNextChar()};
+
+        if ('+' == cSign || '-' == cSign)
+        {
+            ++mPosition;
+            parseUnary();
+
+            if ('-' == cSign)
+            {
+                emitOperation(OpCode::NEGATE);
+            }
+        }
+        else
+        {
+            parsePower();
+        }
+    }
+
+    void parsePower()
+    {
+        parsePrimary();
+
+        if ('^' == getNextChar())
+        {
+            ++mPosition;
+
+            const bool cIsParenthesized{'(' == getNextChar()};
+
+            if (cIsParenthesized)
+            {
+                ++mPosition;
+            }
+
+            const char cSign{getNextChar()};
+
+            if ('+' == cSign || '-' == cSign)
+            {
+                ++mPosition;
+            }
+
+            const size_t cStart{mPosition};
+            long long exponent{0};
+
+            while (mPosition < mFormula.size() && std::isdigit(static_cast<unsigned char>(mFormula[mPosition])))
+            {
+                exponent = exponent * 10 + (mFormula[mPosition] - '0');
+
+                if (exponent > std::numeric_limits<int>::max())
+                {
+                    throwError("exponent out of range");
+                }
+
+                ++mPosition;
+            }
+
+            if (cStart == mPosition)
+            {
+                throwError("integer exponent expected");
+            }
+
+            if (cIsParenthesized)
+            {
+                expect(')');
+            }
+
+            emitOperation(OpCode::POWER, static_cast<int>('-' == cSign ? -exponent : exponent));
+        }
+    }
+
+    void parsePrimary()
+    {
+        const char cNextChar{getNextChar()};
+
+        if ('(' == cNextChar)
+        {
+            ++mPosition;
+            parseExpression();
+            expect(')');
+        }
+        else if (std::isdigit(static_cast<unsigned char>(cNextChar)) || '.' == cNextChar)
+        {
+            const size_t cStart{mPosition};
+
+            while (mPosition < mFormula.size() && (std::isdigit(static_cast<unsigned char>(mFormula[mPosition])) || '.' == mFormula[mPosition]))
+            {
+                ++mPosition;
+            }
+
+            const std::expected<Fraction, FractionError> cLiteral{Fraction::tryParse(std::string_view{mFormula}.substr(cStart, mPosition - cStart))};
+
+            if (!cLiteral)
+            {
+                mPosition = cStart;
+                throwError("invalid number");
+            }
+
+            emitConstant(*cLiteral);
+        }
+        else if (std::isalpha(static_cast<unsigned char>(cNextChar)) || '_' == cNextChar)
+        {
+            const size_t cStart{mPosition};
+
+            while (mPosition < mFormula.size() && (std::isalnum(static_cast<unsigned char>(mFormula[mPosition])) || '_' == mFormula[mPosition]))
+            {
+                ++mPosition;
+            }
+
+            emitVariable(mFormula.substr(cStart, mPosition - cStart), cStart);
+        }
+        else
+        {
+            throwError(mPosition == mFormula.size() ? "unexpected end" : "unexpected character");
+        }
+    }
+
+    void emitConstant(const Fraction& constant)
+    {
+        mCompiledFormula.mInstructions.push_back({OpCode::PUSH_CONSTANT, static_cast<int>(mCompiledFormula.mConstants.size())});
+        mCompiledFormula.mConstants.push_back(constant);
+    }
+
+    void emitVariable(const std::string& variableName, size_t position)
+    {
+        std::vector<std::string>& variableNames{mCompiledFormula.mVariableNames};
+        auto variableIt{std::find(variableNames.cbegin(), variableNames.cend(), variableName)};
+
+        if (variableNames.cend() == variableIt)
+        {
+            if (!mCanAddVariables)
+            {
+                mPosition = position;
+                throwError("unknown variable");
+            }
+
+            variableNames.push_back(variableName);
+            variableIt = variableNames.cend() - 1;
+        }
+
+        mCompiledFormula.mInstructions.push_back({OpCode::PUSH_VARIABLE, static_cast<int>(variableIt - variableNames.cbegin())});
+    }
+
+    // the operations on constants are folded unless they raise a flag (so that the flag is raised by each evaluation)
+    void emitOperation(OpCode opCode, int operand = 0)
+    {
+        std::vector<Instruction>& instructions{mCompiledFormula.mInstructions};
+        const size_t cOperandsCount{OpCode::NEGATE == opCode || OpCode::POWER == opCode ? 1u : 2u};
+
+        const bool cHasConstantOperands{instructions.size() >= cOperandsCount &&
+                                        std::all_of(instructions.cend() - cOperandsCount, instructions.cend(),
+                                                    [](const Instruction& instruction) {return OpCode::PUSH_CONSTANT == instruction.opCode;})};
+
+        if (cHasConstantOperands)
+        {
+            // the constants of the last instructions are the last constants
+            std::vector<Fraction>& constants{mCompiledFormula.mConstants};
+            std::vector<Fraction> stack(constants.cend() - cOperandsCount, constants.cend());
+            FractionContext context;
+
+            const Fraction cResult{*(applyOperation({opCode, operand}, stack.data() + stack.size(), context) - 1)};
+
+            if (!context.hasRaisedFlags())
+            {
+                instructions.resize(instructions.size() - cOperandsCount);
+                constants.resize(constants.size() - cOperandsCount);
+                emitConstant(cResult);
+                return;
+            }
+        }
+
+        instructions.push_back({opCode, operand});
+    }
+
+    char getNextChar()
+    {
+        skipSpaces();
+
+        return mPosition < mFormula.size() ? mFormula[mPosition] : '\0';
+    }
+
+    void skipSpaces()
+    {
+        while (mPosition < mFormula.size() && std::isspace(static_cast<unsigned char>(mFormula[mPosition])))
+        {
+            ++mPosition;
+        }
+    }
+
+    void expect(char character)
+    {
+        if (character != getNextChar())
+        {
+            throwError(std::string{"'"} + character + "' expected");
+        }
+
+        ++mPosition;
+    }
+
+    [[noreturn]] void throwError(const std::string& reason) const
+    {
+        throw std::runtime_error{"Error! Invalid formula: " + reason + " at position " + std::to_string(mPosition)};
+    }
+
+    const std::string& mFormula;
+    size_t mPosition;
+    FractionFormula& mCompiledFormula;
+    const bool mCanAddVariables;
+};
+
+FractionFormula::FractionFormula(const std::string& formula)
+    : mStackDepth{0}
+{
+    Compiler{formula, *this, true}.compile();
+    computeStackDepth();
+}
+
+FractionFormula::FractionFormula(const std::string& formula, const std::vector<std::string>& variableNames)
+    : mVariableNames{variableNames}
+    , mStackDepth{0}
+{
+    Compiler{formula, *this, false}.compile();
+    computeStackDepth();
+}
+
+const std::vector<std::string>& FractionFormula::getVariableNames() const
+{
+    return mVariableNames;
+}
+
+size_t FractionFormula::getVariablesCount() const
+{
+    return mVariableNames.size();
+}
+
+size_t FractionFormula::getInstructionsCount() const
+{
+    return mInstructions.size();
+}
+
+Fraction FractionFormula::evaluate(std::span<const Fraction> variables, FractionContext& context) const
+{
+    thread_local Evaluator tEvaluator;
+    return tEvaluator.evaluate(*this, variables, context);
+}
+
+void FractionFormula::evaluateRows(std::span<const Fraction> rows, std::span<Fraction> results, FractionScheduler& scheduler, FractionContext& context) const
+{
+    if (rows.size() != results.size() * mVariableNames.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    const size_t cVariablesCount{mVariableNames.size()};
+
+    if (results.size() <= scRowsChunkSize)
+    {
+        for (size_t row{0}; row < results.size(); ++row)
+        {
+            results[row] = evaluate(rows.subspan(row * cVariablesCount, cVariablesCount), context);
+        }
+
+        return;
+    }
+
+    std::vector<Evaluator> workerEvaluators(scheduler.getThreadsCount());
+    std::vector<FractionContext> workerContexts(scheduler.getThreadsCount());
+
+    scheduler.parallelFor(results.size(), [this, rows, results, cVariablesCount, &workerEvaluators, &workerContexts](size_t begin, size_t end, size_t workerIndex)
+    {
+        for (size_t row{begin}; row < end; ++row)
+        {
+            results[row] = workerEvaluators[workerIndex].evaluate(*this, rows.subspan(row * cVariablesCount, cVariablesCount), workerContexts[workerIndex]);
+        }
+    }, scRowsChunkSize);
+
+    for (const FractionContext& workerContext : workerContexts)
+    {
+        context.raiseFlags(workerContext.getFlags());
+    }
+}
+
+Fraction FractionFormula::Evaluator::evaluate(const FractionFormula& formula, std::span<const Fraction> variables, FractionContext& context)
+{
+    if (variables.size() != formula.mVariableNames.size())
+    {
+        throw std::runtime_error{"Error! Incompatible number of variables"};
+    }
+
+    if (mStack.size() < formula.mStackDepth)
+    {
+        mStack.resize(formula.mStackDepth);
+    }
+
+    Fraction* const cStackBegin{mStack.data()};
+    Fraction* stackEnd{cStackBegin};
+
+    for (const Instruction& instruction : formula.mInstructions)
+    {
+        switch (instruction.opCode)
+        {
+        case OpCode::PUSH_CONSTANT:
+            *stackEnd++ = formula.mConstants[instruction.operand];
+            break;
+        case OpCode::PUSH_VARIABLE:
+            *stackEnd++ = variables[instruction.operand];
+            break;
+        default:
+            stackEnd = applyOperation(instruction, stackEnd, context);
+            break;
+        }
+    }
+
+    return *cStackBegin;
+}
+
+void FractionFormula::computeStackDepth()
+{
+    size_t depth{0};
+
+    for (const Instruction& instruction : mInstructions)
+    {
+        switch (instruction.opCode)
+        {
+        case OpCode::PUSH_CONSTANT:
+        case OpCode::PUSH_VARIABLE:
+            mStackDepth = std::max(mStackDepth, ++depth);
+            break;
+        case OpCode::NEGATE:
+        case OpCode::POWER:
+            break;
+        default:
+            --depth;
+            break;
+        }
+    }
+}
+
+Fraction* FractionFormula::applyOperation(const Instruction& instruction, Fraction* stackEnd, FractionContext& context)
+{
+    Fraction& last{*(stackEnd - 1)};
+
+    switch (instruction.opCode)
+    {
+    case OpCode::ADD:
+        *(stackEnd - 2) = context.add(*(stackEnd - 2), last);
+        break;
+    case OpCode::SUBTRACT:
+        *(stackEnd - 2) = context.subtract(*(stackEnd - 2), last);
+        break;
+    case OpCode::MULTIPLY:
+        *(stackEnd - 2) = context.multiply(*(stackEnd - 2), last);
+        break;
+    case OpCode::DIVIDE:
+        *(stackEnd - 2) = context.divide(*(stackEnd - 2), last);
+        break;
+    case OpCode::POWER:
+        last = power(last, instruction.operand, context);
+        return stackEnd;
+    case OpCode::NEGATE:
+        last = context.subtract(Fraction{}, last);
+        return stackEnd;
+    default:
+        throw std::runtime_error{"Error! Invalid formula instruction"};
+    }
+
+    // binary operation, the result replaced the first operand
+    return stackEnd - 1;
+}
+
+Fraction FractionFormula::power(const Fraction& base, int exponent, FractionContext& context)
+{
+    // square and multiply, the negative exponents invert the result
+    Fraction result{1};
+    Fraction square{base};
+
+    for (long long remainingExponent{std::llabs(exponent)}; 0 != remainingExponent; remainingExponent >>= 1)
+    {
+        if (0 != (remainingExponent & 1))
+        {
+            result = context.multiply(result, square);
+        }
+
+        if (remainingExponent > 1)
+        {
+            square = context.multiply(square, square);
+        }
+    }
+
+    return exponent < 0 ? context.inverse(result) : result;
+}
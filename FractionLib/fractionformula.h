@@ -0,0 +1,88 @@
+#ifndef FRACTIONFORMULA_H
+#define FRACTIONFORMULA_H
+
+#include <span>
+#include <string>
+#include <vector>
+
+#include "fraction.h"
+#include "fractioncontext.h"
+#include "fractionscheduler.h"
+
+/* Formula with variables (e.g. "1/2 + 3/4 * (x - 0.25)") compiled once into a postfix bytecode and evaluated many times
+   - syntax: integer and decimal literals, variable names ([A-Za-z_][A-Za-z0-9_]*), parentheses, + - * / (binary and unary +/-)
+     and ^ with an optionally signed integer literal exponent (e.g. x^2, x^-1, x^(-3)); ^ binds tighter than the unary minus
+   - the literals are parsed and normalized at compile time and the constant subexpressions are folded (so "1/2" is a single constant)
+   - the evaluation never throws on invalid values: the errors raise the sticky flags of the context (see FractionContext)
+   - invalid formulas throw at compile time
+*/
+class FractionFormula
+{
+public:
+    /* Reusable evaluation stack, the evaluations don't allocate once it has grown to the depth required by the formula
+       (each thread evaluating through FractionFormula::evaluate() uses its own evaluator)
+    */
+    class Evaluator
+    {
+    public:
+        Fraction evaluate(const FractionFormula& formula, std::span<const Fraction> variables, FractionContext& context);
+
+    private:
+        std::vector<Fraction> mStack;
+    };
+
+    // constructors
+    explicit FractionFormula(const std::string& formula);    // the variables are indexed in the order of their first occurrence
+
+    // the variables are indexed as given (unknown variables are compile errors)
+    FractionFormula(const std::string& formula, const std::vector<std::string>& variableNames);
+
+    // getters
+    const std::vector<std::string>& getVariableNames() const;
+    size_t getVariablesCount() const;
+    size_t getInstructionsCount() const;
+
+    // evaluation for a single set of variable values (indexed like getVariableNames())
+    Fraction evaluate(std::span<const Fraction> variables, FractionContext& context = FractionContext::getThreadContext()) const;
+
+    /* Evaluates the rows (getVariablesCount() values each, stored row after row) distributed among the scheduler workers
+       (small batches are evaluated by the calling thread); each worker has its own evaluator and context, the raised flags are merged into the given context
+    */
+    void evaluateRows(std::span<const Fraction> rows, std::span<Fraction> results, FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler(),
+                      FractionContext& context = FractionContext::getThreadContext()) const;
+
+private:
+    enum class OpCode : unsigned short
+    {
+        PUSH_CONSTANT = 0,
+        PUSH_VARIABLE,
+        ADD,
+        SUBTRACT,
+        MULTIPLY,
+        DIVIDE,
+        POWER,
+        NEGATE
+    };
+
+    struct Instruction
+    {
+        OpCode opCode;
+        int operand;        // constant index, variable index or exponent
+    };
+
+    // recursive descent parser emitting the bytecode (defined in the source file)
+    class Compiler;
+
+    void computeStackDepth();
+
+    // applies an operation (any instruction except the pushes) to the top of the stack ending at stackEnd, returns the new end of the stack
+    static Fraction* applyOperation(const Instruction& instruction, Fraction* stackEnd, FractionContext& context);
+    static Fraction power(const Fraction& base, int exponent, FractionContext& context);
+
+    std::vector<Instruction> mInstructions;
+    std::vector<Fraction> mConstants;
+    std::vector<std::string> mVariableNames;
+    size_t mStackDepth;
+};
+
+#endif // FRACTIONFORMULA_H
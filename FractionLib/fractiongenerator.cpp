@@ -0,0 +1,34 @@
+#include <string>
+
+#include "fractiongenerator.h"
+
+Generator<Fraction> readFractions(std::istream& inputStream, FractionContext& context)
+{
+    // getline() reuses the capacity of the buffer, so no allocation is made once it fits the longest line
+    std::string line;
+
+    while (std::getline(inputStream, line))
+    {
+        // files written on Windows
+        if (!line.empty() && '\r' == line.back())
+        {
+            line.pop_back();
+        }
+
+        if (line.empty())
+        {
+            continue;
+        }
+
+        const std::expected<Fraction, FractionError> cFraction{Fraction::tryParse(line)};
+
+        if (cFraction)
+        {
+            co_yield *cFraction;
+        }
+        else
+        {
+            context.raise(cFraction.error());
+        }
+    }
+}
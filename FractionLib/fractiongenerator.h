@@ -0,0 +1,246 @@
+#ifndef FRACTIONGENERATOR_H
+#define FRACTIONGENERATOR_H
+
+#include <span>
+#include <vector>
+#include <istream>
+#include <utility>
+#include <iterator>
+#include <exception>
+#include <coroutine>
+#include <type_traits>
+
+#include "fraction.h"
+#include "fractioncontext.h"
+
+/* Lazy sequence produced by a coroutine (minimal replacement of the C++23 std::generator, which is not available in all standard libraries)
+   - the values are produced one by one when iterating, a yielded value is referenced (not copied) and stays valid until the next increment
+   - single pass, move only; the exceptions thrown by the coroutine are rethrown by the iterator
+*/
+template<typename T>
+class Generator
+{
+public:
+    struct promise_type
+    {
+        const T* value{nullptr};
+        std::exception_ptr exceptionPtr;
+
+        Generator get_return_object()
+        {
+            return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        // the yielded temporaries live until the coroutine is resumed
+        std::suspend_always yield_value(const T& yieldedValue) noexcept
+        {
+            value = std::addressof(yieldedValue);
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception()
+        {
+            exceptionPtr = std::current_exception();
+        }
+    };
+
+    class Iterator
+    {
+    public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator()
+            : mHandle{nullptr}
+        {
+        }
+
+        explicit Iterator(std::coroutine_handle<promise_type> handle)
+            : mHandle{handle}
+        {
+        }
+
+        const T& operator*() const
+        {
+            return *mHandle.promise().value;
+        }
+
+        const T* operator->() const
+        {
+            return mHandle.promise().value;
+        }
+
+        Iterator& operator++()
+        {
+            resume(mHandle);
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool operator==(std::default_sentinel_t) const
+        {
+            return !mHandle || mHandle.done();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> mHandle;
+    };
+
+    // constructors
+    Generator(Generator&& generator) noexcept
+        : mHandle{std::exchange(generator.mHandle, nullptr)}
+    {
+    }
+
+    Generator& operator=(Generator&& generator) noexcept
+    {
+        if (this != &generator)
+        {
+            destroy();
+            mHandle = std::exchange(generator.mHandle, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~Generator()
+    {
+        destroy();
+    }
+
+    // produces the first value, can only be called once
+    Iterator begin()
+    {
+        resume(mHandle);
+        return Iterator{mHandle};
+    }
+
+    std::default_sentinel_t end() const
+    {
+        return std::default_sentinel;
+    }
+
+private:
+    explicit Generator(std::coroutine_handle<promise_type> handle)
+        : mHandle{handle}
+    {
+    }
+
+    static void resume(std::coroutine_handle<promise_type> handle)
+    {
+        if (handle && !handle.done())
+        {
+            handle.resume();
+
+            if (handle.promise().exceptionPtr)
+            {
+                std::rethrow_exception(std::exchange(handle.promise().exceptionPtr, nullptr));
+            }
+        }
+    }
+
+    void destroy()
+    {
+        if (mHandle)
+        {
+            mHandle.destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> mHandle;
+};
+
+/* Reads one fraction per line (same formats as the Fraction string constructor) reusing a single line buffer;
+   the empty lines are skipped, the invalid ones too (raising their error flag in the context)
+*/
+Generator<Fraction> readFractions(std::istream& inputStream, FractionContext& context = FractionContext::getThreadContext());
+
+/* Pipeline stages, each one consumes its source lazily and keeps a bounded state, so unbounded streams are processed in constant memory
+*/
+
+// the values for which predicate(value) is true
+template<typename T, typename Predicate>
+Generator<T> filter(Generator<T> source, Predicate predicate)
+{
+    for (const T& value : source)
+    {
+        if (predicate(value))
+        {
+            co_yield value;
+        }
+    }
+}
+
+// function(value) for each value
+template<typename T, typename Function>
+Generator<std::remove_cvref_t<std::invoke_result_t<Function&, const T&>>> transform(Generator<T> source, Function function)
+{
+    for (const T& value : source)
+    {
+        co_yield function(value);
+    }
+}
+
+/* Sliding windows of the last size values (the first one once size values are read, then one per value), a window is valid until the next increment;
+   the values are kept in a buffer of 2 * size elements, the last size - 1 of them being moved to the front when it is full
+*/
+template<typename T>
+Generator<std::span<const T>> window(Generator<T> source, size_t size)
+{
+    if (0 == size)
+    {
+        co_return;
+    }
+
+    std::vector<T> buffer;
+    buffer.reserve(2 * size);
+
+    for (const T& value : source)
+    {
+        if (buffer.size() == 2 * size)
+        {
+            buffer.erase(buffer.begin(), buffer.end() - (size - 1));
+        }
+
+        buffer.push_back(value);
+
+        if (buffer.size() >= size)
+        {
+            co_yield std::span<const T>{buffer.data() + buffer.size() - size, size};
+        }
+    }
+}
+
+// consumes the source, result = operation(result, value) for each value
+template<typename T, typename Result, typename Operation>
+Result reduce(Generator<T> source, Result initialValue, Operation operation)
+{
+    Result result{std::move(initialValue)};
+
+    for (const T& value : source)
+    {
+        result = operation(std::move(result), value);
+    }
+
+    return result;
+}
+
+#endif // FRACTIONGENERATOR_H
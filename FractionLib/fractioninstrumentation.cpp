@@ -0,0 +1,289 @@
+#include <bit>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+
+#include "fractioninstrumentation.h"
+
+// intermediate terms from this magnitude on are reported as near overflows (one more bit and they no longer fit into int)
+static constexpr long long scNearOverflowMagnitude{1LL << 30};
+
+static constexpr const char* scCounterNames[FractionInstrumentation::scCountersCount]{
+    "normalize_calls", "normalize_reductions", "gcd_calls", "parse_calls", "parse_failures", "near_overflows", "checked_overflows",
+    "zero_operand_hits", "unit_operand_hits", "integer_operand_hits", "same_denominator_hits", "general_arithmetic_paths"
+};
+
+static constexpr const char* scHistogramNames[FractionInstrumentation::scHistogramsCount]{
+    "gcd_iterations", "intermediate_terms"
+};
+
+#ifdef FRACTIONLIB_INSTRUMENTATION
+
+// per thread storage, written only by its thread (so a relaxed load + store is enough for incrementing) and read by the snapshots
+struct ThreadCounters
+{
+    std::array<std::atomic<uint64_t>, FractionInstrumentation::scCountersCount> counters{};
+    std::array<std::array<std::atomic<uint64_t>, FractionInstrumentation::scBucketsCount>, FractionInstrumentation::scHistogramsCount> buckets{};
+    std::array<std::atomic<uint64_t>, FractionInstrumentation::scHistogramsCount> sums{};
+};
+
+/* The blocks of the running threads, the totals of the finished threads and the totals at the last reset (subtracted from each snapshot,
+   so that the reset never writes into the blocks owned by other threads)
+*/
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<const ThreadCounters*> threadCounters;
+    FractionInstrumentation::Snapshot finishedThreadsTotals;
+    FractionInstrumentation::Snapshot resetTotals;
+};
+
+// never destroyed, the threads might finish after the static objects are gone
+static Registry& getRegistry()
+{
+    static Registry* const scRegistry{new Registry};
+    return *scRegistry;
+}
+
+static void addThreadCounters(FractionInstrumentation::Snapshot& snapshot, const ThreadCounters& threadCounters)
+{
+    for (size_t counter{0}; counter < FractionInstrumentation::scCountersCount; ++counter)
+    {
+        snapshot.counters[counter] += threadCounters.counters[counter].load(std::memory_order_relaxed);
+    }
+
+    for (size_t histogram{0}; histogram < FractionInstrumentation::scHistogramsCount; ++histogram)
+    {
+        for (size_t bucket{0}; bucket < FractionInstrumentation::scBucketsCount; ++bucket)
+        {
+            snapshot.histograms[histogram].buckets[bucket] += threadCounters.buckets[histogram][bucket].load(std::memory_order_relaxed);
+        }
+
+        snapshot.histograms[histogram].sum += threadCounters.sums[histogram].load(std::memory_order_relaxed);
+    }
+}
+
+// totals since the start of the program, the registry mutex should be locked
+static FractionInstrumentation::Snapshot getTotals(const Registry& registry)
+{
+    FractionInstrumentation::Snapshot totals{registry.finishedThreadsTotals};
+
+    for (const ThreadCounters* threadCounters : registry.threadCounters)
+    {
+        addThreadCounters(totals, *threadCounters);
+    }
+
+    return totals;
+}
+
+class ThreadCountersOwner
+{
+public:
+    ThreadCountersOwner()
+    {
+        Registry& registry{getRegistry()};
+        const std::lock_guard<std::mutex> cLock{registry.mutex};
+
+        registry.threadCounters.push_back(&mThreadCounters);
+    }
+
+    ~ThreadCountersOwner()
+    {
+        Registry& registry{getRegistry()};
+        const std::lock_guard<std::mutex> cLock{registry.mutex};
+
+        addThreadCounters(registry.finishedThreadsTotals, mThreadCounters);
+        registry.threadCounters.erase(std::find(registry.threadCounters.begin(), registry.threadCounters.end(), &mThreadCounters));
+    }
+
+    ThreadCounters& getThreadCounters()
+    {
+        return mThreadCounters;
+    }
+
+private:
+    ThreadCounters mThreadCounters;
+};
+
+static ThreadCounters& getThreadCounters()
+{
+    thread_local ThreadCountersOwner tOwner;
+    return tOwner.getThreadCounters();
+}
+
+static void increment(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+#endif
+
+uint64_t FractionInstrumentation::HistogramValues::getCount() const
+{
+    uint64_t count{0};
+
+    for (const uint64_t bucketCount : buckets)
+    {
+        count += bucketCount;
+    }
+
+    return count;
+}
+
+uint64_t FractionInstrumentation::Snapshot::getCounter(Counter counter) const
+{
+    return counters[static_cast<size_t>(counter)];
+}
+
+const FractionInstrumentation::HistogramValues& FractionInstrumentation::Snapshot::getHistogram(Histogram histogram) const
+{
+    return histograms[static_cast<size_t>(histogram)];
+}
+
+std::string FractionInstrumentation::Snapshot::toJson() const
+{
+    std::ostringstream json;
+
+    json << "{\"enabled\":" << (isEnabled() ? "true" : "false") << ",\"counters\":{";
+
+    for (size_t counter{0}; counter < scCountersCount; ++counter)
+    {
+        json << (0 == counter ? "" : ",") << "\"" << scCounterNames[counter] << "\":" << counters[counter];
+    }
+
+    json << "},\"histograms\":{";
+
+    for (size_t histogram{0}; histogram < scHistogramsCount; ++histogram)
+    {
+        json << (0 == histogram ? "" : ",") << "\"" << scHistogramNames[histogram] << "\":{\"count\":" << histograms[histogram].getCount()
+             << ",\"sum\":" << histograms[histogram].sum << ",\"buckets\":[";
+
+        for (size_t bucket{0}; bucket < scBucketsCount; ++bucket)
+        {
+            json << (0 == bucket ? "" : ",") << histograms[histogram].buckets[bucket];
+        }
+
+        json << "]}";
+    }
+
+    json << "}}";
+
+    return json.str();
+}
+
+std::string FractionInstrumentation::Snapshot::toPrometheusText() const
+{
+    std::ostringstream text;
+
+    for (size_t counter{0}; counter < scCountersCount; ++counter)
+    {
+        text << "# TYPE fractionlib_" << scCounterNames[counter] << "_total counter\n"
+             << "fractionlib_" << scCounterNames[counter] << "_total " << counters[counter] << "\n";
+    }
+
+    for (size_t histogram{0}; histogram < scHistogramsCount; ++histogram)
+    {
+        const std::string cName{std::string{"fractionlib_"} + scHistogramNames[histogram]};
+        uint64_t cumulativeCount{0};
+
+        text << "# TYPE " << cName << " histogram\n";
+
+        // the cumulative "le" buckets end at 2^i - 1 (inclusive), the last bucket is open
+        for (size_t bucket{0}; bucket + 1 < scBucketsCount; ++bucket)
+        {
+            cumulativeCount += histograms[histogram].buckets[bucket];
+            text << cName << "_bucket{le=\"" << (1ULL << bucket) - 1 << "\"} " << cumulativeCount << "\n";
+        }
+
+        cumulativeCount += histograms[histogram].buckets[scBucketsCount - 1];
+        text << cName << "_bucket{le=\"+Inf\"} " << cumulativeCount << "\n"
+             << cName << "_sum " << histograms[histogram].sum << "\n"
+             << cName << "_count " << cumulativeCount << "\n";
+    }
+
+    return text.str();
+}
+
+FractionInstrumentation::Snapshot FractionInstrumentation::getSnapshot()
+{
+    Snapshot snapshot;
+
+#ifdef FRACTIONLIB_INSTRUMENTATION
+    Registry& registry{getRegistry()};
+    const std::lock_guard<std::mutex> cLock{registry.mutex};
+
+    snapshot = getTotals(registry);
+
+    for (size_t counter{0}; counter < scCountersCount; ++counter)
+    {
+        snapshot.counters[counter] -= registry.resetTotals.counters[counter];
+    }
+
+    for (size_t histogram{0}; histogram < scHistogramsCount; ++histogram)
+    {
+        for (size_t bucket{0}; bucket < scBucketsCount; ++bucket)
+        {
+            snapshot.histograms[histogram].buckets[bucket] -= registry.resetTotals.histograms[histogram].buckets[bucket];
+        }
+
+        snapshot.histograms[histogram].sum -= registry.resetTotals.histograms[histogram].sum;
+    }
+#endif
+
+    return snapshot;
+}
+
+void FractionInstrumentation::reset()
+{
+#ifdef FRACTIONLIB_INSTRUMENTATION
+    Registry& registry{getRegistry()};
+    const std::lock_guard<std::mutex> cLock{registry.mutex};
+
+    registry.resetTotals = getTotals(registry);
+#endif
+}
+
+void FractionInstrumentation::countEvent([[maybe_unused]] Counter counter)
+{
+#ifdef FRACTIONLIB_INSTRUMENTATION
+    increment(getThreadCounters().counters[static_cast<size_t>(counter)], 1);
+#endif
+}
+
+void FractionInstrumentation::recordValue([[maybe_unused]] Histogram histogram, [[maybe_unused]] uint64_t value)
+{
+#ifdef FRACTIONLIB_INSTRUMENTATION
+    ThreadCounters& threadCounters{getThreadCounters()};
+    const size_t cBucket{std::min(static_cast<size_t>(std::bit_width(value)), scBucketsCount - 1)};
+
+    increment(threadCounters.buckets[static_cast<size_t>(histogram)][cBucket], 1);
+    increment(threadCounters.sums[static_cast<size_t>(histogram)], value);
+#endif
+}
+
+void FractionInstrumentation::recordIntermediateTerms([[maybe_unused]] long long numerator, [[maybe_unused]] long long denominator)
+{
+#ifdef FRACTIONLIB_INSTRUMENTATION
+    const long long cMagnitude{std::max(std::llabs(numerator), std::llabs(denominator))};
+
+    recordValue(Histogram::INTERMEDIATE_TERMS, static_cast<uint64_t>(cMagnitude));
+
+    if (cMagnitude >= scNearOverflowMagnitude)
+    {
+        countEvent(Counter::NEAR_OVERFLOWS);
+    }
+#endif
+}
+
+const char* FractionInstrumentation::getCounterName(Counter counter)
+{
+    return scCounterNames[static_cast<size_t>(counter)];
+}
+
+const char* FractionInstrumentation::getHistogramName(Histogram histogram)
+{
+    return scHistogramNames[static_cast<size_t>(histogram)];
+}
@@ -0,0 +1,99 @@
+#ifndef FRACTIONINSTRUMENTATION_H
+#define FRACTIONINSTRUMENTATION_H
+
+#include <array>
+#include <string>
+#include <cstdint>
+
+/* Performance counters and histograms for the hot spots of the library (normalization, GCD, parsing, term growth)
+   - enabled by defining FRACTIONLIB_INSTRUMENTATION (CMake option of the same name), otherwise the recording macros expand to nothing
+     and the snapshots are always empty
+   - each thread records into its own block of counters (relaxed atomic loads/stores, no locks, no shared cache lines);
+     a snapshot sums up the blocks of all threads, including the threads that already finished
+   - histogram bucket i counts the values with a bit width of i, i.e. the values in [2^(i-1), 2^i - 1] (bucket 0 holds the zeros, the last one is open)
+*/
+class FractionInstrumentation
+{
+public:
+    enum class Counter : unsigned short
+    {
+        NORMALIZE_CALLS = 0,
+        NORMALIZE_REDUCTIONS,   // normalizations that actually divided by a GCD larger than 1
+        GCD_CALLS,
+        PARSE_CALLS,
+        PARSE_FAILURES,
+        NEAR_OVERFLOWS,         // intermediate terms of Fraction arithmetic reaching 2^30 in magnitude (possibly overflowing)
+        CHECKED_OVERFLOWS,      // 64 bit overflows detected by CheckedFraction
+        ZERO_OPERAND_HITS,      // Fraction additions/multiplications/divisions taking the fast paths of the operand shapes (see Fraction::add())
+        UNIT_OPERAND_HITS,
+        INTEGER_OPERAND_HITS,
+        SAME_DENOMINATOR_HITS,
+        GENERAL_ARITHMETIC_PATHS,
+        COUNTERS_COUNT
+    };
+
+    enum class Histogram : unsigned short
+    {
+        GCD_ITERATIONS = 0,     // Euclid steps per GCD computation
+        INTERMEDIATE_TERMS,     // largest intermediate term magnitude of each Fraction addition/multiplication/division
+        HISTOGRAMS_COUNT
+    };
+
+    static constexpr size_t scCountersCount{static_cast<size_t>(Counter::COUNTERS_COUNT)};
+    static constexpr size_t scHistogramsCount{static_cast<size_t>(Histogram::HISTOGRAMS_COUNT)};
+    static constexpr size_t scBucketsCount{34};
+
+    struct HistogramValues
+    {
+        std::array<uint64_t, scBucketsCount> buckets{};
+        uint64_t sum{0};
+
+        uint64_t getCount() const;
+    };
+
+    struct Snapshot
+    {
+        std::array<uint64_t, scCountersCount> counters{};
+        std::array<HistogramValues, scHistogramsCount> histograms{};
+
+        uint64_t getCounter(Counter counter) const;
+        const HistogramValues& getHistogram(Histogram histogram) const;
+
+        // export formats
+        std::string toJson() const;
+        std::string toPrometheusText() const;
+    };
+
+    static constexpr bool isEnabled()
+    {
+#ifdef FRACTIONLIB_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // counts recorded by all threads since the last reset
+    static Snapshot getSnapshot();
+    static void reset();
+
+    // recording functions, use the macros below so that nothing is compiled when the instrumentation is disabled
+    static void countEvent(Counter counter);
+    static void recordValue(Histogram histogram, uint64_t value);
+    static void recordIntermediateTerms(long long numerator, long long denominator);
+
+    static const char* getCounterName(Counter counter);
+    static const char* getHistogramName(Histogram histogram);
+};
+
+#ifdef FRACTIONLIB_INSTRUMENTATION
+#define FRACTION_COUNT_EVENT(counter) FractionInstrumentation::countEvent(FractionInstrumentation::Counter::counter)
+#define FRACTION_RECORD_VALUE(histogram, value) FractionInstrumentation::recordValue(FractionInstrumentation::Histogram::histogram, value)
+#define FRACTION_RECORD_INTERMEDIATE_TERMS(numerator, denominator) FractionInstrumentation::recordIntermediateTerms(numerator, denominator)
+#else
+#define FRACTION_COUNT_EVENT(counter) ((void)0)
+#define FRACTION_RECORD_VALUE(histogram, value) ((void)0)
+#define FRACTION_RECORD_INTERMEDIATE_TERMS(numerator, denominator) ((void)0)
+#endif
+
+#endif // FRACTIONINSTRUMENTATION_H
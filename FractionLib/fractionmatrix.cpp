@@ -0,0 +1,397 @@
+#include <algorithm>
+
+#include "fractionmatrix.h"
+#include "checkedfraction.h"
+
+using WideIntegerRows = std::vector<std::vector<WideInteger>>;
+
+/* Scales a row of fractions by the least common multiple of their denominators, so all elements become integers
+*/
+static std::vector<WideInteger> createIntegerRow(const std::vector<Fraction>& fractions, WideInteger& rowMultiplier)
+{
+    std::vector<WideInteger> integerRow;
+    integerRow.reserve(fractions.size());
+
+    rowMultiplier = WideInteger{1};
+
+    for (const Fraction& fraction : fractions)
+    {
+        rowMultiplier = WideInteger::getLeastCommonMultiple(rowMultiplier, WideInteger{fraction.getDenominator()});
+    }
+
+    for (const Fraction& fraction : fractions)
+    {
+        integerRow.push_back(WideInteger{fraction.getNumerator()} * (rowMultiplier / WideInteger{fraction.getDenominator()}));
+    }
+
+    return integerRow;
+}
+
+/* Builds the integer rows of the matrix augmented with the columns of the given matrix (if any),
+   the product of the row multipliers is returned through multipliersProduct
+*/
+static WideIntegerRows createIntegerRows(const FractionMatrix& matrix, const FractionMatrix* augmentation, WideInteger& multipliersProduct)
+{
+    WideIntegerRows integerRows;
+    integerRows.reserve(matrix.getRowsCount());
+
+    multipliersProduct = WideInteger{1};
+
+    for (size_t row{0}; row < matrix.getRowsCount(); ++row)
+    {
+        std::vector<Fraction> fractions;
+        fractions.reserve(matrix.getColumnsCount() + (augmentation ? augmentation->getColumnsCount() : 0u));
+
+        for (size_t column{0}; column < matrix.getColumnsCount(); ++column)
+        {
+            fractions.push_back(matrix(row, column));
+        }
+
+        for (size_t column{0}; augmentation && column < augmentation->getColumnsCount(); ++column)
+        {
+            fractions.push_back((*augmentation)(row, column));
+        }
+
+        WideInteger rowMultiplier;
+        integerRows.push_back(createIntegerRow(fractions, rowMultiplier));
+        multipliersProduct *= rowMultiplier;
+    }
+
+    return integerRows;
+}
+
+/* Fraction-free (Bareiss) forward elimination restricted to the first eliminatedColumnsCount columns: after each step the entries are minors
+   of the original matrix so the division by the previous pivot is always exact; returns the pivot columns (their count is the rank)
+*/
+static std::vector<size_t> eliminate(WideIntegerRows& rows, size_t eliminatedColumnsCount, bool& isDeterminantNegated)
+{
+    std::vector<size_t> pivotColumns;
+    WideInteger previousPivot{1};
+    const size_t cColumnsCount{rows.empty() ? 0u : rows[0].size()};
+
+    isDeterminantNegated = false;
+
+    for (size_t column{0}; column < eliminatedColumnsCount && pivotColumns.size() < rows.size(); ++column)
+    {
+        const size_t cPivotRow{pivotColumns.size()};
+        size_t selectedRow{rows.size()};
+
+        // the shortest pivot keeps the products of the next step cheaper
+        for (size_t row{cPivotRow}; row < rows.size(); ++row)
+        {
+            if (!rows[row][column].isZero() && (rows.size() == selectedRow || rows[row][column].getBitLength() < rows[selectedRow][column].getBitLength()))
+            {
+                selectedRow = row;
+            }
+        }
+
+        if (rows.size() == selectedRow)
+        {
+            continue;
+        }
+
+        if (selectedRow != cPivotRow)
+        {
+            std::swap(rows[selectedRow], rows[cPivotRow]);
+            isDeterminantNegated = !isDeterminantNegated;
+        }
+
+        const std::vector<WideInteger>& cPivotRowElements{rows[cPivotRow]};
+        const WideInteger& cPivot{cPivotRowElements[column]};
+
+        for (size_t row{cPivotRow + 1}; row < rows.size(); ++row)
+        {
+            std::vector<WideInteger>& currentRowElements{rows[row]};
+            const WideInteger cFactor{currentRowElements[column]};
+
+            for (size_t currentColumn{column + 1}; currentColumn < cColumnsCount; ++currentColumn)
+            {
+                currentRowElements[currentColumn] = (cPivot * currentRowElements[currentColumn] - cFactor * cPivotRowElements[currentColumn]) / previousPivot;
+            }
+
+            currentRowElements[column] = WideInteger{};
+        }
+
+        previousPivot = cPivot;
+        pivotColumns.push_back(column);
+    }
+
+    return pivotColumns;
+}
+
+/* Solves the square integer system stored in the first columns of the rows for each right hand side stored in the remaining columns;
+   back substitution is fraction-free as well: det * x is an integer vector (Cramer) so all divisions are exact
+*/
+static std::vector<std::vector<WideFraction>> solveIntegerSystem(WideIntegerRows& rows)
+{
+    const size_t cUnknownsCount{rows.size()};
+    const size_t cRightHandSidesCount{cUnknownsCount > 0 ? rows[0].size() - cUnknownsCount : 0u};
+
+    bool isDeterminantNegated;
+
+    if (eliminate(rows, cUnknownsCount, isDeterminantNegated).size() < cUnknownsCount)
+    {
+        throw std::runtime_error{"Error! Matrix is singular"};
+    }
+
+    std::vector<std::vector<WideFraction>> solutions(cRightHandSidesCount, std::vector<WideFraction>(cUnknownsCount));
+
+    if (cUnknownsCount > 0)
+    {
+        const WideInteger cDeterminant{rows[cUnknownsCount - 1][cUnknownsCount - 1]};
+        std::vector<WideInteger> scaledSolution(cUnknownsCount);
+
+        for (size_t rightHandSide{0}; rightHandSide < cRightHandSidesCount; ++rightHandSide)
+        {
+            const size_t cColumn{cUnknownsCount + rightHandSide};
+
+            for (size_t row{cUnknownsCount}; row > 0; --row)
+            {
+                const size_t cRow{row - 1};
+                WideInteger sum{cDeterminant * rows[cRow][cColumn]};
+
+                for (size_t column{cRow + 1}; column < cUnknownsCount; ++column)
+                {
+                    sum -= rows[cRow][column] * scaledSolution[column];
+                }
+
+                scaledSolution[cRow] = sum / rows[cRow][cRow];
+                solutions[rightHandSide][cRow] = WideFraction{scaledSolution[cRow], cDeterminant};
+            }
+        }
+    }
+
+    return solutions;
+}
+
+FractionMatrix::FractionMatrix()
+    : BlockedMatrix<Fraction>{}
+{
+}
+
+FractionMatrix::FractionMatrix(size_t rowsCount, size_t columnsCount)
+    : BlockedMatrix<Fraction>{rowsCount, columnsCount}
+{
+}
+
+FractionMatrix::FractionMatrix(std::initializer_list<std::initializer_list<Fraction>> rows)
+    : BlockedMatrix<Fraction>{rows.size(), rows.size() > 0 ? rows.begin()->size() : 0u}
+{
+    size_t row{0};
+
+    for (const std::initializer_list<Fraction>& rowElements : rows)
+    {
+        if (rowElements.size() != mColumnsCount)
+        {
+            throw std::runtime_error{"Error! Matrix rows have different sizes"};
+        }
+
+        size_t column{0};
+
+        for (const Fraction& element : rowElements)
+        {
+            (*this)(row, column) = element;
+            ++column;
+        }
+
+        ++row;
+    }
+}
+
+WideFraction FractionMatrix::getDeterminant() const
+{
+    if (mRowsCount != mColumnsCount)
+    {
+        throw std::runtime_error{"Error! Matrix is not square"};
+    }
+
+    WideFraction determinant{WideInteger{1}};
+
+    if (mRowsCount > 0)
+    {
+        WideInteger multipliersProduct;
+        WideIntegerRows integerRows{createIntegerRows(*this, nullptr, multipliersProduct)};
+        bool isDeterminantNegated;
+
+        if (eliminate(integerRows, mColumnsCount, isDeterminantNegated).size() < mRowsCount)
+        {
+            determinant = WideFraction{};
+        }
+        else
+        {
+            const WideInteger& cLastPivot{integerRows[mRowsCount - 1][mColumnsCount - 1]};
+            determinant = WideFraction{isDeterminantNegated ? -cLastPivot : cLastPivot, multipliersProduct};
+        }
+    }
+
+    return determinant;
+}
+
+size_t FractionMatrix::getRank() const
+{
+    WideInteger multipliersProduct;
+    WideIntegerRows integerRows{createIntegerRows(*this, nullptr, multipliersProduct)};
+    bool isDeterminantNegated;
+
+    const size_t cRank{eliminate(integerRows, mColumnsCount, isDeterminantNegated).size()};
+
+    return cRank;
+}
+
+WideFractionMatrix FractionMatrix::getInverse() const
+{
+    if (mRowsCount != mColumnsCount)
+    {
+        throw std::runtime_error{"Error! Matrix is not square"};
+    }
+
+    // each row is scaled together with the identity row, so solving M * X = S (S: row multipliers) directly yields the inverse
+    const FractionMatrix cIdentityMatrix{createIdentityMatrix(mRowsCount)};
+    WideInteger multipliersProduct;
+    WideIntegerRows integerRows{createIntegerRows(*this, &cIdentityMatrix, multipliersProduct)};
+
+    const std::vector<std::vector<WideFraction>> cSolutions{solveIntegerSystem(integerRows)};
+    WideFractionMatrix inverse{mRowsCount, mColumnsCount};
+
+    for (size_t column{0}; column < cSolutions.size(); ++column)
+    {
+        for (size_t row{0}; row < mRowsCount; ++row)
+        {
+            inverse(row, column) = cSolutions[column][row];
+        }
+    }
+
+    return inverse;
+}
+
+std::vector<WideFraction> FractionMatrix::solve(const std::vector<Fraction>& rightHandSide) const
+{
+    if (mRowsCount != mColumnsCount)
+    {
+        throw std::runtime_error{"Error! Matrix is not square"};
+    }
+
+    if (rightHandSide.size() != mRowsCount)
+    {
+        throw std::runtime_error{"Error! Incompatible matrix sizes"};
+    }
+
+    FractionMatrix rightHandSideColumn{mRowsCount, 1};
+
+    for (size_t row{0}; row < mRowsCount; ++row)
+    {
+        rightHandSideColumn(row, 0) = rightHandSide[row];
+    }
+
+    WideInteger multipliersProduct;
+    WideIntegerRows integerRows{createIntegerRows(*this, &rightHandSideColumn, multipliersProduct)};
+
+    std::vector<std::vector<WideFraction>> solutions{solveIntegerSystem(integerRows)};
+
+    return solutions.empty() ? std::vector<WideFraction>{} : std::move(solutions[0]);
+}
+
+WideFractionMatrix FractionMatrix::multiply(const FractionMatrix& matrix, FractionScheduler& scheduler) const
+{
+    if (mColumnsCount != matrix.mRowsCount)
+    {
+        throw std::runtime_error{"Error! Incompatible matrix sizes"};
+    }
+
+    WideFractionMatrix result{mRowsCount, matrix.mColumnsCount};
+
+    // the sums of a result block are accumulated with 64 bit terms, an element switches to wide terms on its first overflow
+    std::vector<std::vector<CheckedFraction>> workerCheckedSums(scheduler.getThreadsCount(), std::vector<CheckedFraction>(scBlockElementsCount));
+    std::vector<std::vector<bool>> workerIsWideSums(scheduler.getThreadsCount(), std::vector<bool>(scBlockElementsCount));
+
+    // each task computes a full row of result blocks so the workers never write to the same block
+    scheduler.parallelFor(mBlockRowsCount, [this, &matrix, &result, &workerCheckedSums, &workerIsWideSums](size_t begin, size_t end, size_t workerIndex)
+    {
+        std::vector<CheckedFraction>& checkedSums{workerCheckedSums[workerIndex]};
+        std::vector<bool>& isWideSum{workerIsWideSums[workerIndex]};
+
+        for (size_t blockRow{begin}; blockRow < end; ++blockRow)
+        {
+            const size_t cBlockRowsCount{std::min(scBlockSize, mRowsCount - blockRow * scBlockSize)};
+
+            for (size_t blockColumn{0}; blockColumn < matrix.mBlockColumnsCount; ++blockColumn)
+            {
+                const size_t cBlockColumnsCount{std::min(scBlockSize, matrix.mColumnsCount - blockColumn * scBlockSize)};
+                WideFraction* const cResultBlock{result.getBlock(blockRow, blockColumn)};
+
+                std::fill(checkedSums.begin(), checkedSums.end(), CheckedFraction{});
+                std::fill(isWideSum.begin(), isWideSum.end(), false);
+
+                for (size_t innerBlock{0}; innerBlock < mBlockColumnsCount; ++innerBlock)
+                {
+                    const size_t cInnerCount{std::min(scBlockSize, mColumnsCount - innerBlock * scBlockSize)};
+                    const Fraction* const cLeftBlock{getBlock(blockRow, innerBlock)};
+                    const Fraction* const cRightBlock{matrix.getBlock(innerBlock, blockColumn)};
+
+                    for (size_t row{0}; row < cBlockRowsCount; ++row)
+                    {
+                        for (size_t inner{0}; inner < cInnerCount; ++inner)
+                        {
+                            const CheckedFraction cLeftElement{cLeftBlock[row * scBlockSize + inner]};
+
+                            if (!cLeftElement)
+                            {
+                                continue;
+                            }
+
+                            for (size_t column{0}; column < cBlockColumnsCount; ++column)
+                            {
+                                const size_t cIndex{row * scBlockSize + column};
+                                const Fraction& cRightElement{cRightBlock[inner * scBlockSize + column]};
+
+                                if (!isWideSum[cIndex])
+                                {
+                                    try
+                                    {
+                                        checkedSums[cIndex] += cLeftElement * CheckedFraction{cRightElement};
+                                        continue;
+                                    }
+                                    catch (const std::overflow_error&)
+                                    {
+                                        cResultBlock[cIndex] = checkedSums[cIndex].toWideFraction();
+                                        isWideSum[cIndex] = true;
+                                    }
+                                }
+
+                                cResultBlock[cIndex] += cLeftElement.toWideFraction() * WideFraction{cRightElement};
+                            }
+                        }
+                    }
+                }
+
+                for (size_t index{0}; index < scBlockElementsCount; ++index)
+                {
+                    if (!isWideSum[index] && checkedSums[index])
+                    {
+                        cResultBlock[index] = checkedSums[index].toWideFraction();
+                    }
+                }
+            }
+        }
+    }, 1);
+
+    return result;
+}
+
+WideFractionMatrix FractionMatrix::operator*(const FractionMatrix& matrix) const
+{
+    const WideFractionMatrix cResult{multiply(matrix)};
+    return cResult;
+}
+
+FractionMatrix FractionMatrix::createIdentityMatrix(size_t size)
+{
+    FractionMatrix identityMatrix{size, size};
+
+    for (size_t index{0}; index < size; ++index)
+    {
+        identityMatrix(index, index) = Fraction{1};
+    }
+
+    return identityMatrix;
+}
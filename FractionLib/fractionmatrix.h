@@ -0,0 +1,39 @@
+#ifndef FRACTIONMATRIX_H
+#define FRACTIONMATRIX_H
+
+#include <initializer_list>
+
+#include "blockedmatrix.h"
+#include "widefraction.h"
+#include "fractionscheduler.h"
+
+using WideFractionMatrix = BlockedMatrix<WideFraction>;
+
+/* Matrix of fractions with exact linear algebra operations: the elimination based ones are fraction-free (Bareiss),
+   i.e. each row is scaled to integers and all intermediate values are kept as wide integers, so they cannot overflow
+*/
+class FractionMatrix : public BlockedMatrix<Fraction>
+{
+public:
+    // constructors
+    FractionMatrix();
+    FractionMatrix(size_t rowsCount, size_t columnsCount);
+    FractionMatrix(std::initializer_list<std::initializer_list<Fraction>> rows);
+
+    // exact linear algebra functions
+    WideFraction getDeterminant() const;
+    size_t getRank() const;
+    WideFractionMatrix getInverse() const;
+    std::vector<WideFraction> solve(const std::vector<Fraction>& rightHandSide) const;
+
+    /* Blocked multiplication, the rows of result blocks are distributed among the scheduler workers
+       - the products are summed with 64 bit terms (CheckedFraction), each sum switching to wide terms on its first overflow, so the result is exact
+    */
+    WideFractionMatrix multiply(const FractionMatrix& matrix, FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler()) const;
+    WideFractionMatrix operator*(const FractionMatrix& matrix) const;
+
+    // static helper functions
+    static FractionMatrix createIdentityMatrix(size_t size);
+};
+
+#endif // FRACTIONMATRIX_H
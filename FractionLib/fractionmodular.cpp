@@ -0,0 +1,708 @@
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+#include "fractionmodular.h"
+
+static constexpr std::uint32_t scLargestPrimeCandidate{2147483647u};   // 2^31 - 1
+static constexpr size_t scPrimesCount{4096};                           // over 126000 bits of modulus
+static constexpr size_t scMinRoundPrimesCount{2};
+static constexpr size_t scRoundGrowthDivisor{4};                      // each round adds at least a quarter of the primes used so far
+static constexpr size_t scMaxUnluckyPrimesCount{8};                   // unlucky primes (without a lucky one) before the exact algorithm is used instead
+
+using Clock = std::chrono::steady_clock;
+
+static double getElapsedMilliseconds(const Clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static std::uint64_t getModularPower(std::uint64_t base, std::uint64_t exponent, std::uint64_t modulus)
+{
+    std::uint64_t result{1 % modulus};
+
+    for (base %= modulus; exponent > 0; exponent /= 2)
+    {
+        if (1 == exponent % 2)
+        {
+            result = result * base % modulus;
+        }
+
+        base = base * base % modulus;
+    }
+
+    return result;
+}
+
+// Fermat's little theorem, the value is not divisible by the prime
+static std::uint64_t getModularInverse(std::uint64_t value, std::uint32_t prime)
+{
+    return getModularPower(value, prime - 2, prime);
+}
+
+// deterministic Miller-Rabin test, the bases 2, 7 and 61 are sufficient below 4759123141
+static bool isPrime(std::uint32_t value)
+{
+    if (value < 2)
+    {
+        return false;
+    }
+
+    for (const std::uint32_t cSmallPrime : {2u, 3u, 5u, 7u, 61u})
+    {
+        if (0 == value % cSmallPrime)
+        {
+            return value == cSmallPrime;
+        }
+    }
+
+    std::uint64_t oddPart{value - 1u};
+    size_t twoPowersCount{0};
+
+    for (; 0 == oddPart % 2; oddPart /= 2)
+    {
+        ++twoPowersCount;
+    }
+
+    for (const std::uint64_t cBase : {2u, 7u, 61u})
+    {
+        std::uint64_t power{getModularPower(cBase, oddPart, value)};
+        bool isWitnessPassed{1 == power || value - 1u == power};
+
+        for (size_t squaring{1}; !isWitnessPassed && squaring < twoPowersCount; ++squaring)
+        {
+            power = power * power % value;
+            isWitnessPassed = value - 1u == power;
+        }
+
+        if (!isWitnessPassed)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static std::uint32_t getResidue(long long value, std::uint32_t prime)
+{
+    const long long cRemainder{value % static_cast<long long>(prime)};
+    return static_cast<std::uint32_t>(cRemainder < 0 ? cRemainder + prime : cRemainder);
+}
+
+// the prime itself (which is not a residue) when the denominator is divisible by the prime
+static std::uint32_t getResidue(const WideFraction& wideFraction, std::uint32_t prime)
+{
+    const std::uint32_t cDenominatorResidue{wideFraction.getDenominator().getRemainder(prime)};
+    std::uint32_t residue{prime};
+
+    if (0u != cDenominatorResidue)
+    {
+        residue = static_cast<std::uint32_t>(static_cast<std::uint64_t>(wideFraction.getNumerator().getRemainder(prime)) *
+                                             getModularInverse(cDenominatorResidue, prime) % prime);
+    }
+
+    return residue;
+}
+
+/* Residues of the fractions with a single modular inverse (Montgomery's batch inversion: the inverse of the product of all denominators
+   is multiplied back by the prefix products), false when a denominator is divisible by the prime
+*/
+static bool getResidues(std::span<const Fraction> fractions, std::uint32_t prime, std::span<std::uint64_t> residues)
+{
+    std::uint64_t product{1};
+
+    for (size_t index{0}; index < fractions.size(); ++index)
+    {
+        residues[index] = product;
+        product = product * getResidue(fractions[index].getDenominator(), prime) % prime;
+    }
+
+    const bool cIsLucky{0u != product};
+
+    if (cIsLucky)
+    {
+        // inverse of the product of the denominators up to the current index
+        std::uint64_t inverse{getModularInverse(product, prime)};
+
+        for (size_t index{fractions.size()}; index > 0; --index)
+        {
+            const Fraction& cFraction{fractions[index - 1]};
+
+            residues[index - 1] = residues[index - 1] * inverse % prime * getResidue(cFraction.getNumerator(), prime) % prime;
+            inverse = inverse * getResidue(cFraction.getDenominator(), prime) % prime;
+        }
+    }
+
+    return cIsLucky;
+}
+
+// |numerator| and denominator below 2^k for rational reconstruction, where 2^(2k + 1) <= modulus (0 when the modulus is too small)
+static unsigned int getReconstructionBoundBitLength(const WideInteger& modulus)
+{
+    const unsigned int cModulusBitLength{modulus.getBitLength()};
+    return cModulusBitLength < 3 ? 0 : (cModulusBitLength - 2) / 2;
+}
+
+/* Rational reconstruction (Wang): the fraction n / d congruent to the residue with |n| and d below the bound, which is unique if it exists;
+   the extended Euclidean algorithm is stopped at the first remainder below the bound
+*/
+static bool reconstructFraction(const WideInteger& residue, const WideInteger& modulus, WideFraction& result)
+{
+    const unsigned int cBoundBitLength{getReconstructionBoundBitLength(modulus)};
+
+    // invariant: remainder = coefficient * residue (modulo the modulus)
+    WideInteger previousRemainder{modulus};
+    WideInteger remainder{residue};
+    WideInteger previousCoefficient{0};
+    WideInteger coefficient{1};
+
+    while (remainder.getBitLength() > cBoundBitLength)
+    {
+        WideInteger quotient;
+        WideInteger nextRemainder;
+
+        WideInteger::divide(previousRemainder, remainder, quotient, nextRemainder);
+
+        WideInteger nextCoefficient{previousCoefficient - quotient * coefficient};
+
+        previousRemainder = std::move(remainder);
+        remainder = std::move(nextRemainder);
+        previousCoefficient = std::move(coefficient);
+        coefficient = std::move(nextCoefficient);
+    }
+
+    const bool cIsReconstructed{cBoundBitLength > 0 && !coefficient.isZero() && coefficient.getBitLength() <= cBoundBitLength &&
+                                WideInteger::getGreatestCommonDivisor(remainder, coefficient) == WideInteger{1}};
+
+    if (cIsReconstructed)
+    {
+        result = WideFraction{coefficient.isNegative() ? -remainder : remainder, coefficient.abs()};
+    }
+
+    return cIsReconstructed;
+}
+
+// reconstruction over a denominator multiple of the one of the result: the numerator is (residue * denominator) modulo the modulus (symmetric range)
+static bool reconstructFraction(const WideInteger& residue, const WideInteger& modulus, const WideInteger& denominator, unsigned int numeratorBoundBitLength,
+                                WideFraction& result)
+{
+    WideInteger numerator{residue * denominator % modulus};
+
+    if ((numerator << 1) > modulus)
+    {
+        numerator -= modulus;
+    }
+
+    const bool cIsReconstructed{numerator.getBitLength() <= numeratorBoundBitLength};
+
+    if (cIsReconstructed)
+    {
+        result = WideFraction{numerator, denominator};
+    }
+
+    return cIsReconstructed;
+}
+
+// exact check of A * x == b, the solution is scaled to integers by its common denominator and each row by the common denominator of its fractions
+static bool isSolution(const FractionMatrix& matrix, const std::vector<Fraction>& rightHandSide, const std::vector<WideFraction>& solution)
+{
+    WideInteger solutionDenominator{1};
+
+    for (const WideFraction& cValue : solution)
+    {
+        solutionDenominator = WideInteger::getLeastCommonMultiple(solutionDenominator, cValue.getDenominator());
+    }
+
+    std::vector<WideInteger> scaledSolution;
+    scaledSolution.reserve(solution.size());
+
+    for (const WideFraction& cValue : solution)
+    {
+        scaledSolution.push_back(cValue.getNumerator() * (solutionDenominator / cValue.getDenominator()));
+    }
+
+    bool isSolutionFound{true};
+
+    for (size_t row{0}; isSolutionFound && row < matrix.getRowsCount(); ++row)
+    {
+        WideInteger rowDenominator{rightHandSide[row].getDenominator()};
+
+        for (size_t column{0}; column < matrix.getColumnsCount(); ++column)
+        {
+            rowDenominator = WideInteger::getLeastCommonMultiple(rowDenominator, matrix(row, column).getDenominator());
+        }
+
+        WideInteger sum;
+
+        for (size_t column{0}; column < matrix.getColumnsCount(); ++column)
+        {
+            const Fraction& cElement{matrix(row, column)};
+
+            if (0 != cElement.getNumerator())
+            {
+                sum += rowDenominator / WideInteger{cElement.getDenominator()} * WideInteger{cElement.getNumerator()} * scaledSolution[column];
+            }
+        }
+
+        isSolutionFound = sum == rowDenominator / WideInteger{rightHandSide[row].getDenominator()} * WideInteger{rightHandSide[row].getNumerator()} *
+                                 solutionDenominator;
+    }
+
+    return isSolutionFound;
+}
+
+// calls the function for each index in [0, count), the indexes are distributed among the scheduler workers, the first exception is rethrown
+template<typename Function>
+static void forEachIndex(size_t count, FractionScheduler& scheduler, const Function& function)
+{
+    scheduler.parallelFor(count, [&function](size_t begin, size_t end, size_t)
+    {
+        for (size_t index{begin}; index < end; ++index)
+        {
+            function(index);
+        }
+    }, 1);
+}
+
+FractionModular::FractionModular(FractionScheduler& scheduler)
+    : mScheduler{scheduler}
+{
+}
+
+WideFraction FractionModular::dot(std::span<const Fraction> first, std::span<const Fraction> second)
+{
+    if (first.size() != second.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    const Clock::time_point cStart{Clock::now()};
+
+    // the sum is accumulated as a fraction modulo the prime, so that a single inverse is computed per prime
+    const auto cComputeResidues{[first, second](std::uint32_t prime, std::vector<std::uint32_t>& residues)
+    {
+        std::uint64_t numerator{0};
+        std::uint64_t denominator{1};
+        bool isLucky{true};
+
+        for (size_t index{0}; isLucky && index < first.size(); ++index)
+        {
+            const std::uint64_t cTermDenominator{static_cast<std::uint64_t>(getResidue(first[index].getDenominator(), prime)) *
+                                                 getResidue(second[index].getDenominator(), prime) % prime};
+            const std::uint64_t cTermNumerator{static_cast<std::uint64_t>(getResidue(first[index].getNumerator(), prime)) *
+                                               getResidue(second[index].getNumerator(), prime) % prime};
+
+            isLucky = 0u != cTermDenominator;
+            numerator = (numerator * cTermDenominator + cTermNumerator * denominator) % prime;
+            denominator = denominator * cTermDenominator % prime;
+        }
+
+        if (isLucky)
+        {
+            residues[0] = static_cast<std::uint32_t>(numerator * getModularInverse(denominator, prime) % prime);
+        }
+
+        return isLucky;
+    }};
+
+    mStatistics = FractionModularStatistics{};
+
+    std::vector<WideFraction> results{reconstruct(1, cComputeResidues, [](const std::vector<WideFraction>&) {return true;}, WideInteger{})};
+
+    if (results.empty())
+    {
+        mStatistics.isExactFallbackUsed = true;
+        results.emplace_back();
+
+        for (size_t index{0}; index < first.size(); ++index)
+        {
+            results[0] += WideFraction{first[index]} * WideFraction{second[index]};
+        }
+    }
+
+    mStatistics.milliseconds = getElapsedMilliseconds(cStart);
+
+    return results[0];
+}
+
+std::vector<WideFraction> FractionModular::solve(const FractionMatrix& matrix, const std::vector<Fraction>& rightHandSide)
+{
+    if (matrix.getRowsCount() != matrix.getColumnsCount())
+    {
+        throw std::runtime_error{"Error! Matrix is not square"};
+    }
+
+    if (rightHandSide.size() != matrix.getRowsCount())
+    {
+        throw std::runtime_error{"Error! Incompatible matrix sizes"};
+    }
+
+    const Clock::time_point cStart{Clock::now()};
+    const size_t cSize{matrix.getRowsCount()};
+    const size_t cRowSize{cSize + 1};
+
+    std::vector<Fraction> augmentedRows;
+    augmentedRows.reserve(cSize * cRowSize);
+
+    for (size_t row{0}; row < cSize; ++row)
+    {
+        for (size_t column{0}; column < cSize; ++column)
+        {
+            augmentedRows.push_back(matrix(row, column));
+        }
+
+        augmentedRows.push_back(rightHandSide[row]);
+    }
+
+    // Gaussian elimination of the augmented matrix modulo the prime, the prime is unlucky when the matrix is singular modulo the prime
+    const auto cComputeResidues{[&augmentedRows, cSize, cRowSize](std::uint32_t prime, std::vector<std::uint32_t>& residues)
+    {
+        std::vector<std::uint64_t> rows(augmentedRows.size());
+        bool isLucky{getResidues(augmentedRows, prime, rows)};
+
+        for (size_t step{0}; isLucky && step < cSize; ++step)
+        {
+            size_t pivotRow{step};
+
+            while (pivotRow < cSize && 0u == rows[pivotRow * cRowSize + step])
+            {
+                ++pivotRow;
+            }
+
+            isLucky = pivotRow < cSize;
+
+            if (!isLucky)
+            {
+                break;
+            }
+
+            std::uint64_t* const cPivotRow{&rows[step * cRowSize]};
+
+            std::swap_ranges(cPivotRow + step, cPivotRow + cRowSize, &rows[pivotRow * cRowSize + step]);
+
+            const std::uint64_t cPivotInverse{getModularInverse(cPivotRow[step], prime)};
+
+            for (size_t column{step}; column < cRowSize; ++column)
+            {
+                cPivotRow[column] = cPivotRow[column] * cPivotInverse % prime;
+            }
+
+            for (size_t row{step + 1}; row < cSize; ++row)
+            {
+                std::uint64_t* const cRow{&rows[row * cRowSize]};
+                const std::uint64_t cFactor{prime - cRow[step]};
+
+                if (prime == cFactor)
+                {
+                    continue;
+                }
+
+                for (size_t column{step}; column < cRowSize; ++column)
+                {
+                    cRow[column] = (cRow[column] + cFactor * cPivotRow[column]) % prime;
+                }
+            }
+        }
+
+        // back substitution, the pivots are 1
+        for (size_t step{cSize}; isLucky && step > 0; --step)
+        {
+            const std::uint64_t* const cRow{&rows[(step - 1) * cRowSize]};
+            std::uint64_t value{cRow[cSize]};
+
+            for (size_t column{step}; column < cSize; ++column)
+            {
+                value = (value + (prime - cRow[column]) * residues[column]) % prime;
+            }
+
+            residues[step - 1] = static_cast<std::uint32_t>(value);
+        }
+
+        return isLucky;
+    }};
+
+    const auto cCheckResults{[&matrix, &rightHandSide](const std::vector<WideFraction>& results)
+    {
+        return isSolution(matrix, rightHandSide, results);
+    }};
+
+    mStatistics = FractionModularStatistics{};
+
+    std::vector<WideFraction> result{0 == cSize ? std::vector<WideFraction>{} : reconstruct(cSize, cComputeResidues, cCheckResults, WideInteger{})};
+
+    // singular modulo all the first primes: most likely singular, the exact elimination decides (and throws)
+    if (result.empty())
+    {
+        mStatistics.isExactFallbackUsed = true;
+        result = matrix.solve(rightHandSide);
+    }
+
+    mStatistics.milliseconds = getElapsedMilliseconds(cStart);
+
+    return result;
+}
+
+FractionPolynomial FractionModular::multiply(const FractionPolynomial& first, const FractionPolynomial& second)
+{
+    if (first.isZero() || second.isZero())
+    {
+        return FractionPolynomial{};
+    }
+
+    const Clock::time_point cStart{Clock::now()};
+    const std::vector<WideInteger>& cFirstTerms{first.getIntegerCoefficients()};
+    const std::vector<WideInteger>& cSecondTerms{second.getIntegerCoefficients()};
+    const WideInteger cCommonDenominator{first.getCommonDenominator() * second.getCommonDenominator()};
+
+    // product of the integer forms, the coefficients are the integer products over the product of the common denominators
+    const auto cComputeResidues{[&cFirstTerms, &cSecondTerms, &cCommonDenominator](std::uint32_t prime, std::vector<std::uint32_t>& residues)
+    {
+        const std::uint64_t cDenominatorResidue{cCommonDenominator.getRemainder(prime)};
+        const bool cIsLucky{0u != cDenominatorResidue};
+
+        if (cIsLucky)
+        {
+            std::vector<std::uint64_t> firstResidues(cFirstTerms.size());
+            std::vector<std::uint64_t> secondResidues(cSecondTerms.size());
+            std::vector<std::uint64_t> products(residues.size(), 0);
+
+            std::transform(cFirstTerms.cbegin(), cFirstTerms.cend(), firstResidues.begin(), [prime](const WideInteger& term) {return term.getRemainder(prime);});
+            std::transform(cSecondTerms.cbegin(), cSecondTerms.cend(), secondResidues.begin(), [prime](const WideInteger& term) {return term.getRemainder(prime);});
+
+            for (size_t power{0}; power < firstResidues.size(); ++power)
+            {
+                if (0u == firstResidues[power])
+                {
+                    continue;
+                }
+
+                for (size_t otherPower{0}; otherPower < secondResidues.size(); ++otherPower)
+                {
+                    products[power + otherPower] = (products[power + otherPower] + firstResidues[power] * secondResidues[otherPower]) % prime;
+                }
+            }
+
+            const std::uint64_t cDenominatorInverse{getModularInverse(cDenominatorResidue, prime)};
+
+            for (size_t power{0}; power < products.size(); ++power)
+            {
+                residues[power] = static_cast<std::uint32_t>(products[power] * cDenominatorInverse % prime);
+            }
+        }
+
+        return cIsLucky;
+    }};
+
+    mStatistics = FractionModularStatistics{};
+
+    std::vector<WideFraction> coefficients{reconstruct(cFirstTerms.size() + cSecondTerms.size() - 1, cComputeResidues,
+                                                       [](const std::vector<WideFraction>&) {return true;}, cCommonDenominator)};
+
+    FractionPolynomial result;
+
+    if (coefficients.empty())
+    {
+        mStatistics.isExactFallbackUsed = true;
+        result = first * second;
+    }
+    else
+    {
+        result = FractionPolynomial{std::move(coefficients)};
+    }
+
+    mStatistics.milliseconds = getElapsedMilliseconds(cStart);
+
+    return result;
+}
+
+const FractionModularStatistics& FractionModular::getStatistics() const
+{
+    return mStatistics;
+}
+
+std::uint32_t FractionModular::getPrime(size_t index)
+{
+    static const std::vector<std::uint32_t> scPrimes{[]()
+    {
+        std::vector<std::uint32_t> primes;
+        primes.reserve(scPrimesCount);
+
+        for (std::uint32_t candidate{scLargestPrimeCandidate}; primes.size() < scPrimesCount; candidate -= 2)
+        {
+            if (isPrime(candidate))
+            {
+                primes.push_back(candidate);
+            }
+        }
+
+        return primes;
+    }()};
+
+    if (index >= scPrimes.size())
+    {
+        throw std::runtime_error{"Error! Not enough primes for the modular computation"};
+    }
+
+    return scPrimes[index];
+}
+
+/* Rounds of primes until the reconstructed results are confirmed:
+   - the residues of the primes of a round are computed in parallel, then each result is updated in parallel (Garner's incremental
+     Chinese remaindering: x += M * ((r - x) / M modulo p), M *= p)
+   - a result reconstructed in a previous round is confirmed when it agrees with the residues of all the (lucky) primes of the current round,
+     the others are reconstructed again from the updated residue
+   - the rounds grow with the number of primes used and a round stops reconstructing at the first failure,
+     so the (quadratic) reconstructions are attempted a logarithmic number of times
+*/
+std::vector<WideFraction> FractionModular::reconstruct(size_t resultsCount, const ResiduesFunction& computeResidues, const CheckFunction& checkResults,
+                                                       const WideInteger& commonDenominator)
+{
+    std::vector<WideInteger> combinedResidues(resultsCount);
+    std::vector<WideFraction> candidates(resultsCount);
+    std::vector<std::uint8_t> hasCandidate(resultsCount, 0);
+    WideInteger modulus{1};
+    size_t nextPrimeIndex{0};
+    bool isConfirmed{false};
+
+    while (!isConfirmed)
+    {
+        const size_t cRoundPrimesCount{std::max({scMinRoundPrimesCount, mScheduler.getThreadsCount(), mStatistics.primesCount / scRoundGrowthDivisor})};
+        std::vector<std::vector<std::uint32_t>> roundResidues(cRoundPrimesCount, std::vector<std::uint32_t>(resultsCount));
+        std::vector<std::uint8_t> isLucky(cRoundPrimesCount, 0);
+
+        forEachIndex(cRoundPrimesCount, mScheduler, [&computeResidues, &roundResidues, &isLucky, nextPrimeIndex](size_t index)
+        {
+            isLucky[index] = computeResidues(getPrime(nextPrimeIndex + index), roundResidues[index]) ? 1 : 0;
+        });
+
+        // the partial moduli and their inverses are shared by all the results
+        std::vector<std::uint32_t> primes;
+        std::vector<WideInteger> partialModuli;
+        std::vector<std::uint64_t> partialModuliInverses;
+        std::vector<const std::vector<std::uint32_t>*> primesResidues;
+
+        for (size_t index{0}; index < cRoundPrimesCount; ++index)
+        {
+            const std::uint32_t cPrime{getPrime(nextPrimeIndex + index)};
+
+            if (0 == isLucky[index])
+            {
+                ++mStatistics.unluckyPrimesCount;
+                continue;
+            }
+
+            primes.push_back(cPrime);
+            partialModuli.push_back(modulus);
+            partialModuliInverses.push_back(getModularInverse(modulus.getRemainder(cPrime), cPrime));
+            primesResidues.push_back(&roundResidues[index]);
+            modulus *= WideInteger{static_cast<long long>(cPrime)};
+        }
+
+        nextPrimeIndex += cRoundPrimesCount;
+        ++mStatistics.roundsCount;
+        mStatistics.primesCount += primes.size();
+
+        if (primes.empty())
+        {
+            if (0 == mStatistics.primesCount && mStatistics.unluckyPrimesCount >= scMaxUnluckyPrimesCount)
+            {
+                return std::vector<WideFraction>{};
+            }
+
+            continue;
+        }
+
+        // Chinese remaindering of the round residues, the candidates of the previous rounds are checked against them
+        std::vector<size_t> unconfirmedResults;
+        std::mutex unconfirmedResultsMutex;
+
+        forEachIndex(resultsCount, mScheduler, [&](size_t result)
+        {
+            bool isResultConfirmed{0 != hasCandidate[result]};
+
+            for (size_t index{0}; index < primes.size(); ++index)
+            {
+                const std::uint64_t cPrime{primes[index]};
+                const std::uint64_t cResidue{(*primesResidues[index])[result]};
+
+                if (isResultConfirmed && getResidue(candidates[result], primes[index]) != cResidue)
+                {
+                    isResultConfirmed = false;
+                }
+
+                const std::uint64_t cCombinedResidue{combinedResidues[result].getRemainder(primes[index])};
+                const std::uint64_t cFactor{(cResidue + cPrime - cCombinedResidue) % cPrime * partialModuliInverses[index] % cPrime};
+
+                if (0u != cFactor)
+                {
+                    combinedResidues[result] += partialModuli[index] * WideInteger{static_cast<long long>(cFactor)};
+                }
+            }
+
+            if (!isResultConfirmed)
+            {
+                hasCandidate[result] = 0;
+
+                const std::lock_guard<std::mutex> cLock{unconfirmedResultsMutex};
+                unconfirmedResults.push_back(result);
+            }
+        });
+
+        if (unconfirmedResults.empty())
+        {
+            isConfirmed = checkResults(candidates);
+
+            // a confirmed but wrong result (unlikely): all the results are reconstructed again from more primes
+            if (!isConfirmed)
+            {
+                std::fill(hasCandidate.begin(), hasCandidate.end(), 0);
+            }
+
+            continue;
+        }
+
+        std::sort(unconfirmedResults.begin(), unconfirmedResults.end());
+
+        // with an unknown common denominator the denominator of the first result is tried for the others (e.g. the determinant for the solution
+        // of a linear system) with the bounds of the rational reconstruction; more primes are needed as soon as a reconstruction fails,
+        // so the following results are not reconstructed in this round
+        const bool cIsDenominatorKnown{!commonDenominator.isZero()};
+        const size_t cFirstResult{unconfirmedResults.front()};
+        const unsigned int cBoundBitLength{getReconstructionBoundBitLength(modulus)};
+
+        if (!cIsDenominatorKnown && !reconstructFraction(combinedResidues[cFirstResult], modulus, candidates[cFirstResult]))
+        {
+            continue;
+        }
+
+        const WideInteger cDenominator{cIsDenominatorKnown ? commonDenominator : candidates[cFirstResult].getDenominator()};
+        const bool cIsDenominatorTried{cIsDenominatorKnown || cDenominator.getBitLength() <= cBoundBitLength};
+        const unsigned int cNumeratorBoundBitLength{cIsDenominatorKnown ? modulus.getBitLength() - 2 : cBoundBitLength};
+        const size_t cFirstReconstructedIndex{cIsDenominatorKnown ? 0u : 1u};
+        std::atomic_flag isReconstructionFailed;
+
+        hasCandidate[cFirstResult] = cIsDenominatorKnown ? 0 : 1;
+
+        forEachIndex(unconfirmedResults.size() - cFirstReconstructedIndex, mScheduler, [&](size_t index)
+        {
+            const size_t cResult{unconfirmedResults[index + cFirstReconstructedIndex]};
+            const WideInteger& cResidue{combinedResidues[cResult]};
+            const bool cIsReconstructed{!isReconstructionFailed.test() &&
+                                        ((cIsDenominatorTried && reconstructFraction(cResidue, modulus, cDenominator, cNumeratorBoundBitLength, candidates[cResult])) ||
+                                         (!cIsDenominatorKnown && reconstructFraction(cResidue, modulus, candidates[cResult])))};
+
+            hasCandidate[cResult] = cIsReconstructed ? 1 : 0;
+
+            if (!cIsReconstructed)
+            {
+                isReconstructionFailed.test_and_set();
+            }
+        });
+    }
+
+    return candidates;
+}
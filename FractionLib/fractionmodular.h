@@ -0,0 +1,68 @@
+#ifndef FRACTIONMODULAR_H
+#define FRACTIONMODULAR_H
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+#include "fraction.h"
+#include "widefraction.h"
+#include "fractionmatrix.h"
+#include "fractionpolynomial.h"
+#include "fractionscheduler.h"
+
+struct FractionModularStatistics
+{
+    size_t primesCount{0};          // primes whose residues were combined into the result
+    size_t unluckyPrimesCount{0};   // skipped primes (dividing a denominator or making the matrix singular)
+    size_t roundsCount{0};
+    bool isExactFallbackUsed{false};
+    double milliseconds{0.0};
+};
+
+/* Multi-modular backend for the exact computations whose intermediate values grow much larger than their inputs
+   - the inputs are mapped to residues modulo word size primes (below 2^31, so the products fit into 64 bits) and the computation
+     is done independently for each prime, the primes of a round being distributed among the scheduler workers
+   - the residues are combined by the Chinese remainder theorem and the fractions are recovered by rational reconstruction
+     (|numerator| and denominator below sqrt(M / 2) for the product M of the primes); the coefficients of a polynomial product
+     are recovered as integers over the known common denominator
+   - the computation stops as soon as the reconstructed results are confirmed by all the primes of a new round;
+     the solutions of the linear systems are additionally checked exactly (A * x == b)
+   - the results are exact unless a wrong reconstruction agrees with a full round of fresh primes, whose probability is below 2^-62
+*/
+class FractionModular
+{
+public:
+    // constructors
+    explicit FractionModular(FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler());
+
+    // throws when the sizes are different
+    WideFraction dot(std::span<const Fraction> first, std::span<const Fraction> second);
+
+    // same result as FractionMatrix::solve(), throws when the matrix is singular or not square or when the sizes are incompatible
+    std::vector<WideFraction> solve(const FractionMatrix& matrix, const std::vector<Fraction>& rightHandSide);
+
+    FractionPolynomial multiply(const FractionPolynomial& first, const FractionPolynomial& second);
+
+    const FractionModularStatistics& getStatistics() const;     // of the last computation
+
+    // static helper functions
+    static std::uint32_t getPrime(size_t index);     // the primes in decreasing order starting from the largest one below 2^31
+
+private:
+    // residues of the results modulo the prime, false when the prime is unlucky for the computation
+    using ResiduesFunction = std::function<bool(std::uint32_t prime, std::vector<std::uint32_t>& residues)>;
+    using CheckFunction = std::function<bool(const std::vector<WideFraction>& results)>;
+
+    /* The results of the computation, empty when none of the first primes is lucky (e.g. a singular matrix);
+       the common denominator of the results is 0 when unknown, otherwise the results are reconstructed as integers over it
+    */
+    std::vector<WideFraction> reconstruct(size_t resultsCount, const ResiduesFunction& computeResidues, const CheckFunction& checkResults,
+                                          const WideInteger& commonDenominator);
+
+    FractionScheduler& mScheduler;
+    FractionModularStatistics mStatistics;
+};
+
+#endif // FRACTIONMODULAR_H
@@ -0,0 +1,638 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "fractionpolynomial.h"
+#include "checkedfraction.h"
+
+// points evaluated by a worker at a time (batches up to this size are evaluated by the calling thread)
+static constexpr size_t scPointsChunkSize{1024};
+
+static WideFraction getAbsoluteValue(const WideFraction& value)
+{
+    return value < WideFraction{} ? -value : value;
+}
+
+// polynomial with the coefficients terms[i] / denominator
+static FractionPolynomial createFromIntegerTerms(const std::vector<WideInteger>& terms, const WideInteger& denominator)
+{
+    std::vector<WideFraction> coefficients;
+    coefficients.reserve(terms.size());
+
+    for (const WideInteger& term : terms)
+    {
+        coefficients.emplace_back(term, denominator);
+    }
+
+    const FractionPolynomial cResult{std::move(coefficients)};
+
+    return cResult;
+}
+
+// the polynomial divided by the absolute value of its leading coefficient (same signs everywhere, smaller coefficients)
+static FractionPolynomial getPositivelyScaled(const FractionPolynomial& polynomial)
+{
+    const FractionPolynomial cScale{std::vector<WideFraction>{WideFraction{1} / getAbsoluteValue(polynomial.getLeadingCoefficient())}};
+    const FractionPolynomial cResult{polynomial * cScale};
+
+    return cResult;
+}
+
+static size_t getSignChangesCount(const std::vector<FractionPolynomial>& sturmSequence, const WideFraction& point)
+{
+    size_t signChangesCount{0};
+    int previousSign{0};
+
+    for (const FractionPolynomial& polynomial : sturmSequence)
+    {
+        const int cSign{polynomial.getSignAt(point)};
+
+        if (0 != cSign)
+        {
+            if (0 != previousSign && cSign != previousSign)
+            {
+                ++signChangesCount;
+            }
+
+            previousSign = cSign;
+        }
+    }
+
+    return signChangesCount;
+}
+
+// p0 = square-free part of the polynomial, p1 = p0', p(k + 1) = -(p(k - 1) mod p(k)) while not zero
+static std::vector<FractionPolynomial> getSturmSequence(const FractionPolynomial& polynomial)
+{
+    const FractionPolynomial cSquareFreePart{polynomial / FractionPolynomial::getGreatestCommonDivisor(polynomial, polynomial.getDerivative())};
+    std::vector<FractionPolynomial> result{getPositivelyScaled(cSquareFreePart)};
+
+    for (FractionPolynomial next{result.back().getDerivative()}; !next.isZero(); )
+    {
+        result.push_back(getPositivelyScaled(next));
+        next = -(result[result.size() - 2] % result.back());
+    }
+
+    return result;
+}
+
+/* Bisects (lower, upper], whose roots count is given by the sign changes at the bounds, until each root is alone in an interval
+   whose bounds are not roots (or the root is a bisection point)
+*/
+static void isolateRoots(const std::vector<FractionPolynomial>& sturmSequence, const WideFraction& lower, const WideFraction& upper,
+                         size_t lowerSignChangesCount, size_t upperSignChangesCount, std::vector<FractionPolynomial::RootInterval>& rootIntervals)
+{
+    const size_t cRootsCount{lowerSignChangesCount - upperSignChangesCount};
+
+    if (0 == cRootsCount)
+    {
+        return;
+    }
+
+    if (1 == cRootsCount)
+    {
+        if (0 == sturmSequence.front().getSignAt(upper))
+        {
+            rootIntervals.push_back({upper, upper});
+            return;
+        }
+
+        // a lower bound which is a root belongs to the previous interval
+        if (0 != sturmSequence.front().getSignAt(lower))
+        {
+            rootIntervals.push_back({lower, upper});
+            return;
+        }
+    }
+
+    const WideFraction cMiddle{(lower + upper) / WideFraction{2}};
+    const size_t cMiddleSignChangesCount{getSignChangesCount(sturmSequence, cMiddle)};
+
+    isolateRoots(sturmSequence, lower, cMiddle, lowerSignChangesCount, cMiddleSignChangesCount, rootIntervals);
+    isolateRoots(sturmSequence, cMiddle, upper, cMiddleSignChangesCount, upperSignChangesCount, rootIntervals);
+}
+
+static void setResult(long long numerator, long long denominator, Fraction& result)
+{
+    result = CheckedFraction{numerator, denominator}.toFraction();
+}
+
+static void setResult(long long numerator, long long denominator, WideFraction& result)
+{
+    result = WideFraction{WideInteger{numerator}, WideInteger{denominator}};
+}
+
+static void setResult(const WideFraction& value, Fraction& result)
+{
+    result = value.toFraction();
+}
+
+static void setResult(const WideFraction& value, WideFraction& result)
+{
+    result = value;
+}
+
+FractionPolynomial::FractionPolynomial()
+    : mCommonDenominator{1}
+    , mHasSmallTerms{true}
+    , mSmallCommonDenominator{1}
+{
+}
+
+FractionPolynomial::FractionPolynomial(std::initializer_list<Fraction> coefficients)
+    : mCoefficients(coefficients.begin(), coefficients.end())
+{
+    normalize();
+}
+
+FractionPolynomial::FractionPolynomial(std::vector<WideFraction> coefficients)
+    : mCoefficients{std::move(coefficients)}
+{
+    normalize();
+}
+
+int FractionPolynomial::getDegree() const
+{
+    return static_cast<int>(mCoefficients.size()) - 1;
+}
+
+bool FractionPolynomial::isZero() const
+{
+    return mCoefficients.empty();
+}
+
+const std::vector<WideFraction>& FractionPolynomial::getCoefficients() const
+{
+    return mCoefficients;
+}
+
+WideFraction FractionPolynomial::getCoefficient(size_t power) const
+{
+    return power < mCoefficients.size() ? mCoefficients[power] : WideFraction{};
+}
+
+WideFraction FractionPolynomial::getLeadingCoefficient() const
+{
+    return isZero() ? WideFraction{} : mCoefficients.back();
+}
+
+const std::vector<WideInteger>& FractionPolynomial::getIntegerCoefficients() const
+{
+    return mIntegerCoefficients;
+}
+
+const WideInteger& FractionPolynomial::getCommonDenominator() const
+{
+    return mCommonDenominator;
+}
+
+// the integer forms are combined over the least common multiple of the denominators, each coefficient is reduced once
+FractionPolynomial FractionPolynomial::operator+(const FractionPolynomial& polynomial) const
+{
+    const WideInteger cDenominator{WideInteger::getLeastCommonMultiple(mCommonDenominator, polynomial.mCommonDenominator)};
+    const WideInteger cFactor{cDenominator / mCommonDenominator};
+    const WideInteger cOtherFactor{cDenominator / polynomial.mCommonDenominator};
+
+    std::vector<WideInteger> terms(std::max(mIntegerCoefficients.size(), polynomial.mIntegerCoefficients.size()));
+
+    for (size_t power{0}; power < mIntegerCoefficients.size(); ++power)
+    {
+        terms[power] = mIntegerCoefficients[power] * cFactor;
+    }
+
+    for (size_t power{0}; power < polynomial.mIntegerCoefficients.size(); ++power)
+    {
+        terms[power] += polynomial.mIntegerCoefficients[power] * cOtherFactor;
+    }
+
+    return createFromIntegerTerms(terms, cDenominator);
+}
+
+FractionPolynomial FractionPolynomial::operator-(const FractionPolynomial& polynomial) const
+{
+    return *this + (-polynomial);
+}
+
+FractionPolynomial FractionPolynomial::operator*(const FractionPolynomial& polynomial) const
+{
+    if (isZero() || polynomial.isZero())
+    {
+        return FractionPolynomial{};
+    }
+
+    std::vector<WideInteger> terms(mIntegerCoefficients.size() + polynomial.mIntegerCoefficients.size() - 1);
+
+    for (size_t power{0}; power < mIntegerCoefficients.size(); ++power)
+    {
+        if (mIntegerCoefficients[power].isZero())
+        {
+            continue;
+        }
+
+        for (size_t otherPower{0}; otherPower < polynomial.mIntegerCoefficients.size(); ++otherPower)
+        {
+            terms[power + otherPower] += mIntegerCoefficients[power] * polynomial.mIntegerCoefficients[otherPower];
+        }
+    }
+
+    return createFromIntegerTerms(terms, mCommonDenominator * polynomial.mCommonDenominator);
+}
+
+FractionPolynomial FractionPolynomial::operator/(const FractionPolynomial& polynomial) const
+{
+    return divideWithRemainder(polynomial).first;
+}
+
+FractionPolynomial FractionPolynomial::operator%(const FractionPolynomial& polynomial) const
+{
+    return divideWithRemainder(polynomial).second;
+}
+
+FractionPolynomial FractionPolynomial::operator-() const
+{
+    std::vector<WideFraction> coefficients;
+    coefficients.reserve(mCoefficients.size());
+
+    for (const WideFraction& coefficient : mCoefficients)
+    {
+        coefficients.push_back(-coefficient);
+    }
+
+    const FractionPolynomial cResult{std::move(coefficients)};
+
+    return cResult;
+}
+
+bool FractionPolynomial::operator==(const FractionPolynomial& polynomial) const
+{
+    return mCoefficients == polynomial.mCoefficients;
+}
+
+std::pair<FractionPolynomial, FractionPolynomial> FractionPolynomial::divideWithRemainder(const FractionPolynomial& divisor) const
+{
+    if (divisor.isZero())
+    {
+        throw std::runtime_error{"Fatal error! Division by 0."};
+    }
+
+    if (getDegree() < divisor.getDegree())
+    {
+        return {FractionPolynomial{}, *this};
+    }
+
+    const size_t cDivisorDegree{static_cast<size_t>(divisor.getDegree())};
+    const WideFraction cLeadingCoefficientInverse{WideFraction{1} / divisor.getLeadingCoefficient()};
+
+    std::vector<WideFraction> quotient(mCoefficients.size() - cDivisorDegree);
+    std::vector<WideFraction> remainder{mCoefficients};
+
+    for (size_t power{quotient.size()}; power-- > 0; )
+    {
+        const WideFraction cQuotientCoefficient{remainder[power + cDivisorDegree] * cLeadingCoefficientInverse};
+
+        if (cQuotientCoefficient)
+        {
+            for (size_t divisorPower{0}; divisorPower < cDivisorDegree; ++divisorPower)
+            {
+                remainder[power + divisorPower] -= cQuotientCoefficient * divisor.mCoefficients[divisorPower];
+            }
+        }
+
+        quotient[power] = cQuotientCoefficient;
+    }
+
+    remainder.resize(cDivisorDegree);
+
+    return {FractionPolynomial{std::move(quotient)}, FractionPolynomial{std::move(remainder)}};
+}
+
+FractionPolynomial FractionPolynomial::getDerivative() const
+{
+    std::vector<WideInteger> terms;
+
+    for (size_t power{1}; power < mIntegerCoefficients.size(); ++power)
+    {
+        terms.push_back(mIntegerCoefficients[power] * WideInteger{static_cast<long long>(power)});
+    }
+
+    return createFromIntegerTerms(terms, mCommonDenominator);
+}
+
+FractionPolynomial FractionPolynomial::getMonic() const
+{
+    if (isZero())
+    {
+        return *this;
+    }
+
+    std::vector<WideFraction> coefficients;
+    coefficients.reserve(mCoefficients.size());
+
+    for (const WideFraction& coefficient : mCoefficients)
+    {
+        coefficients.push_back(coefficient / mCoefficients.back());
+    }
+
+    const FractionPolynomial cResult{std::move(coefficients)};
+
+    return cResult;
+}
+
+FractionPolynomial FractionPolynomial::getGreatestCommonDivisor(const FractionPolynomial& first, const FractionPolynomial& second)
+{
+    FractionPolynomial dividend{first};
+    FractionPolynomial divisor{second};
+
+    // the remainders are made monic to keep their coefficients small
+    while (!divisor.isZero())
+    {
+        FractionPolynomial remainder{(dividend % divisor).getMonic()};
+
+        dividend = std::move(divisor);
+        divisor = std::move(remainder);
+    }
+
+    return dividend.getMonic();
+}
+
+WideFraction FractionPolynomial::evaluate(const Fraction& point) const
+{
+    long long numerator;
+    long long denominator;
+
+    if (mHasSmallTerms && tryEvaluateTerms(point.getNumerator(), point.getDenominator(), numerator, denominator))
+    {
+        const WideFraction cResult{WideInteger{numerator}, WideInteger{denominator}};
+        return cResult;
+    }
+
+    return evaluate(WideFraction{point});
+}
+
+WideFraction FractionPolynomial::evaluate(const WideFraction& point) const
+{
+    WideInteger denominatorPower;
+    const WideInteger cNumerator{evaluateIntegerTerms(point.getNumerator(), point.getDenominator(), denominatorPower)};
+    const WideFraction cResult{cNumerator, mCommonDenominator * denominatorPower};
+
+    return cResult;
+}
+
+void FractionPolynomial::evaluate(std::span<const Fraction> points, std::span<Fraction> results, FractionScheduler& scheduler) const
+{
+    evaluatePoints(points, results, scheduler);
+}
+
+void FractionPolynomial::evaluate(std::span<const Fraction> points, std::span<WideFraction> results, FractionScheduler& scheduler) const
+{
+    evaluatePoints(points, results, scheduler);
+}
+
+int FractionPolynomial::getSignAt(const WideFraction& point) const
+{
+    WideInteger denominatorPower;
+
+    return evaluateIntegerTerms(point.getNumerator(), point.getDenominator(), denominatorPower).getSign();
+}
+
+size_t FractionPolynomial::countRealRoots(const WideFraction& lower, const WideFraction& upper) const
+{
+    if (isZero())
+    {
+        throw std::runtime_error{"Error! The zero polynomial has no isolated roots"};
+    }
+
+    if (0 == getDegree() || lower >= upper)
+    {
+        return 0;
+    }
+
+    const std::vector<FractionPolynomial> cSturmSequence{getSturmSequence(*this)};
+
+    return getSignChangesCount(cSturmSequence, lower) - getSignChangesCount(cSturmSequence, upper);
+}
+
+std::vector<FractionPolynomial::RootInterval> FractionPolynomial::isolateRealRoots(const WideFraction& maxWidth) const
+{
+    if (isZero())
+    {
+        throw std::runtime_error{"Error! The zero polynomial has no isolated roots"};
+    }
+
+    std::vector<RootInterval> result;
+
+    if (0 == getDegree())
+    {
+        return result;
+    }
+
+    const std::vector<FractionPolynomial> cSturmSequence{getSturmSequence(*this)};
+    const FractionPolynomial& cSquareFreePart{cSturmSequence.front()};
+
+    // Cauchy's bound: all roots are within (-bound, bound) with bound = 1 + max(|ai|) / |an|
+    WideFraction maxCoefficient;
+
+    for (const WideFraction& coefficient : cSquareFreePart.getCoefficients())
+    {
+        maxCoefficient = std::max(maxCoefficient, getAbsoluteValue(coefficient));
+    }
+
+    const WideFraction cBound{WideFraction{1} + maxCoefficient / getAbsoluteValue(cSquareFreePart.getLeadingCoefficient())};
+
+    isolateRoots(cSturmSequence, -cBound, cBound, getSignChangesCount(cSturmSequence, -cBound), getSignChangesCount(cSturmSequence, cBound), result);
+
+    // bisection of the intervals which are still too wide (the signs at the bounds are opposite)
+    if (maxWidth)
+    {
+        for (RootInterval& rootInterval : result)
+        {
+            const int cLowerSign{cSquareFreePart.getSignAt(rootInterval.lower)};
+
+            while (rootInterval.upper - rootInterval.lower > maxWidth)
+            {
+                const WideFraction cMiddle{(rootInterval.lower + rootInterval.upper) / WideFraction{2}};
+                const int cMiddleSign{cSquareFreePart.getSignAt(cMiddle)};
+
+                if (0 == cMiddleSign)
+                {
+                    rootInterval = RootInterval{cMiddle, cMiddle};
+                }
+                else if (cMiddleSign == cLowerSign)
+                {
+                    rootInterval.lower = cMiddle;
+                }
+                else
+                {
+                    rootInterval.upper = cMiddle;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+std::string FractionPolynomial::toString() const
+{
+    if (isZero())
+    {
+        return "0";
+    }
+
+    std::string result;
+
+    for (size_t power{mCoefficients.size()}; power-- > 0; )
+    {
+        const WideFraction& cCoefficient{mCoefficients[power]};
+
+        if (!cCoefficient)
+        {
+            continue;
+        }
+
+        const bool cIsNegative{cCoefficient < WideFraction{}};
+        const WideFraction cMagnitude{getAbsoluteValue(cCoefficient)};
+
+        result += result.empty() ? (cIsNegative ? "-" : "") : (cIsNegative ? " - " : " + ");
+
+        if (0 == power || WideFraction{1} != cMagnitude)
+        {
+            result += WideInteger{1} == cMagnitude.getDenominator() ? cMagnitude.getNumerator().toString() : cMagnitude.toString();
+            result += 0 == power ? "" : "*";
+        }
+
+        if (power > 0)
+        {
+            result += 1 == power ? "x" : "x^" + std::to_string(power);
+        }
+    }
+
+    return result;
+}
+
+void FractionPolynomial::normalize()
+{
+    while (!mCoefficients.empty() && !mCoefficients.back())
+    {
+        mCoefficients.pop_back();
+    }
+
+    // the numerators scaled to the common denominator are coprime with it as the coefficients are reduced
+    mCommonDenominator = WideInteger{1};
+
+    for (const WideFraction& coefficient : mCoefficients)
+    {
+        mCommonDenominator = WideInteger::getLeastCommonMultiple(mCommonDenominator, coefficient.getDenominator());
+    }
+
+    mIntegerCoefficients.clear();
+    mIntegerCoefficients.reserve(mCoefficients.size());
+
+    for (const WideFraction& coefficient : mCoefficients)
+    {
+        mIntegerCoefficients.push_back(coefficient.getNumerator() * (mCommonDenominator / coefficient.getDenominator()));
+    }
+
+    mHasSmallTerms = mCommonDenominator.fitsLongLong() &&
+                     std::all_of(mIntegerCoefficients.begin(), mIntegerCoefficients.end(), [](const WideInteger& term) {return term.fitsLongLong();});
+    mSmallCoefficients.clear();
+    mSmallCommonDenominator = 1;
+
+    if (mHasSmallTerms)
+    {
+        for (const WideInteger& term : mIntegerCoefficients)
+        {
+            mSmallCoefficients.push_back(term.toLongLong());
+        }
+
+        mSmallCommonDenominator = mCommonDenominator.toLongLong();
+    }
+}
+
+template<typename Result>
+void FractionPolynomial::evaluatePoints(std::span<const Fraction> points, std::span<Result> results, FractionScheduler& scheduler) const
+{
+    if (points.size() != results.size())
+    {
+        throw std::runtime_error{"Error! Incompatible batch sizes"};
+    }
+
+    auto evaluateRange{[this, points, results](size_t begin, size_t end, size_t)
+    {
+        for (size_t index{begin}; index < end; ++index)
+        {
+            long long numerator;
+            long long denominator;
+
+            if (mHasSmallTerms && tryEvaluateTerms(points[index].getNumerator(), points[index].getDenominator(), numerator, denominator))
+            {
+                setResult(numerator, denominator, results[index]);
+            }
+            else
+            {
+                setResult(evaluate(WideFraction{points[index]}), results[index]);
+            }
+        }
+    }};
+
+    if (points.size() <= scPointsChunkSize)
+    {
+        evaluateRange(0, points.size(), 0);
+    }
+    else
+    {
+        scheduler.parallelFor(points.size(), evaluateRange, scPointsChunkSize);
+    }
+}
+
+// homogeneous Horner scheme: s = an, then s = s * u + ai * v^(n - i) for i = n - 1, ..., 0
+bool FractionPolynomial::tryEvaluateTerms(long long numerator, long long denominator, long long& resultNumerator, long long& resultDenominator) const
+{
+    if (isZero())
+    {
+        resultNumerator = 0;
+        resultDenominator = 1;
+
+        return true;
+    }
+
+    try
+    {
+        long long sum{mSmallCoefficients.back()};
+        long long denominatorPower{1};
+
+        for (size_t power{mSmallCoefficients.size() - 1}; power-- > 0; )
+        {
+            denominatorPower = CheckedFraction::multiplyTerms(denominatorPower, denominator);
+            sum = CheckedFraction::addTerms(CheckedFraction::multiplyTerms(sum, numerator), CheckedFraction::multiplyTerms(mSmallCoefficients[power], denominatorPower));
+        }
+
+        resultNumerator = sum;
+        resultDenominator = CheckedFraction::multiplyTerms(mSmallCommonDenominator, denominatorPower);
+    }
+    catch (const std::overflow_error&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+WideInteger FractionPolynomial::evaluateIntegerTerms(const WideInteger& numerator, const WideInteger& denominator, WideInteger& denominatorPower) const
+{
+    denominatorPower = WideInteger{1};
+
+    if (isZero())
+    {
+        return WideInteger{};
+    }
+
+    WideInteger sum{mIntegerCoefficients.back()};
+
+    for (size_t power{mIntegerCoefficients.size() - 1}; power-- > 0; )
+    {
+        denominatorPower *= denominator;
+        sum = sum * numerator + mIntegerCoefficients[power] * denominatorPower;
+    }
+
+    return sum;
+}
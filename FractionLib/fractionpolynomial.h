@@ -0,0 +1,116 @@
+#ifndef FRACTIONPOLYNOMIAL_H
+#define FRACTIONPOLYNOMIAL_H
+
+#include <span>
+#include <string>
+#include <vector>
+#include <utility>
+#include <initializer_list>
+
+#include "fraction.h"
+#include "wideinteger.h"
+#include "widefraction.h"
+#include "fractionscheduler.h"
+
+/* Polynomial with rational coefficients (stored from the constant term up, without trailing zero coefficients)
+   - besides the coefficients, the polynomial keeps the integer form (a0 + a1 * x + ... + an * x^n) / d, so a value is computed
+     with integer multiply-adds (homogeneous Horner scheme for x = u / v) and a single reduction instead of a normalized fraction per step;
+     the integer terms are 64 bit while they fit (CheckedFraction helpers) and wide otherwise
+   - the real roots are isolated exactly with the Sturm sequence of the square-free part
+*/
+class FractionPolynomial
+{
+public:
+    /* Interval isolating a single real root: the root is lower == upper when it is found exactly (a rational root),
+       otherwise it is the only root within (lower, upper) and the polynomial is not zero at the bounds
+       (the signs at the bounds are opposite unless the root has an even multiplicity)
+    */
+    struct RootInterval
+    {
+        WideFraction lower;
+        WideFraction upper;
+    };
+
+    // constructors
+    FractionPolynomial();
+    FractionPolynomial(std::initializer_list<Fraction> coefficients);
+    explicit FractionPolynomial(std::vector<WideFraction> coefficients);
+
+    // getters
+    int getDegree() const;                                      // -1 for the zero polynomial
+    bool isZero() const;
+    const std::vector<WideFraction>& getCoefficients() const;
+    WideFraction getCoefficient(size_t power) const;            // 0 above the degree
+    WideFraction getLeadingCoefficient() const;
+
+    // integer form: each coefficient is the integer coefficient over the common denominator
+    const std::vector<WideInteger>& getIntegerCoefficients() const;
+    const WideInteger& getCommonDenominator() const;
+
+    // arithmetic operators (the division and the remainder are the results of divideWithRemainder())
+    FractionPolynomial operator+(const FractionPolynomial& polynomial) const;
+    FractionPolynomial operator-(const FractionPolynomial& polynomial) const;
+    FractionPolynomial operator*(const FractionPolynomial& polynomial) const;
+    FractionPolynomial operator/(const FractionPolynomial& polynomial) const;
+    FractionPolynomial operator%(const FractionPolynomial& polynomial) const;
+    FractionPolynomial operator-() const;
+
+    bool operator==(const FractionPolynomial& polynomial) const;
+
+    // quotient and remainder (the degree of the remainder is lower than the degree of the divisor)
+    std::pair<FractionPolynomial, FractionPolynomial> divideWithRemainder(const FractionPolynomial& divisor) const;
+
+    FractionPolynomial getDerivative() const;
+    FractionPolynomial getMonic() const;                        // divided by the leading coefficient (the zero polynomial stays zero)
+
+    // monic greatest common divisor (0 if both polynomials are 0)
+    static FractionPolynomial getGreatestCommonDivisor(const FractionPolynomial& first, const FractionPolynomial& second);
+
+    // values
+    WideFraction evaluate(const Fraction& point) const;
+    WideFraction evaluate(const WideFraction& point) const;
+
+    /* Values at all points distributed among the scheduler workers (small batches are evaluated by the calling thread);
+       the Fraction results throw if a value does not fit into a Fraction
+    */
+    void evaluate(std::span<const Fraction> points, std::span<Fraction> results, FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler()) const;
+    void evaluate(std::span<const Fraction> points, std::span<WideFraction> results,
+                  FractionScheduler& scheduler = FractionScheduler::getDefaultScheduler()) const;
+
+    int getSignAt(const WideFraction& point) const;            // -1, 0 or 1 (cheaper than the value)
+
+    // roots
+    size_t countRealRoots(const WideFraction& lower, const WideFraction& upper) const;     // distinct roots within (lower, upper]
+
+    /* Isolating intervals of all distinct real roots in increasing order; the intervals are bisected further until they are not wider than maxWidth
+       (0: isolation only); the zero polynomial throws
+    */
+    std::vector<RootInterval> isolateRealRoots(const WideFraction& maxWidth = WideFraction{}) const;
+
+    std::string toString() const;                               // e.g. "3/2*x^2 - x + 1"
+
+private:
+    void normalize();
+
+    template<typename Result>
+    void evaluatePoints(std::span<const Fraction> points, std::span<Result> results, FractionScheduler& scheduler) const;
+
+    // numerator and denominator of the value for x = numerator / denominator, false on 64 bit overflow
+    bool tryEvaluateTerms(long long numerator, long long denominator, long long& resultNumerator, long long& resultDenominator) const;
+
+    // a0 * v^n + a1 * u * v^(n - 1) + ... + an * u^n for x = u / v (v > 0), the value is this integer over d * v^n
+    WideInteger evaluateIntegerTerms(const WideInteger& numerator, const WideInteger& denominator, WideInteger& denominatorPower) const;
+
+    std::vector<WideFraction> mCoefficients;
+
+    // integer form: the primitive (coprime) integer coefficients over the common positive denominator
+    std::vector<WideInteger> mIntegerCoefficients;
+    WideInteger mCommonDenominator;
+
+    // the integer form with 64 bit terms (only if it fits)
+    bool mHasSmallTerms;
+    std::vector<long long> mSmallCoefficients;
+    long long mSmallCommonDenominator;
+};
+
+#endif // FRACTIONPOLYNOMIAL_H
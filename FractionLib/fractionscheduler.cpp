@@ -0,0 +1,409 @@
+#include <algorithm>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "fractionscheduler.h"
+
+// set while a thread runs the chunks of a loop, so that the nested loops can be executed serially by the same worker
+// instead of waiting for the busy workers
+static thread_local const FractionScheduler* tRunningScheduler{nullptr};
+static thread_local size_t tWorkerIndex{0};
+
+// failed attempts to find a range (yielding in between) before an idle worker waits for a split or the end of the loop
+static constexpr size_t scIdleSpinsCount{64};
+
+size_t FractionScheduler::Statistics::getElementsCount() const
+{
+    size_t elementsCount{0};
+
+    for (const WorkerStatistics& worker : workers)
+    {
+        elementsCount += worker.elementsCount;
+    }
+
+    return elementsCount;
+}
+
+size_t FractionScheduler::Statistics::getStolenRangesCount() const
+{
+    size_t stolenRangesCount{0};
+
+    for (const WorkerStatistics& worker : workers)
+    {
+        stolenRangesCount += worker.stolenRangesCount;
+    }
+
+    return stolenRangesCount;
+}
+
+double FractionScheduler::Statistics::getImbalance() const
+{
+    const size_t cElementsCount{getElementsCount()};
+    double imbalance{1.0};
+
+    if (0 != cElementsCount)
+    {
+        const auto cBusiestWorkerIt{std::max_element(workers.cbegin(), workers.cend(), [](const WorkerStatistics& first, const WorkerStatistics& second)
+        {
+            return first.elementsCount < second.elementsCount;
+        })};
+
+        imbalance = static_cast<double>(cBusiestWorkerIt->elementsCount) * workers.size() / cElementsCount;
+    }
+
+    return imbalance;
+}
+
+FractionScheduler::FractionScheduler(size_t threadsCount, ThreadAffinity affinity)
+    : mJobIndex{0}
+    , mBusyThreadsCount{0}
+    , mIsStopping{false}
+    , mFunction{nullptr}
+    , mChunkSize{1}
+    , mRemainingCount{0}
+    , mIsCancelled{false}
+    , mRangesVersion{0}
+    , mIdleWorkersCount{0}
+{
+    if (0 == threadsCount)
+    {
+        threadsCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (size_t workerIndex{0}; workerIndex < threadsCount; ++workerIndex)
+    {
+        mWorkers.push_back(std::make_unique<Worker>());
+    }
+
+    // worker 0 is the thread calling parallelFor()
+    for (size_t workerIndex{1}; workerIndex < threadsCount; ++workerIndex)
+    {
+        mThreads.emplace_back(&FractionScheduler::runThread, this, workerIndex);
+
+#ifdef __linux__
+        if (ThreadAffinity::PINNED == affinity)
+        {
+            // best effort, the CPU might not be available to the process
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(workerIndex % std::max(1u, std::thread::hardware_concurrency()), &cpuSet);
+            (void)pthread_setaffinity_np(mThreads.back().native_handle(), sizeof(cpu_set_t), &cpuSet);
+        }
+#else
+        (void)affinity;
+#endif
+    }
+}
+
+FractionScheduler::~FractionScheduler()
+{
+    {
+        const std::lock_guard<std::mutex> cLock{mStateMutex};
+        mIsStopping = true;
+    }
+
+    mJobStartCondition.notify_all();
+
+    for (std::thread& thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+size_t FractionScheduler::getThreadsCount() const
+{
+    return mWorkers.size();
+}
+
+void FractionScheduler::parallelFor(size_t size, const RangeFunction& function, size_t chunkSize)
+{
+    chunkSize = std::max<size_t>(chunkSize, 1);
+
+    if (0 == size)
+    {
+        return;
+    }
+
+    if (this == tRunningScheduler)
+    {
+        // nested loop, the other workers might be waiting for the chunk that makes this call
+        for (size_t begin{0}; begin < size; begin += chunkSize)
+        {
+            function(begin, std::min(size, begin + chunkSize), tWorkerIndex);
+        }
+
+        return;
+    }
+
+    const std::lock_guard<std::mutex> cJobLock{mJobMutex};
+    const size_t cWorkersCount{mWorkers.size()};
+
+    mFunction = &function;
+    mChunkSize = chunkSize;
+    mRemainingCount = size;
+    mIsCancelled = false;
+    mIsExceptionCaught.clear();
+    mExceptionPtr = nullptr;
+
+    // each worker starts with an equal share, the steals and splits balance the differences in cost
+    for (size_t workerIndex{0}; workerIndex < cWorkersCount; ++workerIndex)
+    {
+        const Range cRange{size * workerIndex / cWorkersCount, size * (workerIndex + 1) / cWorkersCount};
+
+        if (cRange.begin != cRange.end)
+        {
+            pushRange(workerIndex, cRange);
+        }
+    }
+
+    {
+        const std::lock_guard<std::mutex> cLock{mStateMutex};
+        ++mJobIndex;
+        mBusyThreadsCount = mThreads.size();
+    }
+
+    mJobStartCondition.notify_all();
+
+    runJob(0);
+
+    {
+        std::unique_lock<std::mutex> lock{mStateMutex};
+        mJobEndCondition.wait(lock, [this]() {return 0 == mBusyThreadsCount;});
+    }
+
+    mFunction = nullptr;
+
+    if (mExceptionPtr)
+    {
+        std::rethrow_exception(mExceptionPtr);
+    }
+}
+
+FractionScheduler::Statistics FractionScheduler::getStatistics() const
+{
+    const std::lock_guard<std::mutex> cJobLock{mJobMutex};
+    Statistics statistics;
+
+    for (const std::unique_ptr<Worker>& worker : mWorkers)
+    {
+        statistics.workers.push_back(worker->statistics);
+    }
+
+    return statistics;
+}
+
+void FractionScheduler::resetStatistics()
+{
+    const std::lock_guard<std::mutex> cJobLock{mJobMutex};
+
+    for (std::unique_ptr<Worker>& worker : mWorkers)
+    {
+        worker->statistics = WorkerStatistics{};
+    }
+}
+
+FractionScheduler& FractionScheduler::getDefaultScheduler()
+{
+    static FractionScheduler sScheduler;
+    return sScheduler;
+}
+
+void FractionScheduler::runThread(size_t workerIndex)
+{
+    size_t lastJobIndex{0};
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mStateMutex};
+            mJobStartCondition.wait(lock, [this, lastJobIndex]() {return mIsStopping || mJobIndex != lastJobIndex;});
+
+            if (mIsStopping)
+            {
+                return;
+            }
+
+            lastJobIndex = mJobIndex;
+        }
+
+        runJob(workerIndex);
+
+        {
+            const std::lock_guard<std::mutex> cLock{mStateMutex};
+
+            if (0 == --mBusyThreadsCount)
+            {
+                mJobEndCondition.notify_all();
+            }
+        }
+    }
+}
+
+void FractionScheduler::runJob(size_t workerIndex)
+{
+    Range range;
+
+    // the calling thread might be running a loop of another scheduler
+    const FractionScheduler* const cOuterScheduler{tRunningScheduler};
+    const size_t cOuterWorkerIndex{tWorkerIndex};
+
+    tRunningScheduler = this;
+    tWorkerIndex = workerIndex;
+
+    size_t idleSpinsCount{0};
+
+    while (0 != mRemainingCount.load(std::memory_order_acquire))
+    {
+        const size_t cRangesVersion{mRangesVersion.load()};
+
+        if (popRange(workerIndex, range) || stealRange(workerIndex, range))
+        {
+            executeRange(workerIndex, range);
+            idleSpinsCount = 0;
+        }
+        else if (++idleSpinsCount < scIdleSpinsCount)
+        {
+            // the remaining ranges are being executed by other workers, one of them might split its range soon
+            std::this_thread::yield();
+        }
+        else
+        {
+            // a long range is being executed, wait without using the CPU until a range is pushed or the loop ends
+            std::unique_lock<std::mutex> lock{mIdleMutex};
+
+            ++mIdleWorkersCount;
+            mIdleCondition.wait(lock, [this, cRangesVersion]() {return cRangesVersion != mRangesVersion.load() || 0 == mRemainingCount.load();});
+            --mIdleWorkersCount;
+
+            idleSpinsCount = 0;
+        }
+    }
+
+    tRunningScheduler = cOuterScheduler;
+    tWorkerIndex = cOuterWorkerIndex;
+}
+
+void FractionScheduler::executeRange(size_t workerIndex, Range range)
+{
+    WorkerStatistics& statistics{mWorkers[workerIndex]->statistics};
+
+    while (range.begin != range.end)
+    {
+        if (mIsCancelled.load(std::memory_order_relaxed))
+        {
+            completeElements(range.end - range.begin);
+            break;
+        }
+
+        // keep the second half available for the idle workers
+        if (range.end - range.begin > 2 * mChunkSize && !hasRanges(workerIndex))
+        {
+            const size_t cMiddle{range.begin + (range.end - range.begin) / 2};
+
+            pushRange(workerIndex, Range{cMiddle, range.end});
+            range.end = cMiddle;
+            ++statistics.splitsCount;
+        }
+
+        const size_t cChunkEnd{std::min(range.end, range.begin + mChunkSize)};
+
+        try
+        {
+            (*mFunction)(range.begin, cChunkEnd, workerIndex);
+        }
+        catch (...)
+        {
+            if (!mIsExceptionCaught.test_and_set())
+            {
+                mExceptionPtr = std::current_exception();
+            }
+
+            mIsCancelled = true;
+        }
+
+        statistics.elementsCount += cChunkEnd - range.begin;
+        ++statistics.chunksCount;
+
+        completeElements(cChunkEnd - range.begin);
+        range.begin = cChunkEnd;
+    }
+}
+
+void FractionScheduler::completeElements(size_t elementsCount)
+{
+    if (elementsCount == mRemainingCount.fetch_sub(elementsCount))
+    {
+        notifyIdleWorkers();
+    }
+}
+
+void FractionScheduler::pushRange(size_t workerIndex, const Range& range)
+{
+    {
+        Worker& worker{*mWorkers[workerIndex]};
+        const std::lock_guard<std::mutex> cLock{worker.mutex};
+
+        worker.ranges.push_back(range);
+    }
+
+    ++mRangesVersion;
+    notifyIdleWorkers();
+}
+
+bool FractionScheduler::popRange(size_t workerIndex, Range& range)
+{
+    Worker& worker{*mWorkers[workerIndex]};
+    const std::lock_guard<std::mutex> cLock{worker.mutex};
+    const bool cHasRanges{!worker.ranges.empty()};
+
+    if (cHasRanges)
+    {
+        range = worker.ranges.back();
+        worker.ranges.pop_back();
+    }
+
+    return cHasRanges;
+}
+
+bool FractionScheduler::stealRange(size_t workerIndex, Range& range)
+{
+    const size_t cWorkersCount{mWorkers.size()};
+
+    for (size_t offset{1}; offset < cWorkersCount; ++offset)
+    {
+        Worker& victim{*mWorkers[(workerIndex + offset) % cWorkersCount]};
+        const std::lock_guard<std::mutex> cLock{victim.mutex};
+
+        if (!victim.ranges.empty())
+        {
+            range = victim.ranges.front();
+            victim.ranges.pop_front();
+            ++mWorkers[workerIndex]->statistics.stolenRangesCount;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void FractionScheduler::notifyIdleWorkers()
+{
+    // the idle workers count is incremented before the wait condition is checked, so either the waiting worker sees the change or it is notified
+    if (0 != mIdleWorkersCount.load())
+    {
+        const std::lock_guard<std::mutex> cLock{mIdleMutex};
+        mIdleCondition.notify_all();
+    }
+}
+
+bool FractionScheduler::hasRanges(size_t workerIndex)
+{
+    Worker& worker{*mWorkers[workerIndex]};
+    const std::lock_guard<std::mutex> cLock{worker.mutex};
+
+    return !worker.ranges.empty();
+}
@@ -0,0 +1,124 @@
+#ifndef FRACTIONSCHEDULER_H
+#define FRACTIONSCHEDULER_H
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+/* Work-stealing scheduler for data parallel loops whose elements have very different costs (e.g. fractions with small and huge terms)
+   - each worker (the calling thread being worker 0) owns a deque of index ranges: it takes its work from the back,
+     the idle workers steal from the front, i.e. they take the largest and oldest ranges
+   - the ranges are split lazily: a worker halves its current range (pushing the second half onto its deque) only while its deque is empty,
+     so the ranges get smaller only when there are idle workers to steal them
+   - a worker finding no range yields for a few attempts, then waits (without using the CPU) until a range is pushed or the loop ends
+   - the function is called with subranges of at most chunkSize elements, the first exception thrown cancels the remaining chunks
+     and is rethrown by parallelFor()
+   - the calls of parallelFor() on a scheduler are serialized, a call made from inside a running loop of the same scheduler is executed serially
+     by the calling worker (the function gets its worker index); the loops of different schedulers must not be nested into each other cyclically
+*/
+class FractionScheduler
+{
+public:
+    enum class ThreadAffinity : unsigned short
+    {
+        NONE = 0,
+        PINNED      // worker i runs on the logical CPU i (modulo the CPUs count), only on Linux, ignored elsewhere
+    };
+
+    struct WorkerStatistics
+    {
+        size_t elementsCount{0};
+        size_t chunksCount{0};
+        size_t stolenRangesCount{0};
+        size_t splitsCount{0};
+    };
+
+    struct Statistics
+    {
+        std::vector<WorkerStatistics> workers;
+
+        size_t getElementsCount() const;
+        size_t getStolenRangesCount() const;
+
+        // elements processed by the busiest worker divided by the average (1: perfectly balanced)
+        double getImbalance() const;
+    };
+
+    // the function gets the subrange [begin, end) and the index of the worker running it (smaller than getThreadsCount())
+    using RangeFunction = std::function<void(size_t begin, size_t end, size_t workerIndex)>;
+
+    // constructors
+    explicit FractionScheduler(size_t threadsCount = 0, ThreadAffinity affinity = ThreadAffinity::NONE);    // 0: use all available hardware threads
+    ~FractionScheduler();
+
+    FractionScheduler(const FractionScheduler&) = delete;
+    FractionScheduler& operator=(const FractionScheduler&) = delete;
+
+    size_t getThreadsCount() const;
+
+    void parallelFor(size_t size, const RangeFunction& function, size_t chunkSize = 64);
+
+    // accumulated since the construction or the last reset
+    Statistics getStatistics() const;
+    void resetStatistics();
+
+    // shared scheduler using all hardware threads
+    static FractionScheduler& getDefaultScheduler();
+
+private:
+    struct Range
+    {
+        size_t begin;
+        size_t end;
+    };
+
+    struct alignas(64) Worker
+    {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+        WorkerStatistics statistics;
+    };
+
+    void runThread(size_t workerIndex);
+    void runJob(size_t workerIndex);
+    void executeRange(size_t workerIndex, Range range);
+    void completeElements(size_t elementsCount);
+
+    void pushRange(size_t workerIndex, const Range& range);
+    bool popRange(size_t workerIndex, Range& range);
+    bool stealRange(size_t workerIndex, Range& range);
+    bool hasRanges(size_t workerIndex);
+    void notifyIdleWorkers();
+
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::vector<std::thread> mThreads;
+
+    mutable std::mutex mJobMutex;
+    std::mutex mStateMutex;
+    std::condition_variable mJobStartCondition;
+    std::condition_variable mJobEndCondition;
+    size_t mJobIndex;
+    size_t mBusyThreadsCount;
+    bool mIsStopping;
+
+    const RangeFunction* mFunction;
+    size_t mChunkSize;
+    std::atomic<size_t> mRemainingCount;
+    std::atomic<bool> mIsCancelled;
+    std::atomic_flag mIsExceptionCaught;
+    std::exception_ptr mExceptionPtr;
+
+    // the idle workers wait for a pushed range (new version) or for the end of the loop
+    std::mutex mIdleMutex;
+    std::condition_variable mIdleCondition;
+    std::atomic<size_t> mRangesVersion;
+    std::atomic<size_t> mIdleWorkersCount;
+};
+
+#endif // FRACTIONSCHEDULER_H
@@ -0,0 +1,431 @@
+#include <limits>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
+
+#include "fractionsequences.h"
+
+// the largest Stern-Brocot tree terms at depth d are Fibonacci numbers F(d + 1), F(46) is the last one fitting into int
+static constexpr int scMaxSternBrocotDepth{45};
+
+struct FareyNeighbours
+{
+    long long predecessorNumerator;
+    long long predecessorDenominator;
+    long long successorNumerator;
+    long long successorDenominator;
+};
+
+static long long floorDivide(long long numerator, long long denominator)
+{
+    long long result{numerator / denominator};
+
+    if (0 != numerator % denominator && numerator < 0)
+    {
+        --result;
+    }
+
+    return result;
+}
+
+/* The closest elements of the (unbounded) Farey sequence of the given order strictly below and strictly above p / q (reduced, q > 0)
+   - Stern-Brocot descent from floor(x) / 1 and (floor(x) + 1) / 1, the runs of moves in the same direction are done in a single step,
+     so the descent takes O(log) steps (one per continued fraction term)
+   - when p / q is reached as a mediant its neighbours are the fractions of the largest denominators of the form (k * p + a) / (k * q + b),
+     with a / b being one of its Stern-Brocot bounds
+*/
+static FareyNeighbours getFareyNeighbours(long long p, long long q, long long order)
+{
+    const long long cFloor{floorDivide(p, q)};
+
+    if (1 == q)
+    {
+        const FareyNeighbours cResult{p * order - 1, order, p * order + 1, order};
+        return cResult;
+    }
+
+    long long leftNumerator{cFloor};
+    long long leftDenominator{1};
+    long long rightNumerator{cFloor + 1};
+    long long rightDenominator{1};
+
+    while (true)
+    {
+        const long long cMediantNumerator{leftNumerator + rightNumerator};
+        const long long cMediantDenominator{leftDenominator + rightDenominator};
+
+        if (cMediantDenominator > order)
+        {
+            const FareyNeighbours cResult{leftNumerator, leftDenominator, rightNumerator, rightDenominator};
+            return cResult;
+        }
+
+        const long long cComparison{p * cMediantDenominator - cMediantNumerator * q};
+
+        if (0 == cComparison)
+        {
+            const long long cLeftSteps{(order - leftDenominator) / q};
+            const long long cRightSteps{(order - rightDenominator) / q};
+
+            const FareyNeighbours cResult{cLeftSteps * p + leftNumerator, cLeftSteps * q + leftDenominator,
+                                          cRightSteps * p + rightNumerator, cRightSteps * q + rightDenominator};
+            return cResult;
+        }
+
+        if (cComparison < 0)
+        {
+            // move the right bound towards the left one while it stays strictly above p / q and within the order
+            const long long cDistance{rightNumerator * q - p * rightDenominator};
+            const long long cStep{p * leftDenominator - leftNumerator * q};
+            const long long cSteps{std::min((cDistance - 1) / cStep, (order - rightDenominator) / leftDenominator)};
+
+            rightNumerator += cSteps * leftNumerator;
+            rightDenominator += cSteps * leftDenominator;
+        }
+        else
+        {
+            const long long cDistance{p * leftDenominator - leftNumerator * q};
+            const long long cStep{rightNumerator * q - p * rightDenominator};
+            const long long cSteps{std::min((cDistance - 1) / cStep, (order - leftDenominator) / rightDenominator)};
+
+            leftNumerator += cSteps * rightNumerator;
+            leftDenominator += cSteps * rightDenominator;
+        }
+    }
+}
+
+static bool isLess(long long firstNumerator, long long firstDenominator, long long secondNumerator, long long secondDenominator)
+{
+    return firstNumerator * secondDenominator < secondNumerator * firstDenominator;
+}
+
+FareySequence::Iterator::Iterator()
+    : mOrder{0}
+    , mNumerator{0}
+    , mDenominator{1}
+    , mNextNumerator{0}
+    , mNextDenominator{1}
+    , mLastNumerator{0}
+    , mLastDenominator{1}
+    , mIsEnd{true}
+{
+}
+
+FareySequence::Iterator::Iterator(int order, long long numerator, long long denominator, long long nextNumerator, long long nextDenominator,
+                                  long long lastNumerator, long long lastDenominator)
+    : mOrder{order}
+    , mNumerator{numerator}
+    , mDenominator{denominator}
+    , mNextNumerator{nextNumerator}
+    , mNextDenominator{nextDenominator}
+    , mLastNumerator{lastNumerator}
+    , mLastDenominator{lastDenominator}
+    , mIsEnd{isLess(lastNumerator, lastDenominator, numerator, denominator)}
+{
+}
+
+Fraction FareySequence::Iterator::operator*() const
+{
+    return Fraction::fromReducedTerms(static_cast<int>(mNumerator), static_cast<int>(mDenominator));
+}
+
+FareySequence::Iterator& FareySequence::Iterator::operator++()
+{
+    if (mNumerator == mLastNumerator && mDenominator == mLastDenominator)
+    {
+        mIsEnd = true;
+    }
+    else
+    {
+        const long long cMultiplier{(mOrder + mDenominator) / mNextDenominator};
+        const long long cNumerator{cMultiplier * mNextNumerator - mNumerator};
+        const long long cDenominator{cMultiplier * mNextDenominator - mDenominator};
+
+        mNumerator = mNextNumerator;
+        mDenominator = mNextDenominator;
+        mNextNumerator = cNumerator;
+        mNextDenominator = cDenominator;
+    }
+
+    return *this;
+}
+
+FareySequence::Iterator FareySequence::Iterator::operator++(int)
+{
+    Iterator result{*this};
+    ++*this;
+
+    return result;
+}
+
+bool FareySequence::Iterator::operator==(const Iterator& iterator) const
+{
+    return mIsEnd == iterator.mIsEnd && (mIsEnd || (mNumerator == iterator.mNumerator && mDenominator == iterator.mDenominator));
+}
+
+FareySequence::FareySequence(int order)
+    : FareySequence{order, Fraction{0}, Fraction{1}}
+{
+}
+
+FareySequence::FareySequence(int order, const Fraction& lower, const Fraction& upper)
+    : mOrder{order}
+{
+    if (order <= 0)
+    {
+        throw std::runtime_error{"Error! The Farey sequence order should be positive"};
+    }
+
+    const long long cLowerNumerator{lower.getNumerator()};
+    const long long cLowerDenominator{lower.getDenominator()};
+    const long long cUpperNumerator{upper.getNumerator()};
+    const long long cUpperDenominator{upper.getDenominator()};
+
+    // the elements up to the integers around the bounds (and their neighbours) should fit into int
+    const long long cMaxBound{std::max(std::llabs(floorDivide(cLowerNumerator, cLowerDenominator)), std::llabs(floorDivide(cUpperNumerator, cUpperDenominator))) + 1};
+
+    if (cMaxBound * order + 1 > std::numeric_limits<int>::max())
+    {
+        throw std::runtime_error{"Error! The Farey sequence range is out of range for the order"};
+    }
+
+    if (cLowerDenominator <= order)
+    {
+        mFirstNumerator = cLowerNumerator;
+        mFirstDenominator = cLowerDenominator;
+    }
+    else
+    {
+        const FareyNeighbours cNeighbours{getFareyNeighbours(cLowerNumerator, cLowerDenominator, order)};
+
+        mFirstNumerator = cNeighbours.successorNumerator;
+        mFirstDenominator = cNeighbours.successorDenominator;
+    }
+
+    if (cUpperDenominator <= order)
+    {
+        mLastNumerator = cUpperNumerator;
+        mLastDenominator = cUpperDenominator;
+    }
+    else
+    {
+        const FareyNeighbours cNeighbours{getFareyNeighbours(cUpperNumerator, cUpperDenominator, order)};
+
+        mLastNumerator = cNeighbours.predecessorNumerator;
+        mLastDenominator = cNeighbours.predecessorDenominator;
+    }
+}
+
+FareySequence::FareySequence(int order, long long firstNumerator, long long firstDenominator, long long lastNumerator, long long lastDenominator)
+    : mOrder{order}
+    , mFirstNumerator{firstNumerator}
+    , mFirstDenominator{firstDenominator}
+    , mLastNumerator{lastNumerator}
+    , mLastDenominator{lastDenominator}
+{
+}
+
+int FareySequence::getOrder() const
+{
+    return static_cast<int>(mOrder);
+}
+
+bool FareySequence::isEmpty() const
+{
+    return isLess(mLastNumerator, mLastDenominator, mFirstNumerator, mFirstDenominator);
+}
+
+FareySequence::Iterator FareySequence::begin() const
+{
+    if (isEmpty())
+    {
+        return Iterator{};
+    }
+
+    const FareyNeighbours cNeighbours{getFareyNeighbours(mFirstNumerator, mFirstDenominator, mOrder)};
+    const Iterator cResult{static_cast<int>(mOrder), mFirstNumerator, mFirstDenominator, cNeighbours.successorNumerator, cNeighbours.successorDenominator,
+                           mLastNumerator, mLastDenominator};
+
+    return cResult;
+}
+
+FareySequence::Iterator FareySequence::end() const
+{
+    return Iterator{};
+}
+
+std::vector<FareySequence> FareySequence::split(size_t chunksCount) const
+{
+    std::vector<FareySequence> result;
+
+    if (chunksCount <= 1 || isEmpty())
+    {
+        result.push_back(*this);
+        return result;
+    }
+
+    result.reserve(chunksCount);
+
+    const double cFirstValue{static_cast<double>(mFirstNumerator) / mFirstDenominator};
+    const double cLastValue{static_cast<double>(mLastNumerator) / mLastDenominator};
+
+    long long chunkNumerator{mFirstNumerator};
+    long long chunkDenominator{mFirstDenominator};
+
+    for (size_t chunkIndex{1}; chunkIndex < chunksCount; ++chunkIndex)
+    {
+        // the boundary is the closest element to the equally spaced value, kept within the range and after the previous boundary
+        const double cBoundaryValue{cFirstValue + (cLastValue - cFirstValue) * static_cast<double>(chunkIndex) / static_cast<double>(chunksCount)};
+        const Fraction cBoundary{Fraction{cBoundaryValue}.limitDenominator(static_cast<int>(mOrder))};
+
+        long long boundaryNumerator{cBoundary.getNumerator()};
+        long long boundaryDenominator{cBoundary.getDenominator()};
+
+        if (isLess(boundaryNumerator, boundaryDenominator, chunkNumerator, chunkDenominator))
+        {
+            boundaryNumerator = chunkNumerator;
+            boundaryDenominator = chunkDenominator;
+        }
+        else if (isLess(mLastNumerator, mLastDenominator, boundaryNumerator, boundaryDenominator))
+        {
+            boundaryNumerator = mLastNumerator;
+            boundaryDenominator = mLastDenominator;
+        }
+
+        // the chunk ends right before the boundary (empty when the boundary did not move)
+        const FareyNeighbours cNeighbours{getFareyNeighbours(boundaryNumerator, boundaryDenominator, mOrder)};
+
+        result.push_back(FareySequence{static_cast<int>(mOrder), chunkNumerator, chunkDenominator, cNeighbours.predecessorNumerator, cNeighbours.predecessorDenominator});
+
+        chunkNumerator = boundaryNumerator;
+        chunkDenominator = boundaryDenominator;
+    }
+
+    result.push_back(FareySequence{static_cast<int>(mOrder), chunkNumerator, chunkDenominator, mLastNumerator, mLastDenominator});
+
+    return result;
+}
+
+SternBrocotSequence::Iterator::Iterator()
+    : mSequence{nullptr}
+    , mNumerator{0}
+    , mDenominator{1}
+{
+}
+
+SternBrocotSequence::Iterator::Iterator(const SternBrocotSequence& sequence)
+    : mSequence{&sequence}
+    , mNumerator{0}
+    , mDenominator{1}
+{
+    mPath.reserve(static_cast<size_t>(sequence.mMaxDepth));
+    pushLeftPath(Frame{0, 1, 1, 0, 1});
+    ++*this;
+}
+
+Fraction SternBrocotSequence::Iterator::operator*() const
+{
+    return Fraction::fromReducedTerms(static_cast<int>(mNumerator), static_cast<int>(mDenominator));
+}
+
+SternBrocotSequence::Iterator& SternBrocotSequence::Iterator::operator++()
+{
+    while (!mPath.empty())
+    {
+        const Frame cFrame{mPath.back()};
+        mPath.pop_back();
+
+        const long long cNumerator{cFrame.leftNumerator + cFrame.rightNumerator};
+        const long long cDenominator{cFrame.leftDenominator + cFrame.rightDenominator};
+
+        // the right subtree follows the node
+        pushLeftPath(Frame{cNumerator, cDenominator, cFrame.rightNumerator, cFrame.rightDenominator, cFrame.depth + 1});
+
+        if (isInRange(cNumerator, cDenominator))
+        {
+            mNumerator = cNumerator;
+            mDenominator = cDenominator;
+
+            return *this;
+        }
+    }
+
+    mSequence = nullptr;
+
+    return *this;
+}
+
+SternBrocotSequence::Iterator SternBrocotSequence::Iterator::operator++(int)
+{
+    Iterator result{*this};
+    ++*this;
+
+    return result;
+}
+
+bool SternBrocotSequence::Iterator::operator==(const Iterator& iterator) const
+{
+    return mSequence == iterator.mSequence && (nullptr == mSequence || (mNumerator == iterator.mNumerator && mDenominator == iterator.mDenominator));
+}
+
+void SternBrocotSequence::Iterator::pushLeftPath(Frame frame)
+{
+    while (frame.depth <= mSequence->mMaxDepth && intersectsRange(frame))
+    {
+        mPath.push_back(frame);
+
+        frame.rightNumerator += frame.leftNumerator;
+        frame.rightDenominator += frame.leftDenominator;
+        ++frame.depth;
+    }
+}
+
+bool SternBrocotSequence::Iterator::isInRange(long long numerator, long long denominator) const
+{
+    return !isLess(numerator, denominator, mSequence->mLowerNumerator, mSequence->mLowerDenominator) &&
+           (0 == mSequence->mUpperDenominator || !isLess(mSequence->mUpperNumerator, mSequence->mUpperDenominator, numerator, denominator));
+}
+
+// the subtree nodes are strictly between its bounds (the right one might be 1/0)
+bool SternBrocotSequence::Iterator::intersectsRange(const Frame& frame) const
+{
+    return isLess(mSequence->mLowerNumerator, mSequence->mLowerDenominator, frame.rightNumerator, frame.rightDenominator) &&
+           (0 == mSequence->mUpperDenominator || isLess(frame.leftNumerator, frame.leftDenominator, mSequence->mUpperNumerator, mSequence->mUpperDenominator));
+}
+
+SternBrocotSequence::SternBrocotSequence(int maxDepth)
+    : mMaxDepth{maxDepth}
+    , mLowerNumerator{0}
+    , mLowerDenominator{1}
+    , mUpperNumerator{1}
+    , mUpperDenominator{0}
+{
+    if (maxDepth < 0 || maxDepth > scMaxSternBrocotDepth)
+    {
+        throw std::runtime_error{"Error! The Stern-Brocot tree depth is out of range"};
+    }
+}
+
+SternBrocotSequence::SternBrocotSequence(int maxDepth, const Fraction& lower, const Fraction& upper)
+    : SternBrocotSequence{maxDepth}
+{
+    mLowerNumerator = lower.getNumerator();
+    mLowerDenominator = lower.getDenominator();
+    mUpperNumerator = upper.getNumerator();
+    mUpperDenominator = upper.getDenominator();
+}
+
+int SternBrocotSequence::getMaxDepth() const
+{
+    return mMaxDepth;
+}
+
+SternBrocotSequence::Iterator SternBrocotSequence::begin() const
+{
+    return Iterator{*this};
+}
+
+SternBrocotSequence::Iterator SternBrocotSequence::end() const
+{
+    return Iterator{};
+}
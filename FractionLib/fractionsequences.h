@@ -0,0 +1,147 @@
+#ifndef FRACTIONSEQUENCES_H
+#define FRACTIONSEQUENCES_H
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+
+#include "fraction.h"
+
+/* Farey sequence of a given order: all reduced fractions with denominators not larger than the order, in increasing order, restricted to a closed range
+   - the successor of two consecutive elements a/b < c/d is (k * c - a) / (k * d - b) with k = (order + b) / d, so each step is O(1) and computes no GCD
+     (consecutive elements always have b * c - a * d = 1, which keeps them reduced)
+   - the first element and its successor are found once by a Stern-Brocot descent (O(log) continued fraction steps)
+   - the range may contain negative values and values larger than 1, all the elements must fit into int: |bound| * order <= the maximum int
+*/
+class FareySequence
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = Fraction;
+        using difference_type = std::ptrdiff_t;
+        using reference = Fraction;
+
+        Iterator();     // past the end iterator
+
+        Fraction operator*() const;
+
+        Iterator& operator++();
+        Iterator operator++(int);
+
+        bool operator==(const Iterator& iterator) const;
+
+    private:
+        friend class FareySequence;
+
+        Iterator(int order, long long numerator, long long denominator, long long nextNumerator, long long nextDenominator,
+                 long long lastNumerator, long long lastDenominator);
+
+        long long mOrder;
+        long long mNumerator;
+        long long mDenominator;
+        long long mNextNumerator;
+        long long mNextDenominator;
+        long long mLastNumerator;
+        long long mLastDenominator;
+        bool mIsEnd;
+    };
+
+    // constructors
+    explicit FareySequence(int order);                                              // the elements of [0, 1]
+    FareySequence(int order, const Fraction& lower, const Fraction& upper);        // the elements of [lower, upper]
+
+    int getOrder() const;
+    bool isEmpty() const;
+
+    Iterator begin() const;
+    Iterator end() const;
+
+    /* Splits the sequence into consecutive subsequences of about equal value ranges (each element belongs to exactly one of them, some might be empty),
+       so that the chunks can be enumerated in parallel
+    */
+    std::vector<FareySequence> split(size_t chunksCount) const;
+
+private:
+    FareySequence(int order, long long firstNumerator, long long firstDenominator, long long lastNumerator, long long lastDenominator);
+
+    long long mOrder;
+    long long mFirstNumerator;
+    long long mFirstDenominator;
+    long long mLastNumerator;
+    long long mLastDenominator;
+};
+
+/* In-order (i.e. increasing) enumeration of the Stern-Brocot tree nodes up to a maximum depth (the root 1/1 has depth 1), optionally restricted to a range
+   - each node is the mediant of its two bounds, which are adjacent, so the nodes are always reduced and no GCD is computed
+   - the traversal keeps the path to the current node (at most maxDepth frames), each node is pushed and popped once (O(1) amortized per step),
+     the subtrees outside the range are skipped
+   - the depth is limited to 45 so that all nodes fit into int (the largest terms are Fibonacci numbers)
+*/
+class SternBrocotSequence
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = Fraction;
+        using difference_type = std::ptrdiff_t;
+        using reference = Fraction;
+
+        Iterator();     // past the end iterator
+
+        Fraction operator*() const;
+
+        Iterator& operator++();
+        Iterator operator++(int);
+
+        bool operator==(const Iterator& iterator) const;
+
+    private:
+        friend class SternBrocotSequence;
+
+        // subtree rooted at the mediant of its bounds
+        struct Frame
+        {
+            long long leftNumerator;
+            long long leftDenominator;
+            long long rightNumerator;
+            long long rightDenominator;
+            int depth;
+        };
+
+        explicit Iterator(const SternBrocotSequence& sequence);
+
+        void pushLeftPath(Frame frame);
+        bool isInRange(long long numerator, long long denominator) const;
+        bool intersectsRange(const Frame& frame) const;
+
+        const SternBrocotSequence* mSequence;
+        std::vector<Frame> mPath;
+        long long mNumerator;
+        long long mDenominator;
+    };
+
+    // constructors
+    explicit SternBrocotSequence(int maxDepth);                                             // all nodes up to the depth
+    SternBrocotSequence(int maxDepth, const Fraction& lower, const Fraction& upper);       // the nodes of [lower, upper] up to the depth
+
+    int getMaxDepth() const;
+
+    Iterator begin() const;
+    Iterator end() const;
+
+private:
+    int mMaxDepth;
+    long long mLowerNumerator;
+    long long mLowerDenominator;
+    long long mUpperNumerator;
+    long long mUpperDenominator;    // 0 when there is no upper bound
+};
+
+#endif // FRACTIONSEQUENCES_H
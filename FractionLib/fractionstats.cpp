@@ -0,0 +1,400 @@
+#include <stdexcept>
+
+#include "fractionstats.h"
+
+// 64 bit cross products, exact for all int terms
+static bool isLess(const Fraction& first, const Fraction& second)
+{
+    return static_cast<long long>(first.getNumerator()) * second.getDenominator() < static_cast<long long>(second.getNumerator()) * first.getDenominator();
+}
+
+static WideFraction toWideCount(uint64_t count)
+{
+    return WideFraction{WideInteger{static_cast<long long>(count)}};
+}
+
+FractionStats::FractionStats()
+    : mCount{0}
+    , mIsWide{false}
+{
+}
+
+void FractionStats::add(const Fraction& value)
+{
+    if (!mIsWide)
+    {
+        try
+        {
+            // both sums are assigned only when both have been computed, so they are still valid on overflow
+            const CheckedFraction cValue{value};
+            const Moments<CheckedFraction> cMoments{mCheckedMoments.sum + cValue, mCheckedMoments.squaresSum + cValue * cValue};
+
+            mCheckedMoments = cMoments;
+        }
+        catch (const std::overflow_error&)
+        {
+            switchToWide();
+        }
+    }
+
+    if (mIsWide)
+    {
+        const WideFraction cValue{value};
+
+        mWideMoments.sum += cValue;
+        mWideMoments.squaresSum += cValue * cValue;
+    }
+
+    if (0 == mCount || isLess(value, mMin))
+    {
+        mMin = value;
+    }
+
+    if (0 == mCount || isLess(mMax, value))
+    {
+        mMax = value;
+    }
+
+    ++mCount;
+}
+
+void FractionStats::merge(const FractionStats& stats)
+{
+    if (0 == stats.mCount)
+    {
+        return;
+    }
+
+    if (0 == mCount)
+    {
+        *this = stats;
+        return;
+    }
+
+    if (!mIsWide && !stats.mIsWide)
+    {
+        try
+        {
+            const Moments<CheckedFraction> cMoments{mCheckedMoments.sum + stats.mCheckedMoments.sum, mCheckedMoments.squaresSum + stats.mCheckedMoments.squaresSum};
+
+            mCheckedMoments = cMoments;
+        }
+        catch (const std::overflow_error&)
+        {
+            switchToWide();
+        }
+    }
+    else if (!mIsWide)
+    {
+        switchToWide();
+    }
+
+    if (mIsWide)
+    {
+        const Moments<WideFraction> cOtherMoments{stats.getWideMoments()};
+
+        mWideMoments.sum += cOtherMoments.sum;
+        mWideMoments.squaresSum += cOtherMoments.squaresSum;
+    }
+
+    if (isLess(stats.mMin, mMin))
+    {
+        mMin = stats.mMin;
+    }
+
+    if (isLess(mMax, stats.mMax))
+    {
+        mMax = stats.mMax;
+    }
+
+    mCount += stats.mCount;
+}
+
+void FractionStats::reset()
+{
+    *this = FractionStats{};
+}
+
+uint64_t FractionStats::getCount() const
+{
+    return mCount;
+}
+
+WideFraction FractionStats::getSum() const
+{
+    return mIsWide ? mWideMoments.sum : mCheckedMoments.sum.toWideFraction();
+}
+
+WideFraction FractionStats::getMean() const
+{
+    if (0 == mCount)
+    {
+        throw std::runtime_error{"Error! No values"};
+    }
+
+    const WideFraction cResult{getSum() / toWideCount(mCount)};
+
+    return cResult;
+}
+
+WideFraction FractionStats::getVariance() const
+{
+    if (0 == mCount)
+    {
+        throw std::runtime_error{"Error! No values"};
+    }
+
+    const WideFraction cResult{getSquaredDeviationsSum() / toWideCount(mCount)};
+
+    return cResult;
+}
+
+WideFraction FractionStats::getSampleVariance() const
+{
+    if (mCount < 2)
+    {
+        throw std::runtime_error{"Error! Not enough values"};
+    }
+
+    const WideFraction cResult{getSquaredDeviationsSum() / toWideCount(mCount - 1)};
+
+    return cResult;
+}
+
+Fraction FractionStats::getMin() const
+{
+    if (0 == mCount)
+    {
+        throw std::runtime_error{"Error! No values"};
+    }
+
+    return mMin;
+}
+
+Fraction FractionStats::getMax() const
+{
+    if (0 == mCount)
+    {
+        throw std::runtime_error{"Error! No values"};
+    }
+
+    return mMax;
+}
+
+bool FractionStats::isWide() const
+{
+    return mIsWide;
+}
+
+void FractionStats::switchToWide()
+{
+    mWideMoments = getWideMoments();
+    mIsWide = true;
+}
+
+FractionStats::Moments<WideFraction> FractionStats::getWideMoments() const
+{
+    return mIsWide ? mWideMoments : Moments<WideFraction>{mCheckedMoments.sum.toWideFraction(), mCheckedMoments.squaresSum.toWideFraction()};
+}
+
+// sum of (x - mean)^2 = sum of x^2 - (sum of x)^2 / n
+WideFraction FractionStats::getSquaredDeviationsSum() const
+{
+    const Moments<WideFraction> cMoments{getWideMoments()};
+    const WideFraction cResult{cMoments.squaresSum - cMoments.sum * cMoments.sum / toWideCount(mCount)};
+
+    return cResult;
+}
+
+FractionWindowStats::FractionWindowStats(size_t windowSize)
+    : mNextIndex{0}
+    , mCount{0}
+    , mIsWide{false}
+{
+    if (0 == windowSize)
+    {
+        throw std::runtime_error{"Error! Invalid window size"};
+    }
+
+    mValues.resize(windowSize);
+}
+
+void FractionWindowStats::add(const Fraction& value)
+{
+    const bool cIsFull{mValues.size() == mCount};
+
+    updateSum(value, cIsFull ? &mValues[mNextIndex] : nullptr);
+
+    mValues[mNextIndex] = value;
+    mNextIndex = mValues.size() == mNextIndex + 1 ? 0 : mNextIndex + 1;
+
+    if (!cIsFull)
+    {
+        ++mCount;
+    }
+}
+
+size_t FractionWindowStats::getWindowSize() const
+{
+    return mValues.size();
+}
+
+size_t FractionWindowStats::getCount() const
+{
+    return mCount;
+}
+
+WideFraction FractionWindowStats::getSum() const
+{
+    return mIsWide ? mWideSum : mCheckedSum.toWideFraction();
+}
+
+WideFraction FractionWindowStats::getMean() const
+{
+    if (0 == mCount)
+    {
+        throw std::runtime_error{"Error! No values"};
+    }
+
+    const WideFraction cResult{getSum() / toWideCount(mCount)};
+
+    return cResult;
+}
+
+bool FractionWindowStats::isWide() const
+{
+    return mIsWide;
+}
+
+void FractionWindowStats::updateSum(const Fraction& addedValue, const Fraction* removedValue)
+{
+    if (!mIsWide)
+    {
+        try
+        {
+            CheckedFraction sum{mCheckedSum + CheckedFraction{addedValue}};
+
+            if (removedValue)
+            {
+                sum -= CheckedFraction{*removedValue};
+            }
+
+            mCheckedSum = sum;
+            return;
+        }
+        catch (const std::overflow_error&)
+        {
+            mWideSum = mCheckedSum.toWideFraction();
+            mIsWide = true;
+        }
+    }
+
+    mWideSum += WideFraction{addedValue};
+
+    if (removedValue)
+    {
+        mWideSum -= WideFraction{*removedValue};
+    }
+
+    // the large values may leave the window, the sum goes back to 64 bit terms once they fit again
+    if (mWideSum.getNumerator().fitsLongLong() && mWideSum.getDenominator().fitsLongLong())
+    {
+        try
+        {
+            mCheckedSum = CheckedFraction{mWideSum.getNumerator().toLongLong(), mWideSum.getDenominator().toLongLong()};
+            mIsWide = false;
+        }
+        catch (const std::overflow_error&)
+        {
+        }
+    }
+}
+
+bool FractionQuantiles::ValueLess::operator()(const Fraction& first, const Fraction& second) const
+{
+    return isLess(first, second);
+}
+
+void FractionQuantiles::add(const Fraction& value, uint64_t occurrencesCount)
+{
+    if (occurrencesCount > 0)
+    {
+        mOccurrences[value] += occurrencesCount;
+        mCount += occurrencesCount;
+    }
+}
+
+void FractionQuantiles::remove(const Fraction& value)
+{
+    const auto cIt{mOccurrences.find(value)};
+
+    if (mOccurrences.end() == cIt)
+    {
+        throw std::runtime_error{"Error! Missing value"};
+    }
+
+    if (0 == --cIt->second)
+    {
+        mOccurrences.erase(cIt);
+    }
+
+    --mCount;
+}
+
+void FractionQuantiles::merge(const FractionQuantiles& quantiles)
+{
+    for (const auto& [value, occurrencesCount] : quantiles.mOccurrences)
+    {
+        mOccurrences[value] += occurrencesCount;
+    }
+
+    mCount += quantiles.mCount;
+}
+
+uint64_t FractionQuantiles::getCount() const
+{
+    return mCount;
+}
+
+size_t FractionQuantiles::getDistinctValuesCount() const
+{
+    return mOccurrences.size();
+}
+
+Fraction FractionQuantiles::getQuantile(const Fraction& probability) const
+{
+    if (probability < Fraction{0} || probability > Fraction{1})
+    {
+        throw std::runtime_error{"Error! Invalid probability"};
+    }
+
+    if (0 == mCount)
+    {
+        throw std::runtime_error{"Error! No values"};
+    }
+
+    // rank = ceil(p * count) computed exactly, at least 1
+    const WideInteger cScaledCount{WideInteger{probability.getNumerator()} * WideInteger{static_cast<long long>(mCount)}};
+    const WideInteger cDenominator{probability.getDenominator()};
+    const WideInteger cRank{(cScaledCount + cDenominator - WideInteger{1}) / cDenominator};
+    const uint64_t cRequiredCount{cRank ? static_cast<uint64_t>(cRank.toLongLong()) : 1};
+
+    uint64_t cumulatedCount{0};
+
+    for (const auto& [value, occurrencesCount] : mOccurrences)
+    {
+        cumulatedCount += occurrencesCount;
+
+        if (cumulatedCount >= cRequiredCount)
+        {
+            return value;
+        }
+    }
+
+    return mOccurrences.rbegin()->first;
+}
+
+Fraction FractionQuantiles::getMedian() const
+{
+    return getQuantile(Fraction{1, 2});
+}
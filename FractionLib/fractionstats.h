@@ -0,0 +1,120 @@
+#ifndef FRACTIONSTATS_H
+#define FRACTIONSTATS_H
+
+#include <map>
+#include <vector>
+#include <cstdint>
+
+#include "fraction.h"
+#include "checkedfraction.h"
+#include "widefraction.h"
+
+/* Single pass exact statistics of a stream of fractions: count, sum, mean, variance, min and max
+   - only the sum and the sum of squares are accumulated: the arithmetic is exact, so there is no cancellation to avoid with Welford's updates,
+     and the denominators of the power sums stay bounded by the common denominator of the values (the running mean would add a factor n)
+   - the sums are computed with 64 bit terms (CheckedFraction) and switch to wide terms (WideFraction) on the first overflow,
+     so the results are always exact and the values are never kept
+   - the partial states of separate ranges can be merged (e.g. one accumulator per thread)
+*/
+class FractionStats
+{
+public:
+    // constructors
+    FractionStats();
+
+    void add(const Fraction& value);
+    void merge(const FractionStats& stats);
+    void reset();
+
+    // getters (the mean, variances, min and max throw when there are not enough values)
+    uint64_t getCount() const;
+    WideFraction getSum() const;
+    WideFraction getMean() const;
+    WideFraction getVariance() const;           // population variance: sum of the squared deviations / count
+    WideFraction getSampleVariance() const;     // sum of the squared deviations / (count - 1)
+    Fraction getMin() const;
+    Fraction getMax() const;
+
+    // true after an overflow of the 64 bit terms
+    bool isWide() const;
+
+private:
+    // power sums of the values
+    template<typename Number>
+    struct Moments
+    {
+        Number sum;
+        Number squaresSum;
+    };
+
+    void switchToWide();
+    Moments<WideFraction> getWideMoments() const;
+    WideFraction getSquaredDeviationsSum() const;
+
+    uint64_t mCount;
+    Moments<CheckedFraction> mCheckedMoments;
+    Moments<WideFraction> mWideMoments;
+    bool mIsWide;
+    Fraction mMin;
+    Fraction mMax;
+};
+
+/* Sum and mean of the last windowSize values of a stream, each new value updates them in O(1) (the evicted value is subtracted)
+   - the window values are kept in a ring buffer, the sum has 64 bit terms and switches to wide terms while they overflow
+*/
+class FractionWindowStats
+{
+public:
+    // constructors
+    explicit FractionWindowStats(size_t windowSize);
+
+    void add(const Fraction& value);
+
+    size_t getWindowSize() const;
+    size_t getCount() const;                    // values in the window (less than the window size at the beginning of the stream)
+    WideFraction getSum() const;
+    WideFraction getMean() const;
+
+    bool isWide() const;
+
+private:
+    void updateSum(const Fraction& addedValue, const Fraction* removedValue);
+
+    std::vector<Fraction> mValues;
+    size_t mNextIndex;
+    size_t mCount;
+    CheckedFraction mCheckedSum;
+    WideFraction mWideSum;
+    bool mIsWide;
+};
+
+/* Exact quantiles: the distinct values are kept with their counts, so the memory is bounded by the number of distinct values
+   (e.g. quantized measurements) instead of the number of values
+   - the values can also be removed, e.g. the ones leaving a sliding window (the memory is then bounded by the window size)
+   - the quantile p is the smallest value v such that at least ceil(p * count) values are not larger than v (the inverse of the distribution function)
+*/
+class FractionQuantiles
+{
+public:
+    void add(const Fraction& value, uint64_t occurrencesCount = 1);
+    void remove(const Fraction& value);         // throws if the value is missing
+    void merge(const FractionQuantiles& quantiles);
+
+    uint64_t getCount() const;
+    size_t getDistinctValuesCount() const;
+
+    Fraction getQuantile(const Fraction& probability) const;
+    Fraction getMedian() const;                 // the lower median
+
+private:
+    // exact order of the values (64 bit cross products, the int ones of the Fraction comparison overflow for large terms)
+    struct ValueLess
+    {
+        bool operator()(const Fraction& first, const Fraction& second) const;
+    };
+
+    std::map<Fraction, uint64_t, ValueLess> mOccurrences;
+    uint64_t mCount{0};
+};
+
+#endif // FRACTIONSTATS_H
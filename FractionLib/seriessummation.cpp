@@ -0,0 +1,124 @@
+#include <bit>
+#include <future>
+#include <thread>
+#include <algorithm>
+#include <stdexcept>
+
+#include "seriessummation.h"
+
+// smaller ranges are not worth a thread
+static constexpr long long scMinParallelRangeSize{32};
+
+// partial sum numerator / denominator of a range of independent terms (not reduced)
+struct SumNode
+{
+    WideInteger numerator;
+    WideInteger denominator;
+};
+
+/* Range [a, b) of a ratio products series: P = p(a) * ... * p(b - 1), Q = q(a) * ... * q(b - 1)
+   and T / Q = sum of the products of the ratios from a to k for a <= k < b
+*/
+struct RatioNode
+{
+    WideInteger p;
+    WideInteger q;
+    WideInteger t;
+};
+
+static SeriesSummation::Term getCheckedTerm(const SeriesSummation::TermFunction& term, long long index)
+{
+    SeriesSummation::Term result{term(index)};
+
+    if (result.denominator.isZero())
+    {
+        throw std::runtime_error{"Error! Division by 0 in series term " + std::to_string(index)};
+    }
+
+    return result;
+}
+
+// number of tree levels whose left subtrees get their own thread, so that about threadsCount subtrees run at the same time
+static size_t getParallelDepth(size_t threadsCount)
+{
+    if (0 == threadsCount)
+    {
+        threadsCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    return static_cast<size_t>(std::bit_width(threadsCount - 1));
+}
+
+template<typename Node, typename Leaf, typename Combine>
+static Node splitRange(long long begin, long long end, size_t parallelDepth, const Leaf& leaf, const Combine& combine)
+{
+    if (1 == end - begin)
+    {
+        return leaf(begin);
+    }
+
+    const long long cMiddle{begin + (end - begin) / 2};
+
+    if (0 != parallelDepth && end - begin >= scMinParallelRangeSize)
+    {
+        std::future<Node> leftFuture{std::async(std::launch::async, [begin, cMiddle, parallelDepth, &leaf, &combine]()
+        {
+            return splitRange<Node>(begin, cMiddle, parallelDepth - 1, leaf, combine);
+        })};
+
+        const Node cRight{splitRange<Node>(cMiddle, end, parallelDepth - 1, leaf, combine)};
+
+        return combine(leftFuture.get(), cRight);
+    }
+
+    return combine(splitRange<Node>(begin, cMiddle, 0, leaf, combine), splitRange<Node>(cMiddle, end, 0, leaf, combine));
+}
+
+WideFraction SeriesSummation::sumTerms(const TermFunction& term, long long begin, long long end, size_t threadsCount)
+{
+    if (end <= begin)
+    {
+        return WideFraction{};
+    }
+
+    const auto cLeaf{[&term](long long index)
+    {
+        Term leafTerm{getCheckedTerm(term, index)};
+        return SumNode{std::move(leafTerm.numerator), std::move(leafTerm.denominator)};
+    }};
+
+    const auto cCombine{[](const SumNode& left, const SumNode& right)
+    {
+        return SumNode{left.numerator * right.denominator + right.numerator * left.denominator, left.denominator * right.denominator};
+    }};
+
+    const SumNode cSum{splitRange<SumNode>(begin, end, getParallelDepth(threadsCount), cLeaf, cCombine)};
+    const WideFraction cResult{cSum.numerator, cSum.denominator};
+
+    return cResult;
+}
+
+WideFraction SeriesSummation::sumRatioProducts(const TermFunction& ratio, long long begin, long long end, size_t threadsCount)
+{
+    if (end <= begin)
+    {
+        return WideFraction{};
+    }
+
+    const auto cLeaf{[&ratio](long long index)
+    {
+        Term leafRatio{getCheckedTerm(ratio, index)};
+        return RatioNode{leafRatio.numerator, std::move(leafRatio.denominator), leafRatio.numerator};
+    }};
+
+    // the products of the right range are scaled by the product of the ratios of the left range
+    const auto cCombine{[](const RatioNode& left, const RatioNode& right)
+    {
+        return RatioNode{left.p * right.p, left.q * right.q, left.t * right.q + left.p * right.t};
+    }};
+
+    const RatioNode cSum{splitRange<RatioNode>(begin, end, getParallelDepth(threadsCount), cLeaf, cCombine)};
+    const WideFraction cResult{cSum.t, cSum.q};
+
+    return cResult;
+}
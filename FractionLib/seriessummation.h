@@ -0,0 +1,37 @@
+#ifndef SERIESSUMMATION_H
+#define SERIESSUMMATION_H
+
+#include <functional>
+
+#include "wideinteger.h"
+#include "widefraction.h"
+
+/* Exact partial sums of rational series computed by binary splitting
+   - the range of indexes is halved recursively and the partial results of the halves are combined in a balanced tree,
+     so the operands of each multiplication have similar sizes (instead of a huge accumulated sum times a small term)
+   - the numerators and denominators are not reduced while combining (delayed reduction), the single GCD is computed for the final result
+   - the subtrees of the first levels are computed in parallel (the term functions must be safe to call concurrently)
+*/
+class SeriesSummation
+{
+public:
+    struct Term
+    {
+        WideInteger numerator;
+        WideInteger denominator;
+    };
+
+    // p(k) / q(k) for the index k
+    using TermFunction = std::function<Term(long long index)>;
+
+    /* Sum of term(k) for begin <= k < end (e.g. the harmonic numbers with term(k) = 1 / k)
+    */
+    static WideFraction sumTerms(const TermFunction& term, long long begin, long long end, size_t threadsCount = 1);
+
+    /* Sum of the products ratio(begin) * ratio(begin + 1) * ... * ratio(k) for begin <= k < end, i.e. the series whose terms are obtained
+       from the previous ones by multiplying with a rational function of the index (hypergeometric series, e.g. e - 1 with ratio(k) = 1 / k, begin = 1)
+    */
+    static WideFraction sumRatioProducts(const TermFunction& ratio, long long begin, long long end, size_t threadsCount = 1);
+};
+
+#endif // SERIESSUMMATION_H
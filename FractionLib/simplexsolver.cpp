@@ -0,0 +1,629 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "simplexsolver.h"
+
+// pivots after which the eta file is discarded and the basis inverse is rebuilt from the basic columns
+static constexpr size_t scReinversionPeriod{64};
+
+// consecutive degenerate pivots after which the Dantzig rule gives way to Bland's rule (so the solver cannot cycle)
+static constexpr size_t scMaxDegeneratePivotsCount{16};
+
+using SparseColumn = std::vector<std::pair<size_t, WideFraction>>;
+using DenseVector = std::vector<WideFraction>;
+
+namespace
+{
+
+/* Product form of the basis inverse: B^-1 = E_k * ... * E_1, where each E_i differs from the identity only in the column of its pivot row
+*/
+class EtaFile
+{
+public:
+    void clear()
+    {
+        mEtas.clear();
+    }
+
+    // transformedColumn is B^-1 * a for the entering column a, i.e. the column replacing the basic variable at pivotRow
+    void append(size_t pivotRow, const DenseVector& transformedColumn)
+    {
+        Eta eta{pivotRow, transformedColumn[pivotRow], {}};
+
+        for (size_t row{0}; row < transformedColumn.size(); ++row)
+        {
+            if (row != pivotRow && transformedColumn[row])
+            {
+                eta.offPivotEntries.emplace_back(row, transformedColumn[row]);
+            }
+        }
+
+        mEtas.push_back(std::move(eta));
+    }
+
+    // FTRAN: vector := B^-1 * vector
+    void applyForward(DenseVector& vector) const
+    {
+        for (const Eta& eta : mEtas)
+        {
+            if (vector[eta.pivotRow])
+            {
+                vector[eta.pivotRow] /= eta.pivot;
+
+                for (const auto& entry : eta.offPivotEntries)
+                {
+                    vector[entry.first] -= entry.second * vector[eta.pivotRow];
+                }
+            }
+        }
+    }
+
+    // BTRAN: vector^T := vector^T * B^-1
+    void applyBackward(DenseVector& vector) const
+    {
+        for (auto etaIt{mEtas.crbegin()}; etaIt != mEtas.crend(); ++etaIt)
+        {
+            WideFraction pivotValue{vector[etaIt->pivotRow]};
+
+            for (const auto& entry : etaIt->offPivotEntries)
+            {
+                if (vector[entry.first])
+                {
+                    pivotValue -= vector[entry.first] * entry.second;
+                }
+            }
+
+            vector[etaIt->pivotRow] = pivotValue / etaIt->pivot;
+        }
+    }
+
+private:
+    struct Eta
+    {
+        size_t pivotRow;
+        WideFraction pivot;
+        SparseColumn offPivotEntries;
+    };
+
+    std::vector<Eta> mEtas;
+};
+
+/* Revised simplex on the standard form min c * x, A * x = b (b >= 0), x >= 0
+*/
+class RevisedSimplex
+{
+public:
+    RevisedSimplex(std::vector<SparseColumn> columns, DenseVector rightHandSide, std::vector<bool> isArtificial, SimplexSolver::PivotingRule pivotingRule)
+        : mRowsCount{rightHandSide.size()}
+        , mColumns{std::move(columns)}
+        , mRightHandSide{std::move(rightHandSide)}
+        , mIsArtificial{std::move(isArtificial)}
+        , mPivotingRule{pivotingRule}
+        , mBasisHead(mRowsCount)
+        , mIsBasic(mColumns.size(), false)
+        , mPivotsSinceReinversionCount{0}
+        , mIterationsCount{0}
+        , mReinversionsCount{0}
+    {
+    }
+
+    // returns false if the basis is singular (the previous basis is then lost, a new one should be set)
+    bool setBasis(const std::vector<size_t>& basis)
+    {
+        std::fill(mIsBasic.begin(), mIsBasic.end(), false);
+
+        for (const size_t column : basis)
+        {
+            mIsBasic[column] = true;
+        }
+
+        mBasisHead = basis;
+
+        return reinvert();
+    }
+
+    const std::vector<size_t>& getBasisHead() const
+    {
+        return mBasisHead;
+    }
+
+    const DenseVector& getBasicValues() const
+    {
+        return mBasicValues;
+    }
+
+    size_t getIterationsCount() const
+    {
+        return mIterationsCount;
+    }
+
+    size_t getReinversionsCount() const
+    {
+        return mReinversionsCount;
+    }
+
+    /* Runs simplex iterations until no eligible column has a negative reduced cost (returns true) or an improving ray is found (returns false);
+       artificial columns that left the basis never reenter
+    */
+    bool optimize(const DenseVector& costs, size_t& rayColumn, DenseVector& rayBasicValues)
+    {
+        size_t degeneratePivotsCount{0};
+
+        while (true)
+        {
+            if (mPivotsSinceReinversionCount >= scReinversionPeriod)
+            {
+                reinvert();
+            }
+
+            const DenseVector cDuals{computeDuals(costs)};
+            const bool cUseBlandRule{SimplexSolver::PivotingRule::BLAND == mPivotingRule || degeneratePivotsCount >= scMaxDegeneratePivotsCount};
+
+            size_t enteringColumn{mColumns.size()};
+            WideFraction enteringReducedCost;
+
+            for (size_t column{0}; column < mColumns.size(); ++column)
+            {
+                if (mIsBasic[column] || mIsArtificial[column])
+                {
+                    continue;
+                }
+
+                const WideFraction cReducedCost{costs[column] - multiplyColumn(cDuals, column)};
+
+                if (cReducedCost < WideFraction{} && (enteringColumn == mColumns.size() || cReducedCost < enteringReducedCost))
+                {
+                    enteringColumn = column;
+                    enteringReducedCost = cReducedCost;
+
+                    if (cUseBlandRule)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if (enteringColumn == mColumns.size())
+            {
+                return true;
+            }
+
+            DenseVector transformedColumn{getTransformedColumn(enteringColumn)};
+
+            // ratio test, ties broken by the smallest basic variable index (Bland)
+            size_t leavingRow{mRowsCount};
+            WideFraction minRatio;
+
+            for (size_t row{0}; row < mRowsCount; ++row)
+            {
+                if (transformedColumn[row] > WideFraction{})
+                {
+                    const WideFraction cRatio{mBasicValues[row] / transformedColumn[row]};
+
+                    if (leavingRow == mRowsCount || cRatio < minRatio || (cRatio == minRatio && mBasisHead[row] < mBasisHead[leavingRow]))
+                    {
+                        leavingRow = row;
+                        minRatio = cRatio;
+                    }
+                }
+            }
+
+            if (leavingRow == mRowsCount)
+            {
+                rayColumn = enteringColumn;
+                rayBasicValues = std::move(transformedColumn);
+
+                return false;
+            }
+
+            degeneratePivotsCount = minRatio ? 0 : degeneratePivotsCount + 1;
+            pivot(enteringColumn, leavingRow, transformedColumn);
+        }
+    }
+
+    // y^T = c_B^T * B^-1
+    DenseVector computeDuals(const DenseVector& costs) const
+    {
+        DenseVector duals(mRowsCount);
+
+        for (size_t row{0}; row < mRowsCount; ++row)
+        {
+            duals[row] = costs[mBasisHead[row]];
+        }
+
+        mEtaFile.applyBackward(duals);
+
+        return duals;
+    }
+
+    /* Degenerate pivots replacing the basic artificial variables (at zero level after a successful phase 1) by non-artificial columns;
+       an artificial variable stays basic only if its row of B^-1 * A is zero outside the artificial columns, i.e. the constraint is redundant
+    */
+    void removeArtificialVariables()
+    {
+        for (size_t row{0}; row < mRowsCount; ++row)
+        {
+            if (!mIsArtificial[mBasisHead[row]])
+            {
+                continue;
+            }
+
+            DenseVector basisInverseRow(mRowsCount);
+            basisInverseRow[row] = WideFraction{WideInteger{1}};
+            mEtaFile.applyBackward(basisInverseRow);
+
+            for (size_t column{0}; column < mColumns.size(); ++column)
+            {
+                if (!mIsBasic[column] && !mIsArtificial[column] && multiplyColumn(basisInverseRow, column))
+                {
+                    pivot(column, row, getTransformedColumn(column));
+                    break;
+                }
+            }
+        }
+    }
+
+private:
+    WideFraction multiplyColumn(const DenseVector& vector, size_t column) const
+    {
+        WideFraction result;
+
+        for (const auto& entry : mColumns[column])
+        {
+            if (vector[entry.first])
+            {
+                result += vector[entry.first] * entry.second;
+            }
+        }
+
+        return result;
+    }
+
+    DenseVector getTransformedColumn(size_t column) const
+    {
+        DenseVector transformedColumn(mRowsCount);
+
+        for (const auto& entry : mColumns[column])
+        {
+            transformedColumn[entry.first] = entry.second;
+        }
+
+        mEtaFile.applyForward(transformedColumn);
+
+        return transformedColumn;
+    }
+
+    void pivot(size_t enteringColumn, size_t leavingRow, const DenseVector& transformedColumn)
+    {
+        const WideFraction cStep{mBasicValues[leavingRow] / transformedColumn[leavingRow]};
+
+        if (cStep)
+        {
+            for (size_t row{0}; row < mRowsCount; ++row)
+            {
+                if (transformedColumn[row])
+                {
+                    mBasicValues[row] -= cStep * transformedColumn[row];
+                }
+            }
+        }
+
+        mBasicValues[leavingRow] = cStep;
+        mIsBasic[mBasisHead[leavingRow]] = false;
+        mIsBasic[enteringColumn] = true;
+        mBasisHead[leavingRow] = enteringColumn;
+        mEtaFile.append(leavingRow, transformedColumn);
+        ++mPivotsSinceReinversionCount;
+        ++mIterationsCount;
+    }
+
+    /* Rebuilds the eta file from scratch by pivoting the basic columns (sparsest first) into an identity matrix, then recomputes x_B = B^-1 * b
+    */
+    bool reinvert()
+    {
+        std::vector<size_t> basicColumns{mBasisHead};
+        std::stable_sort(basicColumns.begin(), basicColumns.end(), [this](size_t first, size_t second) {return mColumns[first].size() < mColumns[second].size();});
+
+        std::vector<bool> isRowAssigned(mRowsCount, false);
+        mEtaFile.clear();
+        mPivotsSinceReinversionCount = 0;
+        ++mReinversionsCount;
+
+        for (const size_t column : basicColumns)
+        {
+            const DenseVector cTransformedColumn{getTransformedColumn(column)};
+
+            size_t pivotRow{mRowsCount};
+            bool isUnitColumn{true};
+
+            for (size_t row{0}; row < mRowsCount; ++row)
+            {
+                if (cTransformedColumn[row])
+                {
+                    if (pivotRow == mRowsCount && !isRowAssigned[row])
+                    {
+                        pivotRow = row;
+                    }
+                    else
+                    {
+                        isUnitColumn = false;
+                    }
+                }
+            }
+
+            if (pivotRow == mRowsCount)
+            {
+                return false;
+            }
+
+            if (!isUnitColumn || cTransformedColumn[pivotRow] != WideFraction{WideInteger{1}})
+            {
+                mEtaFile.append(pivotRow, cTransformedColumn);
+            }
+
+            isRowAssigned[pivotRow] = true;
+            mBasisHead[pivotRow] = column;
+        }
+
+        mBasicValues = mRightHandSide;
+        mEtaFile.applyForward(mBasicValues);
+
+        return true;
+    }
+
+    size_t mRowsCount;
+    std::vector<SparseColumn> mColumns;
+    DenseVector mRightHandSide;
+    std::vector<bool> mIsArtificial;
+    SimplexSolver::PivotingRule mPivotingRule;
+
+    std::vector<size_t> mBasisHead;      // basic column of each row
+    std::vector<bool> mIsBasic;
+    DenseVector mBasicValues;            // x_B
+    EtaFile mEtaFile;
+    size_t mPivotsSinceReinversionCount;
+
+    size_t mIterationsCount;
+    size_t mReinversionsCount;
+};
+
+}
+
+SimplexSolver::SimplexSolver(size_t variablesCount)
+    : mVariablesCount{variablesCount}
+    , mIsMaximization{false}
+    , mPivotingRule{PivotingRule::DANTZIG}
+    , mObjectiveCoefficients(variablesCount)
+{
+}
+
+void SimplexSolver::setObjective(const std::vector<Fraction>& coefficients, bool isMaximization)
+{
+    if (coefficients.size() != mVariablesCount)
+    {
+        throw std::runtime_error{"Error! Incompatible matrix sizes"};
+    }
+
+    mObjectiveCoefficients = coefficients;
+    mIsMaximization = isMaximization;
+}
+
+void SimplexSolver::addConstraint(const std::vector<Fraction>& coefficients, ConstraintType constraintType, const Fraction& rightHandSide)
+{
+    if (coefficients.size() != mVariablesCount)
+    {
+        throw std::runtime_error{"Error! Incompatible matrix sizes"};
+    }
+
+    mConstraintCoefficients.push_back(coefficients);
+    mConstraintTypes.push_back(constraintType);
+    mRightHandSides.push_back(rightHandSide);
+}
+
+void SimplexSolver::setRightHandSide(size_t constraintIndex, const Fraction& rightHandSide)
+{
+    if (constraintIndex >= mRightHandSides.size())
+    {
+        throw std::runtime_error{"Error! Matrix index out of range"};
+    }
+
+    mRightHandSides[constraintIndex] = rightHandSide;
+}
+
+void SimplexSolver::setPivotingRule(PivotingRule pivotingRule)
+{
+    mPivotingRule = pivotingRule;
+}
+
+size_t SimplexSolver::getVariablesCount() const
+{
+    return mVariablesCount;
+}
+
+size_t SimplexSolver::getConstraintsCount() const
+{
+    return mConstraintTypes.size();
+}
+
+SimplexSolver::Result SimplexSolver::solve(const std::vector<size_t>& initialBasis) const
+{
+    const size_t cRowsCount{mConstraintTypes.size()};
+    const size_t cSlacksCount{static_cast<size_t>(std::count_if(mConstraintTypes.cbegin(), mConstraintTypes.cend(),
+                                                                [](ConstraintType constraintType) {return ConstraintType::EQUAL != constraintType;}))};
+    const size_t cArtificialsOffset{mVariablesCount + cSlacksCount};
+    const size_t cColumnsCount{cArtificialsOffset + cRowsCount};
+
+    // standard form: rows with a negative right hand side are negated so that b >= 0 (the artificial columns always form an identity)
+    std::vector<SparseColumn> columns(cColumnsCount);
+    DenseVector rightHandSide(cRowsCount);
+    std::vector<bool> isNegatedRow(cRowsCount);
+    std::vector<bool> isArtificial(cColumnsCount, false);
+    std::vector<size_t> startingBasis(cRowsCount);
+
+    for (size_t row{0}, slackColumn{mVariablesCount}; row < cRowsCount; ++row)
+    {
+        rightHandSide[row] = WideFraction{mRightHandSides[row]};
+        isNegatedRow[row] = rightHandSide[row] < WideFraction{};
+
+        if (isNegatedRow[row])
+        {
+            rightHandSide[row] = -rightHandSide[row];
+        }
+
+        for (size_t column{0}; column < mVariablesCount; ++column)
+        {
+            const WideFraction cCoefficient{mConstraintCoefficients[row][column]};
+
+            if (cCoefficient)
+            {
+                columns[column].emplace_back(row, isNegatedRow[row] ? -cCoefficient : cCoefficient);
+            }
+        }
+
+        startingBasis[row] = cArtificialsOffset + row;
+
+        if (ConstraintType::EQUAL != mConstraintTypes[row])
+        {
+            const bool cIsSlackPositive{(ConstraintType::LESS_OR_EQUAL == mConstraintTypes[row]) != isNegatedRow[row]};
+            columns[slackColumn].emplace_back(row, WideFraction{WideInteger{cIsSlackPositive ? 1 : -1}});
+
+            if (cIsSlackPositive)
+            {
+                startingBasis[row] = slackColumn;
+            }
+
+            ++slackColumn;
+        }
+
+        columns[cArtificialsOffset + row].emplace_back(row, WideFraction{WideInteger{1}});
+        isArtificial[cArtificialsOffset + row] = true;
+    }
+
+    DenseVector phaseOneCosts(cColumnsCount);
+    DenseVector phaseTwoCosts(cColumnsCount);
+
+    for (size_t column{0}; column < mVariablesCount; ++column)
+    {
+        phaseTwoCosts[column] = mIsMaximization ? -WideFraction{mObjectiveCoefficients[column]} : WideFraction{mObjectiveCoefficients[column]};
+    }
+
+    for (size_t row{0}; row < cRowsCount; ++row)
+    {
+        phaseOneCosts[cArtificialsOffset + row] = WideFraction{WideInteger{1}};
+    }
+
+    RevisedSimplex simplex{std::move(columns), std::move(rightHandSide), isArtificial, mPivotingRule};
+
+    // warm start: the given basis is used if it has the right size, no duplicates and it is nonsingular and primal feasible
+    bool isWarmStarted{false};
+
+    if (initialBasis.size() == cRowsCount &&
+        std::all_of(initialBasis.cbegin(), initialBasis.cend(), [cColumnsCount](size_t column) {return column < cColumnsCount;}))
+    {
+        std::vector<size_t> sortedBasis{initialBasis};
+        std::sort(sortedBasis.begin(), sortedBasis.end());
+
+        isWarmStarted = std::adjacent_find(sortedBasis.cbegin(), sortedBasis.cend()) == sortedBasis.cend() && simplex.setBasis(initialBasis) &&
+                        std::none_of(simplex.getBasicValues().cbegin(), simplex.getBasicValues().cend(), [](const WideFraction& value) {return value < WideFraction{};});
+    }
+
+    if (!isWarmStarted)
+    {
+        simplex.setBasis(startingBasis);
+    }
+
+    Result result{Status::OPTIMAL, WideFraction{}, DenseVector(mVariablesCount), DenseVector(cRowsCount), {}, {}, 0, 0};
+
+    auto mapDuals{[&result, &isNegatedRow](const DenseVector& duals, bool isNegated)
+    {
+        for (size_t row{0}; row < duals.size(); ++row)
+        {
+            result.dualValues[row] = isNegatedRow[row] != isNegated ? -duals[row] : duals[row];
+        }
+    }};
+
+    auto finalizeResult{[&result, &simplex]()
+    {
+        result.basis = simplex.getBasisHead();
+        result.iterationsCount = simplex.getIterationsCount();
+        result.reinversionsCount = simplex.getReinversionsCount();
+
+        return result;
+    }};
+
+    size_t rayColumn{0};
+    DenseVector rayBasicValues;
+
+    // phase 1: minimize the sum of the artificial variables (bounded below by 0, so it always ends optimal)
+    bool hasPositiveArtificials{false};
+
+    for (size_t row{0}; row < cRowsCount; ++row)
+    {
+        hasPositiveArtificials = hasPositiveArtificials || (isArtificial[simplex.getBasisHead()[row]] && simplex.getBasicValues()[row]);
+    }
+
+    if (hasPositiveArtificials)
+    {
+        simplex.optimize(phaseOneCosts, rayColumn, rayBasicValues);
+
+        WideFraction infeasibility;
+
+        for (size_t row{0}; row < cRowsCount; ++row)
+        {
+            if (isArtificial[simplex.getBasisHead()[row]])
+            {
+                infeasibility += simplex.getBasicValues()[row];
+            }
+        }
+
+        if (infeasibility)
+        {
+            result.status = Status::INFEASIBLE;
+            mapDuals(simplex.computeDuals(phaseOneCosts), false);
+
+            return finalizeResult();
+        }
+    }
+
+    simplex.removeArtificialVariables();
+
+    // phase 2
+    const bool cIsBounded{simplex.optimize(phaseTwoCosts, rayColumn, rayBasicValues)};
+
+    if (!cIsBounded)
+    {
+        result.status = Status::UNBOUNDED;
+        result.unboundedRay.resize(mVariablesCount);
+        result.dualValues.clear();
+
+        if (rayColumn < mVariablesCount)
+        {
+            result.unboundedRay[rayColumn] = WideFraction{WideInteger{1}};
+        }
+
+        for (size_t row{0}; row < cRowsCount; ++row)
+        {
+            if (simplex.getBasisHead()[row] < mVariablesCount)
+            {
+                result.unboundedRay[simplex.getBasisHead()[row]] = -rayBasicValues[row];
+            }
+        }
+
+        return finalizeResult();
+    }
+
+    for (size_t row{0}; row < cRowsCount; ++row)
+    {
+        const size_t cColumn{simplex.getBasisHead()[row]};
+
+        if (cColumn < mVariablesCount)
+        {
+            result.primalValues[cColumn] = simplex.getBasicValues()[row];
+            result.objectiveValue += WideFraction{mObjectiveCoefficients[cColumn]} * simplex.getBasicValues()[row];
+        }
+    }
+
+    mapDuals(simplex.computeDuals(phaseTwoCosts), mIsMaximization);
+
+    return finalizeResult();
+}
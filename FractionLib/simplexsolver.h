@@ -0,0 +1,77 @@
+#ifndef SIMPLEXSOLVER_H
+#define SIMPLEXSOLVER_H
+
+#include <vector>
+
+#include "widefraction.h"
+
+/* Exact two-phase revised simplex solver for: minimize/maximize c * x subject to A * x (<=, =, >=) b, x >= 0
+   - all values are wide fractions, so the pivots never overflow and the reported optimum/certificates are exact
+   - the basis inverse is kept in product form (one eta column per pivot) and it is only refactored (reinverted) periodically
+   - variables are indexed as: structural variables, then one slack per inequality constraint (in the order the constraints were added),
+     then one artificial variable per constraint; the final basis uses this indexing and can be passed back to warm start a related problem
+*/
+class SimplexSolver
+{
+public:
+    enum class ConstraintType : unsigned short
+    {
+        LESS_OR_EQUAL = 0,
+        EQUAL,
+        GREATER_OR_EQUAL
+    };
+
+    enum class PivotingRule : unsigned short
+    {
+        BLAND = 0,      // smallest index entering/leaving variable, never cycles
+        DANTZIG         // most negative reduced cost, switches to Bland's rule after a run of degenerate pivots
+    };
+
+    enum class Status : unsigned short
+    {
+        OPTIMAL = 0,
+        INFEASIBLE,
+        UNBOUNDED
+    };
+
+    struct Result
+    {
+        Status status;
+        WideFraction objectiveValue;
+        std::vector<WideFraction> primalValues;     // structural variables (optimal solution)
+        std::vector<WideFraction> dualValues;       // optimal: duals with objective value = b * y; infeasible: Farkas certificate (see below)
+        std::vector<WideFraction> unboundedRay;     // unbounded: direction r >= 0 of the structural variables, A * r (<=, =, >=) 0, improving the objective
+        std::vector<size_t> basis;
+        size_t iterationsCount;
+        size_t reinversionsCount;
+    };
+
+    // constructors
+    explicit SimplexSolver(size_t variablesCount);
+
+    // problem setup
+    void setObjective(const std::vector<Fraction>& coefficients, bool isMaximization);
+    void addConstraint(const std::vector<Fraction>& coefficients, ConstraintType constraintType, const Fraction& rightHandSide);
+    void setRightHandSide(size_t constraintIndex, const Fraction& rightHandSide);
+    void setPivotingRule(PivotingRule pivotingRule);
+
+    size_t getVariablesCount() const;
+    size_t getConstraintsCount() const;
+
+    /* Solves the problem; if the initial basis is valid and primal feasible for the current data phase 1 starts from it (or is skipped),
+       otherwise the solver falls back to the slack/artificial starting basis
+       Farkas certificate (infeasible problem): y * A <= 0 for each structural column, y_i <= 0 for <= rows, y_i >= 0 for >= rows and y * b > 0
+    */
+    Result solve(const std::vector<size_t>& initialBasis = {}) const;
+
+private:
+    size_t mVariablesCount;
+    bool mIsMaximization;
+    PivotingRule mPivotingRule;
+    std::vector<Fraction> mObjectiveCoefficients;
+    std::vector<std::vector<Fraction>> mConstraintCoefficients;
+    std::vector<ConstraintType> mConstraintTypes;
+    std::vector<Fraction> mRightHandSides;
+};
+
+#endif // SIMPLEXSOLVER_H
@@ -0,0 +1,562 @@
+#include <set>
+#include <span>
+#include <chrono>
+#include <numeric>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+#include "sparsefractionmatrix.h"
+
+// number of sparsest columns searched for the pivot with the lowest Markowitz cost at each elimination step
+static constexpr size_t scMarkowitzSearchColumnsCount{4};
+
+using Clock = std::chrono::steady_clock;
+
+static double getElapsedMilliseconds(const Clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static WideFraction toWideFraction(const CheckedFraction& value)
+{
+    return value.toWideFraction();
+}
+
+static WideFraction toWideFraction(const WideFraction& value)
+{
+    return value;
+}
+
+template<typename Entries>
+static typename Entries::iterator findColumn(Entries& entries, size_t column)
+{
+    return std::lower_bound(entries.begin(), entries.end(), column, [](const auto& entry, size_t currentColumn) {return entry.first < currentColumn;});
+}
+
+template<typename Value>
+static SparseLUFactors<Value> factorize(const SparseFractionMatrix& matrix, SparseLUStatistics& statistics)
+{
+    using Entries = typename SparseLUFactors<Value>::Entries;
+
+    const size_t cSize{matrix.getRowsCount()};
+
+    // active submatrix: the remaining rows (sorted by column) and the rows containing each remaining column
+    std::vector<Entries> rows(cSize);
+    std::vector<std::set<size_t>> columnRows(cSize);
+    std::set<std::pair<size_t, size_t>> columnsByCount;
+
+    for (size_t row{0}; row < cSize; ++row)
+    {
+        for (size_t index{matrix.getRowOffsets()[row]}; index < matrix.getRowOffsets()[row + 1]; ++index)
+        {
+            rows[row].emplace_back(matrix.getColumnIndices()[index], Value{matrix.getValues()[index]});
+            columnRows[matrix.getColumnIndices()[index]].insert(row);
+        }
+    }
+
+    for (size_t column{0}; column < cSize; ++column)
+    {
+        columnsByCount.emplace(columnRows[column].size(), column);
+    }
+
+    auto updateColumnRows{[&columnRows, &columnsByCount](size_t column, size_t row, bool isRowAdded)
+    {
+        columnsByCount.erase({columnRows[column].size(), column});
+
+        if (isRowAdded)
+        {
+            columnRows[column].insert(row);
+        }
+        else
+        {
+            columnRows[column].erase(row);
+        }
+
+        columnsByCount.emplace(columnRows[column].size(), column);
+    }};
+
+    SparseLUFactors<Value> factors;
+    factors.rowPermutation.reserve(cSize);
+    factors.columnPermutation.reserve(cSize);
+    factors.pivots.reserve(cSize);
+    factors.lowerColumns.reserve(cSize);
+    factors.upperRows.reserve(cSize);
+
+    statistics.fillInCount = 0;
+    statistics.orderingMilliseconds = 0.0;
+
+    for (size_t step{0}; step < cSize; ++step)
+    {
+        const Clock::time_point cOrderingStart{Clock::now()};
+
+        // a remaining column without any entries means the matrix is singular
+        if (0 == columnsByCount.begin()->first)
+        {
+            throw std::runtime_error{"Error! Matrix is singular"};
+        }
+
+        size_t pivotRow{cSize};
+        size_t pivotColumn{cSize};
+        size_t lowestCost{std::numeric_limits<size_t>::max()};
+        size_t searchedColumnsCount{0};
+
+        for (auto columnIt{columnsByCount.cbegin()}; columnIt != columnsByCount.cend() && searchedColumnsCount < scMarkowitzSearchColumnsCount && lowestCost > 0; ++columnIt, ++searchedColumnsCount)
+        {
+            const size_t cColumnCount{columnIt->first};
+            const size_t cColumn{columnIt->second};
+
+            for (size_t row : columnRows[cColumn])
+            {
+                const size_t cCost{(rows[row].size() - 1) * (cColumnCount - 1)};
+
+                if (cCost < lowestCost || (cCost == lowestCost && rows[row].size() < rows[pivotRow].size()))
+                {
+                    lowestCost = cCost;
+                    pivotRow = row;
+                    pivotColumn = cColumn;
+                }
+            }
+        }
+
+        statistics.orderingMilliseconds += getElapsedMilliseconds(cOrderingStart);
+
+        // retire the pivot row and column from the active submatrix
+        Entries pivotRowEntries{std::move(rows[pivotRow])};
+        rows[pivotRow].clear();
+
+        columnsByCount.erase({columnRows[pivotColumn].size(), pivotColumn});
+        columnRows[pivotColumn].erase(pivotRow);
+
+        const typename Entries::iterator cPivotIt{findColumn(pivotRowEntries, pivotColumn)};
+        const Value cPivot{std::move(cPivotIt->second)};
+        pivotRowEntries.erase(cPivotIt);
+
+        for (const auto& entry : pivotRowEntries)
+        {
+            updateColumnRows(entry.first, pivotRow, false);
+        }
+
+        // eliminate the pivot column from the other rows: row -= multiplier * pivot row
+        Entries lowerColumn;
+        const std::vector<size_t> cEliminatedRows(columnRows[pivotColumn].cbegin(), columnRows[pivotColumn].cend());
+        columnRows[pivotColumn].clear();
+
+        for (size_t row : cEliminatedRows)
+        {
+            Entries& rowEntries{rows[row]};
+            const typename Entries::iterator cEliminatedIt{findColumn(rowEntries, pivotColumn)};
+            const Value cMultiplier{cEliminatedIt->second / cPivot};
+
+            rowEntries.erase(cEliminatedIt);
+
+            Entries mergedEntries;
+            mergedEntries.reserve(rowEntries.size() + pivotRowEntries.size());
+
+            size_t rowIndex{0};
+            size_t pivotRowIndex{0};
+
+            while (rowIndex < rowEntries.size() || pivotRowIndex < pivotRowEntries.size())
+            {
+                if (pivotRowIndex == pivotRowEntries.size() || (rowIndex < rowEntries.size() && rowEntries[rowIndex].first < pivotRowEntries[pivotRowIndex].first))
+                {
+                    mergedEntries.push_back(std::move(rowEntries[rowIndex]));
+                    ++rowIndex;
+                }
+                else if (rowIndex == rowEntries.size() || pivotRowEntries[pivotRowIndex].first < rowEntries[rowIndex].first)
+                {
+                    const size_t cColumn{pivotRowEntries[pivotRowIndex].first};
+
+                    mergedEntries.emplace_back(cColumn, -(cMultiplier * pivotRowEntries[pivotRowIndex].second));
+                    updateColumnRows(cColumn, row, true);
+                    ++statistics.fillInCount;
+                    ++pivotRowIndex;
+                }
+                else
+                {
+                    const size_t cColumn{rowEntries[rowIndex].first};
+                    Value difference{rowEntries[rowIndex].second - cMultiplier * pivotRowEntries[pivotRowIndex].second};
+
+                    // exact arithmetic: cancellation produces true zeros which are dropped from the pattern
+                    if (difference)
+                    {
+                        mergedEntries.emplace_back(cColumn, std::move(difference));
+                    }
+                    else
+                    {
+                        updateColumnRows(cColumn, row, false);
+                    }
+
+                    ++rowIndex;
+                    ++pivotRowIndex;
+                }
+            }
+
+            rowEntries = std::move(mergedEntries);
+            lowerColumn.emplace_back(row, cMultiplier);
+        }
+
+        factors.rowPermutation.push_back(pivotRow);
+        factors.columnPermutation.push_back(pivotColumn);
+        factors.pivots.push_back(cPivot);
+        factors.lowerColumns.push_back(std::move(lowerColumn));
+        factors.upperRows.push_back(std::move(pivotRowEntries));
+    }
+
+    statistics.lowerNonZerosCount = 0;
+    statistics.upperNonZerosCount = cSize;
+
+    for (size_t step{0}; step < cSize; ++step)
+    {
+        statistics.lowerNonZerosCount += factors.lowerColumns[step].size();
+        statistics.upperNonZerosCount += factors.upperRows[step].size();
+    }
+
+    return factors;
+}
+
+template<typename Value>
+static std::vector<WideFraction> substitute(const SparseLUFactors<Value>& factors, const std::vector<Fraction>& rightHandSide)
+{
+    const size_t cSize{factors.pivots.size()};
+
+    // forward substitution (L): apply the row operations of each elimination step to the right hand side
+    std::vector<Value> intermediate(rightHandSide.cbegin(), rightHandSide.cend());
+
+    for (size_t step{0}; step < cSize; ++step)
+    {
+        const Value cPivotRowValue{intermediate[factors.rowPermutation[step]]};
+
+        if (cPivotRowValue)
+        {
+            for (const auto& [row, multiplier] : factors.lowerColumns[step])
+            {
+                intermediate[row] -= multiplier * cPivotRowValue;
+            }
+        }
+    }
+
+    // backward substitution (U): the columns of each pivot row are pivot columns of later steps, so they are already solved
+    std::vector<Value> solution(cSize);
+
+    for (size_t step{cSize}; step > 0; --step)
+    {
+        Value sum{intermediate[factors.rowPermutation[step - 1]]};
+
+        for (const auto& [column, value] : factors.upperRows[step - 1])
+        {
+            sum -= value * solution[column];
+        }
+
+        solution[factors.columnPermutation[step - 1]] = sum / factors.pivots[step - 1];
+    }
+
+    std::vector<WideFraction> wideSolution;
+    wideSolution.reserve(cSize);
+
+    for (const Value& value : solution)
+    {
+        wideSolution.push_back(toWideFraction(value));
+    }
+
+    return wideSolution;
+}
+
+static SparseLUFactors<WideFraction> createWideFactors(const SparseLUFactors<CheckedFraction>& factors)
+{
+    SparseLUFactors<WideFraction> wideFactors;
+    wideFactors.rowPermutation = factors.rowPermutation;
+    wideFactors.columnPermutation = factors.columnPermutation;
+
+    for (size_t step{0}; step < factors.pivots.size(); ++step)
+    {
+        wideFactors.pivots.push_back(factors.pivots[step].toWideFraction());
+        wideFactors.lowerColumns.emplace_back();
+        wideFactors.upperRows.emplace_back();
+
+        for (const auto& [row, multiplier] : factors.lowerColumns[step])
+        {
+            wideFactors.lowerColumns.back().emplace_back(row, multiplier.toWideFraction());
+        }
+
+        for (const auto& [column, value] : factors.upperRows[step])
+        {
+            wideFactors.upperRows.back().emplace_back(column, value.toWideFraction());
+        }
+    }
+
+    return wideFactors;
+}
+
+// sum of duplicate entries: 64 bit terms, wide ones if they overflow; throws if the sum does not fit into a Fraction
+static Fraction sumEntries(const std::vector<SparseFractionMatrixEntry>& entries, std::span<const size_t> indexes)
+{
+    try
+    {
+        CheckedFraction sum;
+
+        for (const size_t cIndex : indexes)
+        {
+            sum += CheckedFraction{entries[cIndex].value};
+        }
+
+        if (sum.fitsFraction())
+        {
+            return sum.toFraction();
+        }
+    }
+    catch (const std::overflow_error&)
+    {
+        WideFraction sum;
+
+        for (const size_t cIndex : indexes)
+        {
+            sum += WideFraction{entries[cIndex].value};
+        }
+
+        if (sum.fitsFraction())
+        {
+            return sum.toFraction();
+        }
+    }
+
+    throw std::overflow_error{"Error! Fraction term out of range"};
+}
+
+SparseFractionMatrix::SparseFractionMatrix()
+    : mRowsCount{0}
+    , mColumnsCount{0}
+    , mRowOffsets(1, 0u)
+{
+}
+
+SparseFractionMatrix::SparseFractionMatrix(size_t rowsCount, size_t columnsCount, const std::vector<SparseFractionMatrixEntry>& entries)
+    : mRowsCount{rowsCount}
+    , mColumnsCount{columnsCount}
+    , mRowOffsets(rowsCount + 1, 0u)
+{
+    std::vector<size_t> sortedIndexes(entries.size());
+    std::iota(sortedIndexes.begin(), sortedIndexes.end(), 0u);
+
+    for (const SparseFractionMatrixEntry& entry : entries)
+    {
+        if (entry.row >= rowsCount || entry.column >= columnsCount)
+        {
+            throw std::runtime_error{"Error! Matrix index out of range"};
+        }
+    }
+
+    std::stable_sort(sortedIndexes.begin(), sortedIndexes.end(), [&entries](size_t first, size_t second) {
+        return entries[first].row < entries[second].row || (entries[first].row == entries[second].row && entries[first].column < entries[second].column);
+    });
+
+    for (size_t index{0}; index < sortedIndexes.size();)
+    {
+        const SparseFractionMatrixEntry& cEntry{entries[sortedIndexes[index]]};
+        size_t endIndex{index + 1};
+
+        while (endIndex < sortedIndexes.size() && entries[sortedIndexes[endIndex]].row == cEntry.row && entries[sortedIndexes[endIndex]].column == cEntry.column)
+        {
+            ++endIndex;
+        }
+
+        const Fraction cValue{endIndex - index > 1 ? sumEntries(entries, std::span<const size_t>{sortedIndexes}.subspan(index, endIndex - index))
+                                                   : cEntry.value};
+
+        index = endIndex;
+
+        if (cValue)
+        {
+            mColumnIndices.push_back(cEntry.column);
+            mValues.push_back(cValue);
+            ++mRowOffsets[cEntry.row + 1];
+        }
+    }
+
+    std::partial_sum(mRowOffsets.cbegin(), mRowOffsets.cend(), mRowOffsets.begin());
+}
+
+size_t SparseFractionMatrix::getRowsCount() const
+{
+    return mRowsCount;
+}
+
+size_t SparseFractionMatrix::getColumnsCount() const
+{
+    return mColumnsCount;
+}
+
+size_t SparseFractionMatrix::getNonZerosCount() const
+{
+    return mValues.size();
+}
+
+Fraction SparseFractionMatrix::getElement(size_t row, size_t column) const
+{
+    if (row >= mRowsCount || column >= mColumnsCount)
+    {
+        throw std::runtime_error{"Error! Matrix index out of range"};
+    }
+
+    Fraction element{};
+
+    const std::vector<size_t>::const_iterator cRowBegin{mColumnIndices.cbegin() + mRowOffsets[row]};
+    const std::vector<size_t>::const_iterator cRowEnd{mColumnIndices.cbegin() + mRowOffsets[row + 1]};
+    const std::vector<size_t>::const_iterator cColumnIt{std::lower_bound(cRowBegin, cRowEnd, column)};
+
+    if (cColumnIt != cRowEnd && *cColumnIt == column)
+    {
+        element = mValues[std::distance(mColumnIndices.cbegin(), cColumnIt)];
+    }
+
+    return element;
+}
+
+const std::vector<size_t>& SparseFractionMatrix::getRowOffsets() const
+{
+    return mRowOffsets;
+}
+
+const std::vector<size_t>& SparseFractionMatrix::getColumnIndices() const
+{
+    return mColumnIndices;
+}
+
+const std::vector<Fraction>& SparseFractionMatrix::getValues() const
+{
+    return mValues;
+}
+
+SparseFractionMatrix SparseFractionMatrix::transpose() const
+{
+    SparseFractionMatrix transposedMatrix;
+    transposedMatrix.mRowsCount = mColumnsCount;
+    transposedMatrix.mColumnsCount = mRowsCount;
+    transposedMatrix.mRowOffsets.assign(mColumnsCount + 1, 0u);
+    transposedMatrix.mColumnIndices.resize(mColumnIndices.size());
+    transposedMatrix.mValues.resize(mValues.size());
+
+    // counting sort by column, traversing the rows in order keeps each transposed row sorted
+    for (size_t column : mColumnIndices)
+    {
+        ++transposedMatrix.mRowOffsets[column + 1];
+    }
+
+    std::partial_sum(transposedMatrix.mRowOffsets.cbegin(), transposedMatrix.mRowOffsets.cend(), transposedMatrix.mRowOffsets.begin());
+
+    std::vector<size_t> insertPositions(transposedMatrix.mRowOffsets.cbegin(), transposedMatrix.mRowOffsets.cend() - 1);
+
+    for (size_t row{0}; row < mRowsCount; ++row)
+    {
+        for (size_t index{mRowOffsets[row]}; index < mRowOffsets[row + 1]; ++index)
+        {
+            const size_t cPosition{insertPositions[mColumnIndices[index]]++};
+            transposedMatrix.mColumnIndices[cPosition] = row;
+            transposedMatrix.mValues[cPosition] = mValues[index];
+        }
+    }
+
+    return transposedMatrix;
+}
+
+std::vector<Fraction> SparseFractionMatrix::multiply(const std::vector<Fraction>& vector) const
+{
+    if (vector.size() != mColumnsCount)
+    {
+        throw std::runtime_error{"Error! Incompatible matrix sizes"};
+    }
+
+    std::vector<Fraction> result;
+    result.reserve(mRowsCount);
+
+    for (size_t row{0}; row < mRowsCount; ++row)
+    {
+        try
+        {
+            CheckedFraction rowSum;
+
+            for (size_t index{mRowOffsets[row]}; index < mRowOffsets[row + 1]; ++index)
+            {
+                rowSum += CheckedFraction{mValues[index]} * CheckedFraction{vector[mColumnIndices[index]]};
+            }
+
+            result.push_back(rowSum.toFraction());
+        }
+        catch (const std::overflow_error&)
+        {
+            WideFraction rowSum;
+
+            for (size_t index{mRowOffsets[row]}; index < mRowOffsets[row + 1]; ++index)
+            {
+                rowSum += WideFraction{mValues[index]} * WideFraction{vector[mColumnIndices[index]]};
+            }
+
+            result.push_back(rowSum.toFraction());
+        }
+    }
+
+    return result;
+}
+
+SparseLUFactorization::SparseLUFactorization(const SparseFractionMatrix& matrix)
+{
+    if (matrix.getRowsCount() != matrix.getColumnsCount())
+    {
+        throw std::runtime_error{"Error! Matrix is not square"};
+    }
+
+    const Clock::time_point cStart{Clock::now()};
+
+    try
+    {
+        mFactors = factorize<CheckedFraction>(matrix, mStatistics);
+    }
+    catch (const std::overflow_error&)
+    {
+        mFactors = factorize<WideFraction>(matrix, mStatistics);
+        mStatistics.isWideArithmeticUsed = true;
+    }
+
+    mStatistics.matrixNonZerosCount = matrix.getNonZerosCount();
+    mStatistics.factorizationMilliseconds = getElapsedMilliseconds(cStart);
+}
+
+std::vector<WideFraction> SparseLUFactorization::solve(const std::vector<Fraction>& rightHandSide) const
+{
+    std::vector<WideFraction> solution;
+
+    if (const SparseLUFactors<CheckedFraction>* const cCheckedFactors{std::get_if<SparseLUFactors<CheckedFraction>>(&mFactors)})
+    {
+        if (rightHandSide.size() != cCheckedFactors->pivots.size())
+        {
+            throw std::runtime_error{"Error! Incompatible matrix sizes"};
+        }
+
+        try
+        {
+            solution = substitute(*cCheckedFactors, rightHandSide);
+        }
+        catch (const std::overflow_error&)
+        {
+            solution = substitute(createWideFactors(*cCheckedFactors), rightHandSide);
+        }
+    }
+    else
+    {
+        const SparseLUFactors<WideFraction>& cWideFactors{std::get<SparseLUFactors<WideFraction>>(mFactors)};
+
+        if (rightHandSide.size() != cWideFactors.pivots.size())
+        {
+            throw std::runtime_error{"Error! Incompatible matrix sizes"};
+        }
+
+        solution = substitute(cWideFactors, rightHandSide);
+    }
+
+    return solution;
+}
+
+const SparseLUStatistics& SparseLUFactorization::getStatistics() const
+{
+    return mStatistics;
+}
@@ -0,0 +1,92 @@
+#ifndef SPARSEFRACTIONMATRIX_H
+#define SPARSEFRACTIONMATRIX_H
+
+#include <vector>
+#include <variant>
+#include <utility>
+
+#include "checkedfraction.h"
+
+struct SparseFractionMatrixEntry
+{
+    size_t row;
+    size_t column;
+    Fraction value;
+};
+
+/* Sparse matrix of fractions in compressed sparse row (CSR) format: the column indices and values of row i are stored
+   in the [rowOffsets[i], rowOffsets[i + 1]) range of the column indices/values arrays (sorted by column, zeros not stored)
+*/
+class SparseFractionMatrix
+{
+public:
+    // constructors (duplicate entries are summed up exactly, throws std::overflow_error if a sum does not fit into a Fraction)
+    SparseFractionMatrix();
+    SparseFractionMatrix(size_t rowsCount, size_t columnsCount, const std::vector<SparseFractionMatrixEntry>& entries);
+
+    // getters
+    size_t getRowsCount() const;
+    size_t getColumnsCount() const;
+    size_t getNonZerosCount() const;
+    Fraction getElement(size_t row, size_t column) const;
+
+    const std::vector<size_t>& getRowOffsets() const;
+    const std::vector<size_t>& getColumnIndices() const;
+    const std::vector<Fraction>& getValues() const;
+
+    // the compressed rows of the transpose are the compressed columns (CSC) of this matrix
+    SparseFractionMatrix transpose() const;
+
+    // sparse matrix-vector product (row sums are accumulated exactly, the result elements must fit into a Fraction)
+    std::vector<Fraction> multiply(const std::vector<Fraction>& vector) const;
+
+private:
+    size_t mRowsCount;
+    size_t mColumnsCount;
+    std::vector<size_t> mRowOffsets;
+    std::vector<size_t> mColumnIndices;
+    std::vector<Fraction> mValues;
+};
+
+struct SparseLUStatistics
+{
+    size_t matrixNonZerosCount{0};
+    size_t lowerNonZerosCount{0};   // multipliers, the unit diagonal is not stored
+    size_t upperNonZerosCount{0};   // including the pivots
+    size_t fillInCount{0};          // entries created by the elimination that were zero in the original matrix
+    bool isWideArithmeticUsed{false};
+    double orderingMilliseconds{0.0};
+    double factorizationMilliseconds{0.0};
+};
+
+template<typename Value>
+struct SparseLUFactors
+{
+    using Entries = std::vector<std::pair<size_t, Value>>;
+
+    std::vector<size_t> rowPermutation;    // original index of the pivot row of each elimination step
+    std::vector<size_t> columnPermutation; // original index of the pivot column of each elimination step
+    std::vector<Value> pivots;
+    std::vector<Entries> lowerColumns;     // (row, multiplier) pairs of each step
+    std::vector<Entries> upperRows;        // (column, value) pairs of each pivot row, pivot excluded
+};
+
+/* Exact sparse LU factorization P * A * Q = L * U with Markowitz pivoting, i.e. at each step the pivot minimizing the (possible) fill-in
+   is chosen among the entries of the sparsest columns; the factorization runs on 64 bit terms and it is redone with wide integers only if they overflow
+*/
+class SparseLUFactorization
+{
+public:
+    explicit SparseLUFactorization(const SparseFractionMatrix& matrix);
+
+    // forward and backward substitution through the sparse triangular factors
+    std::vector<WideFraction> solve(const std::vector<Fraction>& rightHandSide) const;
+
+    const SparseLUStatistics& getStatistics() const;
+
+private:
+    std::variant<SparseLUFactors<CheckedFraction>, SparseLUFactors<WideFraction>> mFactors;
+    SparseLUStatistics mStatistics;
+};
+
+#endif // SPARSEFRACTIONMATRIX_H
@@ -0,0 +1,229 @@
+#include <cmath>
+#include <stdexcept>
+
+#include "widefraction.h"
+
+// number of significant bits computed when converting to double (a few more than the 53 bits of the mantissa)
+static constexpr int scDecimalValuePrecision{64};
+
+WideFraction::WideFraction()
+    : mNumerator{0}
+    , mDenominator{1}
+{
+}
+
+WideFraction::WideFraction(const WideInteger& numerator)
+    : mNumerator{numerator}
+    , mDenominator{1}
+{
+}
+
+WideFraction::WideFraction(const WideInteger& numerator, const WideInteger& denominator)
+    : mNumerator{numerator}
+    , mDenominator{denominator}
+{
+    if (denominator.isZero())
+    {
+        throw std::runtime_error{ "Fatal error! Division by 0." };
+    }
+
+    normalize();
+}
+
+WideFraction::WideFraction(const Fraction& fraction)
+    : mNumerator{fraction.getNumerator()}
+    , mDenominator{fraction.getDenominator()}
+{
+}
+
+const WideInteger& WideFraction::getNumerator() const
+{
+    return mNumerator;
+}
+
+const WideInteger& WideFraction::getDenominator() const
+{
+    return mDenominator;
+}
+
+double WideFraction::getDecimalValue() const
+{
+    // scale the numerator so the integer quotient keeps enough significant bits and the result doesn't degenerate into inf/inf
+    const int cShift{scDecimalValuePrecision - static_cast<int>(mNumerator.getBitLength()) + static_cast<int>(mDenominator.getBitLength())};
+    const WideInteger cQuotient{cShift >= 0 ? (mNumerator << static_cast<unsigned int>(cShift)) / mDenominator
+                                            : mNumerator / (mDenominator << static_cast<unsigned int>(-cShift))};
+
+    const double cDecimalValue{std::ldexp(cQuotient.toDouble(), -cShift)};
+
+    return cDecimalValue;
+}
+
+WideFraction WideFraction::operator+(const WideFraction& wideFraction) const
+{
+    WideFraction result;
+
+    if (mDenominator == wideFraction.mDenominator)
+    {
+        result.mNumerator = mNumerator + wideFraction.mNumerator;
+        result.mDenominator = mDenominator;
+    }
+    else
+    {
+        const WideInteger cGreatestCommonDivisor{WideInteger::getGreatestCommonDivisor(mDenominator, wideFraction.mDenominator)};
+        const WideInteger cFirstMultiplicationFactor{wideFraction.mDenominator / cGreatestCommonDivisor};
+        const WideInteger cSecondMultiplicationFactor{mDenominator / cGreatestCommonDivisor};
+
+        result.mNumerator = mNumerator * cFirstMultiplicationFactor + wideFraction.mNumerator * cSecondMultiplicationFactor;
+        result.mDenominator = mDenominator * cFirstMultiplicationFactor;
+    }
+
+    result.normalize();
+
+    return result;
+}
+
+WideFraction WideFraction::operator-(const WideFraction& wideFraction) const
+{
+    const WideFraction cResult{*this + (-wideFraction)};
+    return cResult;
+}
+
+WideFraction WideFraction::operator*(const WideFraction& wideFraction) const
+{
+    WideFraction result;
+
+    if (!mNumerator.isZero() && !wideFraction.mNumerator.isZero())
+    {
+        // cross reduce first so the products stay as small as possible
+        const WideInteger cFirstDivisor{WideInteger::getGreatestCommonDivisor(mNumerator, wideFraction.mDenominator)};
+        const WideInteger cSecondDivisor{WideInteger::getGreatestCommonDivisor(wideFraction.mNumerator, mDenominator)};
+
+        result.mNumerator = (mNumerator / cFirstDivisor) * (wideFraction.mNumerator / cSecondDivisor);
+        result.mDenominator = (mDenominator / cSecondDivisor) * (wideFraction.mDenominator / cFirstDivisor);
+    }
+
+    return result;
+}
+
+WideFraction WideFraction::operator/(const WideFraction& wideFraction) const
+{
+    const WideFraction cResult{*this * wideFraction.inverse()};
+    return cResult;
+}
+
+WideFraction WideFraction::operator-() const
+{
+    WideFraction result{*this};
+    result.mNumerator = -mNumerator;
+
+    return result;
+}
+
+WideFraction& WideFraction::operator+=(const WideFraction& wideFraction)
+{
+    *this = *this + wideFraction;
+    return *this;
+}
+
+WideFraction& WideFraction::operator-=(const WideFraction& wideFraction)
+{
+    *this = *this - wideFraction;
+    return *this;
+}
+
+WideFraction& WideFraction::operator*=(const WideFraction& wideFraction)
+{
+    *this = *this * wideFraction;
+    return *this;
+}
+
+WideFraction& WideFraction::operator/=(const WideFraction& wideFraction)
+{
+    *this = *this / wideFraction;
+    return *this;
+}
+
+std::strong_ordering WideFraction::operator<=>(const WideFraction& wideFraction) const
+{
+    return mNumerator * wideFraction.mDenominator <=> wideFraction.mNumerator * mDenominator;
+}
+
+bool WideFraction::operator==(const WideFraction& wideFraction) const
+{
+    // both operands are normalized so their terms can be compared directly
+    const bool cIsEqual{mNumerator == wideFraction.mNumerator && mDenominator == wideFraction.mDenominator};
+    return cIsEqual;
+}
+
+WideFraction::operator bool() const
+{
+    return !mNumerator.isZero();
+}
+
+bool WideFraction::fitsFraction() const
+{
+    const bool cFitsFraction{mNumerator.fitsInt() && mDenominator.fitsInt()};
+    return cFitsFraction;
+}
+
+Fraction WideFraction::toFraction() const
+{
+    if (!fitsFraction())
+    {
+        throw std::runtime_error{"Error! Value does not fit into a Fraction"};
+    }
+
+    const Fraction cResult{mNumerator.toInt(), mDenominator.toInt()};
+
+    return cResult;
+}
+
+std::string WideFraction::toString() const
+{
+    const std::string cResult{mNumerator.toString() + "/" + mDenominator.toString()};
+    return cResult;
+}
+
+std::ostream& operator<<(std::ostream& outputStream, const WideFraction& wideFraction)
+{
+    outputStream << wideFraction.mNumerator << "/" << wideFraction.mDenominator;
+    return outputStream;
+}
+
+WideFraction WideFraction::inverse() const
+{
+    if (mNumerator.isZero())
+    {
+        throw std::runtime_error{ "Error! Division by 0" };
+    }
+
+    WideFraction result;
+    result.mNumerator = mNumerator.isNegative() ? -mDenominator : mDenominator;
+    result.mDenominator = mNumerator.abs();
+
+    return result;
+}
+
+void WideFraction::normalize()
+{
+    if (mNumerator.isZero())
+    {
+        mDenominator = WideInteger{1};
+    }
+    else
+    {
+        const WideInteger cGreatestCommonDivisor{WideInteger::getGreatestCommonDivisor(mNumerator, mDenominator)};
+
+        if (WideInteger{1} != cGreatestCommonDivisor)
+        {
+            mNumerator /= cGreatestCommonDivisor;
+            mDenominator /= cGreatestCommonDivisor;
+        }
+
+        if (mDenominator.isNegative())
+        {
+            mNumerator = -mNumerator;
+            mDenominator = -mDenominator;
+        }
+    }
+}
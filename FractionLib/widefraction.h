@@ -0,0 +1,60 @@
+#ifndef WIDEFRACTION_H
+#define WIDEFRACTION_H
+
+#include "wideinteger.h"
+#include "fraction.h"
+
+/* Rational number with arbitrary precision numerator and denominator, used for exact results that might not fit into a Fraction
+   (the denominator is always kept positive and coprime with the numerator)
+*/
+class WideFraction
+{
+public:
+    // constructors
+    WideFraction();
+    WideFraction(const WideInteger& numerator);
+    WideFraction(const WideInteger& numerator, const WideInteger& denominator);
+    WideFraction(const Fraction& fraction);
+
+    // getters
+    const WideInteger& getNumerator() const;
+    const WideInteger& getDenominator() const;
+    double getDecimalValue() const;
+
+    // arithmetic operators
+    WideFraction operator+(const WideFraction& wideFraction) const;
+    WideFraction operator-(const WideFraction& wideFraction) const;
+    WideFraction operator*(const WideFraction& wideFraction) const;
+    WideFraction operator/(const WideFraction& wideFraction) const;
+    WideFraction operator-() const;
+
+    WideFraction& operator+=(const WideFraction& wideFraction);
+    WideFraction& operator-=(const WideFraction& wideFraction);
+    WideFraction& operator*=(const WideFraction& wideFraction);
+    WideFraction& operator/=(const WideFraction& wideFraction);
+
+    // logical operators
+    std::strong_ordering operator<=>(const WideFraction& wideFraction) const;
+    bool operator==(const WideFraction& wideFraction) const;
+
+    explicit operator bool() const;
+
+    // conversion functions
+    bool fitsFraction() const;
+    Fraction toFraction() const;
+    std::string toString() const;
+
+    // IO operators
+    friend std::ostream& operator<<(std::ostream& outputStream, const WideFraction& wideFraction);
+
+    // other functions
+    WideFraction inverse() const;
+
+private:
+    void normalize();
+
+    WideInteger mNumerator;
+    WideInteger mDenominator;
+};
+
+#endif // WIDEFRACTION_H
@@ -0,0 +1,735 @@
+#include <cmath>
+#include <cctype>
+#include <bit>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+#include "wideinteger.h"
+
+static constexpr int scLimbBitsCount{32};
+static constexpr std::uint64_t scLimbBase{std::uint64_t{1} << scLimbBitsCount};
+static constexpr std::uint32_t scDecimalChunkBase{1000000000u};
+static constexpr int scDecimalChunkDigitsCount{9};
+
+WideInteger::WideInteger()
+    : mIsNegative{false}
+{
+}
+
+WideInteger::WideInteger(long long value)
+    : mIsNegative{value < 0}
+{
+    // the magnitude of the minimum long long value is not representable as long long, so convert before negating
+    std::uint64_t magnitude{mIsNegative ? std::uint64_t{0} - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value)};
+
+    while (magnitude > 0)
+    {
+        mLimbs.push_back(static_cast<std::uint32_t>(magnitude));
+        magnitude >>= scLimbBitsCount;
+    }
+}
+
+WideInteger::WideInteger(const std::string& integerString)
+    : WideInteger{}
+{
+    const size_t cFirstDigitIndex{(!integerString.empty() && ('-' == integerString[0] || '+' == integerString[0])) ? 1u : 0u};
+
+    if (cFirstDigitIndex == integerString.size() ||
+        !std::all_of(integerString.cbegin() + cFirstDigitIndex, integerString.cend(), [](char digit) {return 0 != isdigit(digit);}))
+    {
+        throw std::runtime_error{"Error! Wrong integer format"};
+    }
+
+    for (size_t chunkStart{cFirstDigitIndex}; chunkStart < integerString.size(); chunkStart += scDecimalChunkDigitsCount)
+    {
+        const size_t cChunkLength{std::min<size_t>(scDecimalChunkDigitsCount, integerString.size() - chunkStart)};
+        std::uint32_t chunkMultiplier{1};
+        std::uint32_t chunkValue{0};
+
+        for (size_t digitIndex{chunkStart}; digitIndex < chunkStart + cChunkLength; ++digitIndex)
+        {
+            chunkMultiplier *= 10;
+            chunkValue = chunkValue * 10 + static_cast<std::uint32_t>(integerString[digitIndex] - '0');
+        }
+
+        std::uint64_t carry{chunkValue};
+
+        for (std::uint32_t& limb : mLimbs)
+        {
+            const std::uint64_t cProduct{static_cast<std::uint64_t>(limb) * chunkMultiplier + carry};
+            limb = static_cast<std::uint32_t>(cProduct);
+            carry = cProduct >> scLimbBitsCount;
+        }
+
+        if (carry > 0)
+        {
+            mLimbs.push_back(static_cast<std::uint32_t>(carry));
+        }
+    }
+
+    trim();
+    mIsNegative = !mLimbs.empty() && '-' == integerString[0];
+}
+
+WideInteger WideInteger::operator+(const WideInteger& wideInteger) const
+{
+    WideInteger result;
+
+    if (mIsNegative == wideInteger.mIsNegative)
+    {
+        result.mLimbs = addMagnitudes(mLimbs, wideInteger.mLimbs);
+        result.mIsNegative = mIsNegative;
+    }
+    else
+    {
+        const int cMagnitudesComparison{compareMagnitudes(mLimbs, wideInteger.mLimbs)};
+
+        if (cMagnitudesComparison > 0)
+        {
+            result.mLimbs = subtractMagnitudes(mLimbs, wideInteger.mLimbs);
+            result.mIsNegative = mIsNegative;
+        }
+        else if (cMagnitudesComparison < 0)
+        {
+            result.mLimbs = subtractMagnitudes(wideInteger.mLimbs, mLimbs);
+            result.mIsNegative = wideInteger.mIsNegative;
+        }
+    }
+
+    result.trim();
+
+    return result;
+}
+
+WideInteger WideInteger::operator-(const WideInteger& wideInteger) const
+{
+    const WideInteger cResult{*this + (-wideInteger)};
+    return cResult;
+}
+
+WideInteger WideInteger::operator*(const WideInteger& wideInteger) const
+{
+    WideInteger result;
+
+    if (!mLimbs.empty() && !wideInteger.mLimbs.empty())
+    {
+        result.mLimbs = multiplyMagnitudes(mLimbs, wideInteger.mLimbs);
+        result.mIsNegative = mIsNegative != wideInteger.mIsNegative;
+        result.trim();
+    }
+
+    return result;
+}
+
+WideInteger WideInteger::operator/(const WideInteger& wideInteger) const
+{
+    WideInteger quotient;
+    WideInteger remainder;
+
+    divide(*this, wideInteger, quotient, remainder);
+
+    return quotient;
+}
+
+WideInteger WideInteger::operator%(const WideInteger& wideInteger) const
+{
+    WideInteger quotient;
+    WideInteger remainder;
+
+    divide(*this, wideInteger, quotient, remainder);
+
+    return remainder;
+}
+
+WideInteger WideInteger::operator-() const
+{
+    WideInteger result{*this};
+    result.mIsNegative = !result.mLimbs.empty() && !mIsNegative;
+
+    return result;
+}
+
+WideInteger WideInteger::operator<<(unsigned int bitsCount) const
+{
+    WideInteger result;
+
+    if (!mLimbs.empty())
+    {
+        const unsigned int cLimbsShift{bitsCount / scLimbBitsCount};
+        const unsigned int cBitsShift{bitsCount % scLimbBitsCount};
+
+        result.mLimbs.assign(mLimbs.size() + cLimbsShift + 1, 0u);
+
+        for (size_t limbIndex{0}; limbIndex < mLimbs.size(); ++limbIndex)
+        {
+            const std::uint64_t cShiftedLimb{static_cast<std::uint64_t>(mLimbs[limbIndex]) << cBitsShift};
+            result.mLimbs[limbIndex + cLimbsShift] |= static_cast<std::uint32_t>(cShiftedLimb);
+            result.mLimbs[limbIndex + cLimbsShift + 1] |= static_cast<std::uint32_t>(cShiftedLimb >> scLimbBitsCount);
+        }
+
+        result.mIsNegative = mIsNegative;
+        result.trim();
+    }
+
+    return result;
+}
+
+WideInteger WideInteger::operator>>(unsigned int bitsCount) const
+{
+    // shifts the magnitude (i.e. rounds towards 0), similar to the division by a power of 2
+    WideInteger result;
+    const size_t cLimbsShift{bitsCount / scLimbBitsCount};
+    const unsigned int cBitsShift{bitsCount % scLimbBitsCount};
+
+    if (cLimbsShift < mLimbs.size())
+    {
+        result.mLimbs.assign(mLimbs.size() - cLimbsShift, 0u);
+
+        for (size_t limbIndex{0}; limbIndex < result.mLimbs.size(); ++limbIndex)
+        {
+            std::uint64_t shiftedLimbs{mLimbs[limbIndex + cLimbsShift]};
+
+            if (limbIndex + cLimbsShift + 1 < mLimbs.size())
+            {
+                shiftedLimbs |= static_cast<std::uint64_t>(mLimbs[limbIndex + cLimbsShift + 1]) << scLimbBitsCount;
+            }
+
+            result.mLimbs[limbIndex] = static_cast<std::uint32_t>(shiftedLimbs >> cBitsShift);
+        }
+
+        result.trim();
+        result.mIsNegative = !result.mLimbs.empty() && mIsNegative;
+    }
+
+    return result;
+}
+
+WideInteger& WideInteger::operator+=(const WideInteger& wideInteger)
+{
+    *this = *this + wideInteger;
+    return *this;
+}
+
+WideInteger& WideInteger::operator-=(const WideInteger& wideInteger)
+{
+    *this = *this - wideInteger;
+    return *this;
+}
+
+WideInteger& WideInteger::operator*=(const WideInteger& wideInteger)
+{
+    *this = *this * wideInteger;
+    return *this;
+}
+
+WideInteger& WideInteger::operator/=(const WideInteger& wideInteger)
+{
+    *this = *this / wideInteger;
+    return *this;
+}
+
+WideInteger& WideInteger::operator%=(const WideInteger& wideInteger)
+{
+    *this = *this % wideInteger;
+    return *this;
+}
+
+std::strong_ordering WideInteger::operator<=>(const WideInteger& wideInteger) const
+{
+    std::strong_ordering result{std::strong_ordering::equal};
+
+    if (mIsNegative != wideInteger.mIsNegative)
+    {
+        result = mIsNegative ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+    else
+    {
+        const int cMagnitudesComparison{mIsNegative ? compareMagnitudes(wideInteger.mLimbs, mLimbs) : compareMagnitudes(mLimbs, wideInteger.mLimbs)};
+        result = cMagnitudesComparison <=> 0;
+    }
+
+    return result;
+}
+
+bool WideInteger::operator==(const WideInteger& wideInteger) const
+{
+    const bool cIsEqual{mIsNegative == wideInteger.mIsNegative && mLimbs == wideInteger.mLimbs};
+    return cIsEqual;
+}
+
+WideInteger::operator bool() const
+{
+    return !mLimbs.empty();
+}
+
+bool WideInteger::isZero() const
+{
+    return mLimbs.empty();
+}
+
+bool WideInteger::isNegative() const
+{
+    return mIsNegative;
+}
+
+bool WideInteger::isOdd() const
+{
+    const bool cIsOdd{!mLimbs.empty() && 0u != (mLimbs[0] & 1u)};
+    return cIsOdd;
+}
+
+bool WideInteger::fitsInt() const
+{
+    bool fitsInt{mLimbs.size() <= 1u};
+
+    if (fitsInt && 1u == mLimbs.size())
+    {
+        const std::uint32_t cMaxMagnitude{static_cast<std::uint32_t>(std::numeric_limits<int>::max()) + (mIsNegative ? 1u : 0u)};
+        fitsInt = mLimbs[0] <= cMaxMagnitude;
+    }
+
+    return fitsInt;
+}
+
+bool WideInteger::fitsLongLong() const
+{
+    bool fitsLongLong{mLimbs.size() <= 2u};
+
+    if (fitsLongLong && 2u == mLimbs.size())
+    {
+        const std::uint64_t cMagnitude{(static_cast<std::uint64_t>(mLimbs[1]) << scLimbBitsCount) | mLimbs[0]};
+        const std::uint64_t cMaxMagnitude{static_cast<std::uint64_t>(std::numeric_limits<long long>::max()) + (mIsNegative ? 1u : 0u)};
+
+        fitsLongLong = cMagnitude <= cMaxMagnitude;
+    }
+
+    return fitsLongLong;
+}
+
+int WideInteger::toInt() const
+{
+    if (!fitsInt())
+    {
+        throw std::runtime_error{"Error! Value out of int range"};
+    }
+
+    return static_cast<int>(toLongLong());
+}
+
+long long WideInteger::toLongLong() const
+{
+    if (!fitsLongLong())
+    {
+        throw std::runtime_error{"Error! Value out of long long range"};
+    }
+
+    std::uint64_t magnitude{0};
+
+    for (size_t limbIndex{mLimbs.size()}; limbIndex > 0; --limbIndex)
+    {
+        magnitude = (magnitude << scLimbBitsCount) | mLimbs[limbIndex - 1];
+    }
+
+    const long long cResult{mIsNegative ? static_cast<long long>(std::uint64_t{0} - magnitude) : static_cast<long long>(magnitude)};
+
+    return cResult;
+}
+
+double WideInteger::toDouble() const
+{
+    double result{0.0};
+
+    // only the 3 most significant limbs matter for the 53 bits mantissa
+    const size_t cSignificantLimbsCount{std::min<size_t>(mLimbs.size(), 3u)};
+
+    for (size_t limbIndex{mLimbs.size()}; limbIndex > mLimbs.size() - cSignificantLimbsCount; --limbIndex)
+    {
+        result = result * static_cast<double>(scLimbBase) + mLimbs[limbIndex - 1];
+    }
+
+    result = std::ldexp(result, static_cast<int>((mLimbs.size() - cSignificantLimbsCount) * scLimbBitsCount));
+
+    return mIsNegative ? -result : result;
+}
+
+std::string WideInteger::toString() const
+{
+    std::string result;
+
+    if (mLimbs.empty())
+    {
+        result = "0";
+    }
+    else
+    {
+        Limbs magnitude{mLimbs};
+        std::vector<std::uint32_t> decimalChunks;
+
+        while (!magnitude.empty())
+        {
+            decimalChunks.push_back(divideMagnitudeByLimb(magnitude, scDecimalChunkBase));
+        }
+
+        result = (mIsNegative ? "-" : "") + std::to_string(decimalChunks.back());
+
+        for (size_t chunkIndex{decimalChunks.size() - 1}; chunkIndex > 0; --chunkIndex)
+        {
+            const std::string cChunkString{std::to_string(decimalChunks[chunkIndex - 1])};
+            result.append(scDecimalChunkDigitsCount - cChunkString.size(), '0');
+            result.append(cChunkString);
+        }
+    }
+
+    return result;
+}
+
+WideInteger WideInteger::abs() const
+{
+    WideInteger result{*this};
+    result.mIsNegative = false;
+
+    return result;
+}
+
+int WideInteger::getSign() const
+{
+    const int cSign{mLimbs.empty() ? 0 : mIsNegative ? -1 : 1};
+    return cSign;
+}
+
+unsigned int WideInteger::getBitLength() const
+{
+    unsigned int bitLength{0};
+
+    if (!mLimbs.empty())
+    {
+        bitLength = static_cast<unsigned int>((mLimbs.size() - 1) * scLimbBitsCount + std::bit_width(mLimbs.back()));
+    }
+
+    return bitLength;
+}
+
+std::uint32_t WideInteger::getRemainder(std::uint32_t divisor) const
+{
+    if (0u == divisor)
+    {
+        throw std::runtime_error{"Fatal error! Division by 0."};
+    }
+
+    std::uint64_t remainder{0};
+
+    for (size_t limbIndex{mLimbs.size()}; limbIndex > 0; --limbIndex)
+    {
+        remainder = (remainder << scLimbBitsCount | mLimbs[limbIndex - 1]) % divisor;
+    }
+
+    if (mIsNegative && 0u != remainder)
+    {
+        remainder = divisor - remainder;
+    }
+
+    return static_cast<std::uint32_t>(remainder);
+}
+
+std::ostream& operator<<(std::ostream& outputStream, const WideInteger& wideInteger)
+{
+    outputStream << wideInteger.toString();
+    return outputStream;
+}
+
+/* Truncating division (same semantics as the built-in integer division): the remainder has the sign of the dividend
+*/
+void WideInteger::divide(const WideInteger& dividend, const WideInteger& divisor, WideInteger& quotient, WideInteger& remainder)
+{
+    if (divisor.mLimbs.empty())
+    {
+        throw std::runtime_error{"Fatal error! Division by 0."};
+    }
+
+    Limbs quotientLimbs;
+    Limbs remainderLimbs;
+
+    divideMagnitudes(dividend.mLimbs, divisor.mLimbs, quotientLimbs, remainderLimbs);
+
+    quotient.mLimbs = std::move(quotientLimbs);
+    quotient.trim();
+    quotient.mIsNegative = !quotient.mLimbs.empty() && dividend.mIsNegative != divisor.mIsNegative;
+
+    remainder.mLimbs = std::move(remainderLimbs);
+    remainder.trim();
+    remainder.mIsNegative = !remainder.mLimbs.empty() && dividend.mIsNegative;
+}
+
+WideInteger WideInteger::getGreatestCommonDivisor(const WideInteger& first, const WideInteger& second)
+{
+    if (first.isZero() && second.isZero())
+    {
+        throw std::runtime_error{"Error! Cannot retrieve greatest common divisor of two 0 numbers"};
+    }
+
+    WideInteger greatestCommonDivisor{first.abs()};
+    WideInteger remainder{second.abs()};
+
+    while (!remainder.isZero())
+    {
+        // switch to native arithmetic as soon as both (non-negative) values fit into a machine word
+        if (greatestCommonDivisor.fitsLongLong() && remainder.fitsLongLong())
+        {
+            std::uint64_t firstValue{static_cast<std::uint64_t>(greatestCommonDivisor.toLongLong())};
+            std::uint64_t secondValue{static_cast<std::uint64_t>(remainder.toLongLong())};
+
+            while (0u != secondValue)
+            {
+                const std::uint64_t cRemainder{firstValue % secondValue};
+                firstValue = secondValue;
+                secondValue = cRemainder;
+            }
+
+            greatestCommonDivisor = WideInteger{static_cast<long long>(firstValue)};
+            break;
+        }
+
+        WideInteger quotient;
+        WideInteger nextRemainder;
+
+        divide(greatestCommonDivisor, remainder, quotient, nextRemainder);
+        greatestCommonDivisor = std::move(remainder);
+        remainder = std::move(nextRemainder);
+    }
+
+    return greatestCommonDivisor;
+}
+
+WideInteger WideInteger::getLeastCommonMultiple(const WideInteger& first, const WideInteger& second)
+{
+    WideInteger leastCommonMultiple;
+
+    if (!first.isZero() && !second.isZero())
+    {
+        leastCommonMultiple = (first.abs() / getGreatestCommonDivisor(first, second)) * second.abs();
+    }
+
+    return leastCommonMultiple;
+}
+
+void WideInteger::trim()
+{
+    while (!mLimbs.empty() && 0u == mLimbs.back())
+    {
+        mLimbs.pop_back();
+    }
+
+    if (mLimbs.empty())
+    {
+        mIsNegative = false;
+    }
+}
+
+int WideInteger::compareMagnitudes(const Limbs& first, const Limbs& second)
+{
+    int result{0};
+
+    if (first.size() != second.size())
+    {
+        result = first.size() < second.size() ? -1 : 1;
+    }
+    else
+    {
+        for (size_t limbIndex{first.size()}; limbIndex > 0; --limbIndex)
+        {
+            if (first[limbIndex - 1] != second[limbIndex - 1])
+            {
+                result = first[limbIndex - 1] < second[limbIndex - 1] ? -1 : 1;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+WideInteger::Limbs WideInteger::addMagnitudes(const Limbs& first, const Limbs& second)
+{
+    const Limbs& cLonger{first.size() >= second.size() ? first : second};
+    const Limbs& cShorter{first.size() >= second.size() ? second : first};
+
+    Limbs result(cLonger.size() + 1, 0u);
+    std::uint64_t carry{0};
+
+    for (size_t limbIndex{0}; limbIndex < cLonger.size(); ++limbIndex)
+    {
+        const std::uint64_t cSum{static_cast<std::uint64_t>(cLonger[limbIndex]) + (limbIndex < cShorter.size() ? cShorter[limbIndex] : 0u) + carry};
+        result[limbIndex] = static_cast<std::uint32_t>(cSum);
+        carry = cSum >> scLimbBitsCount;
+    }
+
+    result[cLonger.size()] = static_cast<std::uint32_t>(carry);
+
+    return result;
+}
+
+WideInteger::Limbs WideInteger::subtractMagnitudes(const Limbs& larger, const Limbs& smaller)
+{
+    Limbs result(larger.size(), 0u);
+    std::int64_t borrow{0};
+
+    for (size_t limbIndex{0}; limbIndex < larger.size(); ++limbIndex)
+    {
+        std::int64_t difference{static_cast<std::int64_t>(larger[limbIndex]) - (limbIndex < smaller.size() ? smaller[limbIndex] : 0u) - borrow};
+        borrow = difference < 0 ? 1 : 0;
+        difference += borrow * static_cast<std::int64_t>(scLimbBase);
+        result[limbIndex] = static_cast<std::uint32_t>(difference);
+    }
+
+    return result;
+}
+
+WideInteger::Limbs WideInteger::multiplyMagnitudes(const Limbs& first, const Limbs& second)
+{
+    Limbs result(first.size() + second.size(), 0u);
+
+    for (size_t firstIndex{0}; firstIndex < first.size(); ++firstIndex)
+    {
+        std::uint64_t carry{0};
+        const std::uint64_t cFirstLimb{first[firstIndex]};
+
+        for (size_t secondIndex{0}; secondIndex < second.size(); ++secondIndex)
+        {
+            const std::uint64_t cProduct{cFirstLimb * second[secondIndex] + result[firstIndex + secondIndex] + carry};
+            result[firstIndex + secondIndex] = static_cast<std::uint32_t>(cProduct);
+            carry = cProduct >> scLimbBitsCount;
+        }
+
+        result[firstIndex + second.size()] = static_cast<std::uint32_t>(carry);
+    }
+
+    return result;
+}
+
+/* Schoolbook long division of magnitudes (Knuth, TAOCP vol. 2, algorithm D)
+*/
+void WideInteger::divideMagnitudes(const Limbs& dividend, const Limbs& divisor, Limbs& quotient, Limbs& remainder)
+{
+    if (compareMagnitudes(dividend, divisor) < 0)
+    {
+        quotient.clear();
+        remainder = dividend;
+    }
+    else if (1u == divisor.size())
+    {
+        quotient = dividend;
+        const std::uint32_t cRemainder{divideMagnitudeByLimb(quotient, divisor[0])};
+        remainder.assign(1u, cRemainder);
+    }
+    else
+    {
+        const size_t cDivisorSize{divisor.size()};
+        const size_t cQuotientSize{dividend.size() - cDivisorSize + 1};
+        const int cNormalizationShift{std::countl_zero(divisor.back())};
+
+        // normalize so that the most significant divisor limb has its top bit set (required for a good quotient estimate)
+        Limbs normalizedDivisor(cDivisorSize, 0u);
+        Limbs normalizedDividend(dividend.size() + 1, 0u);
+
+        for (size_t limbIndex{cDivisorSize}; limbIndex > 0; --limbIndex)
+        {
+            const std::uint64_t cLowerLimb{limbIndex > 1 ? divisor[limbIndex - 2] : 0u};
+            normalizedDivisor[limbIndex - 1] = static_cast<std::uint32_t>(((static_cast<std::uint64_t>(divisor[limbIndex - 1]) << scLimbBitsCount | cLowerLimb) << cNormalizationShift) >> scLimbBitsCount);
+        }
+
+        for (size_t limbIndex{dividend.size() + 1}; limbIndex > 0; --limbIndex)
+        {
+            const std::uint64_t cUpperLimb{limbIndex - 1 < dividend.size() ? dividend[limbIndex - 1] : 0u};
+            const std::uint64_t cLowerLimb{limbIndex > 1 ? dividend[limbIndex - 2] : 0u};
+            normalizedDividend[limbIndex - 1] = static_cast<std::uint32_t>(((cUpperLimb << scLimbBitsCount | cLowerLimb) << cNormalizationShift) >> scLimbBitsCount);
+        }
+
+        quotient.assign(cQuotientSize, 0u);
+
+        const std::uint64_t cTopDivisorLimb{normalizedDivisor[cDivisorSize - 1]};
+        const std::uint64_t cSecondDivisorLimb{normalizedDivisor[cDivisorSize - 2]};
+
+        for (size_t quotientIndex{cQuotientSize}; quotientIndex > 0; --quotientIndex)
+        {
+            const size_t cShift{quotientIndex - 1};
+            const std::uint64_t cTopDividendLimbs{static_cast<std::uint64_t>(normalizedDividend[cShift + cDivisorSize]) << scLimbBitsCount | normalizedDividend[cShift + cDivisorSize - 1]};
+
+            std::uint64_t quotientEstimate{cTopDividendLimbs / cTopDivisorLimb};
+            std::uint64_t remainderEstimate{cTopDividendLimbs % cTopDivisorLimb};
+
+            while (quotientEstimate >= scLimbBase ||
+                   quotientEstimate * cSecondDivisorLimb > (remainderEstimate << scLimbBitsCount | normalizedDividend[cShift + cDivisorSize - 2]))
+            {
+                --quotientEstimate;
+                remainderEstimate += cTopDivisorLimb;
+
+                if (remainderEstimate >= scLimbBase)
+                {
+                    break;
+                }
+            }
+
+            // multiply and subtract
+            std::int64_t borrow{0};
+            std::int64_t difference{0};
+
+            for (size_t limbIndex{0}; limbIndex < cDivisorSize; ++limbIndex)
+            {
+                const std::uint64_t cProduct{quotientEstimate * normalizedDivisor[limbIndex]};
+                difference = static_cast<std::int64_t>(normalizedDividend[limbIndex + cShift]) - borrow - static_cast<std::int64_t>(cProduct & (scLimbBase - 1));
+                normalizedDividend[limbIndex + cShift] = static_cast<std::uint32_t>(difference);
+                borrow = static_cast<std::int64_t>(cProduct >> scLimbBitsCount) - (difference >> scLimbBitsCount);
+            }
+
+            difference = static_cast<std::int64_t>(normalizedDividend[cShift + cDivisorSize]) - borrow;
+            normalizedDividend[cShift + cDivisorSize] = static_cast<std::uint32_t>(difference);
+
+            // the estimate was one unit too large (rare): add the divisor back
+            if (difference < 0)
+            {
+                --quotientEstimate;
+                std::uint64_t carry{0};
+
+                for (size_t limbIndex{0}; limbIndex < cDivisorSize; ++limbIndex)
+                {
+                    const std::uint64_t cSum{static_cast<std::uint64_t>(normalizedDividend[limbIndex + cShift]) + normalizedDivisor[limbIndex] + carry};
+                    normalizedDividend[limbIndex + cShift] = static_cast<std::uint32_t>(cSum);
+                    carry = cSum >> scLimbBitsCount;
+                }
+
+                normalizedDividend[cShift + cDivisorSize] += static_cast<std::uint32_t>(carry);
+            }
+
+            quotient[cShift] = static_cast<std::uint32_t>(quotientEstimate);
+        }
+
+        // denormalize the remainder
+        remainder.assign(cDivisorSize, 0u);
+
+        for (size_t limbIndex{0}; limbIndex < cDivisorSize; ++limbIndex)
+        {
+            const std::uint64_t cTwoLimbs{static_cast<std::uint64_t>(normalizedDividend[limbIndex + 1]) << scLimbBitsCount | normalizedDividend[limbIndex]};
+            remainder[limbIndex] = static_cast<std::uint32_t>(cTwoLimbs >> cNormalizationShift);
+        }
+    }
+}
+
+std::uint32_t WideInteger::divideMagnitudeByLimb(Limbs& magnitude, std::uint32_t divisor)
+{
+    std::uint64_t remainder{0};
+
+    for (size_t limbIndex{magnitude.size()}; limbIndex > 0; --limbIndex)
+    {
+        const std::uint64_t cCurrentDividend{remainder << scLimbBitsCount | magnitude[limbIndex - 1]};
+        magnitude[limbIndex - 1] = static_cast<std::uint32_t>(cCurrentDividend / divisor);
+        remainder = cCurrentDividend % divisor;
+    }
+
+    while (!magnitude.empty() && 0u == magnitude.back())
+    {
+        magnitude.pop_back();
+    }
+
+    return static_cast<std::uint32_t>(remainder);
+}
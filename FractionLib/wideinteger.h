@@ -0,0 +1,88 @@
+#ifndef WIDEINTEGER_H
+#define WIDEINTEGER_H
+
+#include <compare>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <ostream>
+
+/* Arbitrary precision signed integer, used wherever the int based Fraction arithmetic would overflow
+   (e.g. the intermediate values of the fraction-free elimination algorithms)
+*/
+class WideInteger
+{
+public:
+    // constructors
+    WideInteger();
+    WideInteger(long long value);
+    explicit WideInteger(const std::string& integerString);
+
+    // arithmetic operators
+    WideInteger operator+(const WideInteger& wideInteger) const;
+    WideInteger operator-(const WideInteger& wideInteger) const;
+    WideInteger operator*(const WideInteger& wideInteger) const;
+    WideInteger operator/(const WideInteger& wideInteger) const;
+    WideInteger operator%(const WideInteger& wideInteger) const;
+    WideInteger operator-() const;
+
+    WideInteger operator<<(unsigned int bitsCount) const;
+    WideInteger operator>>(unsigned int bitsCount) const;
+
+    WideInteger& operator+=(const WideInteger& wideInteger);
+    WideInteger& operator-=(const WideInteger& wideInteger);
+    WideInteger& operator*=(const WideInteger& wideInteger);
+    WideInteger& operator/=(const WideInteger& wideInteger);
+    WideInteger& operator%=(const WideInteger& wideInteger);
+
+    // logical operators
+    std::strong_ordering operator<=>(const WideInteger& wideInteger) const;
+    bool operator==(const WideInteger& wideInteger) const;
+
+    explicit operator bool() const;
+
+    // other logical test functions
+    bool isZero() const;
+    bool isNegative() const;
+    bool isOdd() const;
+    bool fitsInt() const;
+    bool fitsLongLong() const;
+
+    // conversion functions
+    int toInt() const;
+    long long toLongLong() const;
+    double toDouble() const;
+    std::string toString() const;
+
+    // other functions
+    WideInteger abs() const;
+    int getSign() const;
+    unsigned int getBitLength() const;
+    std::uint32_t getRemainder(std::uint32_t divisor) const;   // the value modulo divisor, in [0, divisor) whatever the sign
+
+    // IO operators
+    friend std::ostream& operator<<(std::ostream& outputStream, const WideInteger& wideInteger);
+
+    // static helper functions
+    static void divide(const WideInteger& dividend, const WideInteger& divisor, WideInteger& quotient, WideInteger& remainder);
+    static WideInteger getGreatestCommonDivisor(const WideInteger& first, const WideInteger& second);
+    static WideInteger getLeastCommonMultiple(const WideInteger& first, const WideInteger& second);
+
+private:
+    using Limbs = std::vector<std::uint32_t>;
+
+    void trim();
+
+    static int compareMagnitudes(const Limbs& first, const Limbs& second);
+    static Limbs addMagnitudes(const Limbs& first, const Limbs& second);
+    static Limbs subtractMagnitudes(const Limbs& larger, const Limbs& smaller);
+    static Limbs multiplyMagnitudes(const Limbs& first, const Limbs& second);
+    static void divideMagnitudes(const Limbs& dividend, const Limbs& divisor, Limbs& quotient, Limbs& remainder);
+    static std::uint32_t divideMagnitudeByLimb(Limbs& magnitude, std::uint32_t divisor);
+
+    // little endian magnitude without leading zero limbs (0 has no limbs)
+    Limbs mLimbs;
+    bool mIsNegative;
+};
+
+#endif // WIDEINTEGER_H
@@ -1,4 +1,25 @@
 #include "tst_testfractions.h"
+#include "tst_testwidenumbers.h"
+#include "tst_testfractionmatrices.h"
+#include "tst_testsparsefractionmatrices.h"
+#include "tst_testsimplexsolver.h"
+#include "tst_testcontinuedfractions.h"
+#include "tst_testfractioninstrumentation.h"
+#include "tst_testfractioncontext.h"
+#include "tst_testatomicfraction.h"
+#include "tst_testfractionformula.h"
+#include "tst_testfractionscheduler.h"
+#include "tst_testfractiongenerator.h"
+#include "tst_testseriessummation.h"
+#include "tst_testfractionsequences.h"
+#include "tst_testfractionstats.h"
+#include "tst_testfractionpolynomial.h"
+#include "tst_testfractionbtree.h"
+#include "tst_testfractioncsvreader.h"
+#include "tst_testfractioncapi.h"
+#include "tst_testfractionarray.h"
+#include "tst_testfractionmodular.h"
+#include "tst_testfractioncodec.h"
 
 #include <gtest/gtest.h>
 
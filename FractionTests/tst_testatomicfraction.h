@@ -0,0 +1,122 @@
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/atomicfraction.h"
+
+
+using namespace testing;
+
+/* Test the atomic operations */
+
+TEST(atomicFraction, loadStoreExchange)
+{
+    AtomicFraction atomicFraction{Fraction{6, -8}};
+
+    EXPECT_TRUE(AtomicFraction::isAlwaysLockFree());
+    EXPECT_EQ(atomicFraction.load(), Fraction(-3, 4));
+
+    atomicFraction.store(Fraction{-2147483647, 2147483646});
+    EXPECT_EQ(atomicFraction.load(), Fraction(-2147483647, 2147483646));
+    EXPECT_EQ(atomicFraction.exchange(Fraction{1, 3}), Fraction(-2147483647, 2147483646));
+    EXPECT_EQ(atomicFraction.load(), Fraction(1, 3));
+    EXPECT_EQ(AtomicFraction{}.load(), Fraction(0));
+}
+
+TEST(atomicFraction, compareExchange)
+{
+    AtomicFraction atomicFraction{Fraction{1, 2}};
+    Fraction expected{2, 4};
+
+    EXPECT_TRUE(atomicFraction.compareExchange(expected, Fraction{2, 3}));
+    EXPECT_EQ(atomicFraction.load(), Fraction(2, 3));
+
+    expected = Fraction{1, 2};
+    EXPECT_FALSE(atomicFraction.compareExchange(expected, Fraction{5}));
+    EXPECT_EQ(expected, Fraction(2, 3));
+    EXPECT_EQ(atomicFraction.load(), Fraction(2, 3));
+}
+
+TEST(atomicFraction, readModifyWrite)
+{
+    AtomicFraction atomicFraction{Fraction{1, 2}};
+
+    EXPECT_EQ(atomicFraction.fetchAdd(Fraction{1, 3}), Fraction(1, 2));
+    EXPECT_EQ(atomicFraction.fetchSubtract(Fraction{1, 6}), Fraction(5, 6));
+    EXPECT_EQ(atomicFraction.fetchMul(Fraction{-3, 4}), Fraction(2, 3));
+    EXPECT_EQ(atomicFraction.load(), Fraction(-1, 2));
+
+    // the overflowing updates leave the value unchanged
+    atomicFraction.store(Fraction{2000000000, 3});
+    EXPECT_THROW(atomicFraction.fetchAdd(Fraction{2000000000, 3}), std::overflow_error);
+    EXPECT_THROW(atomicFraction.fetchMul(Fraction{2}), std::overflow_error);
+    EXPECT_EQ(atomicFraction.load(), Fraction(2000000000, 3));
+}
+
+TEST(atomicFraction, concurrentUpdates)
+{
+    const size_t cThreadsCount{4};
+    const int cAdditionsCount{5000};
+    AtomicFraction atomicFraction;
+    std::vector<std::thread> threads;
+
+    for (size_t threadIndex{0}; threadIndex < cThreadsCount; ++threadIndex)
+    {
+        threads.emplace_back([&atomicFraction, threadIndex]()
+        {
+            // each thread adds 1/2, 1/3, 1/6 or 1/12 (all updates keep the denominator of the sum small)
+            const Fraction cIncrement{1, 0 == threadIndex ? 2 : 1 == threadIndex ? 3 : 2 == threadIndex ? 6 : 12};
+
+            for (int addition{0}; addition < cAdditionsCount; ++addition)
+            {
+                atomicFraction.fetchAdd(cIncrement);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // 5000 * (1/2 + 1/3 + 1/6 + 1/12) = 5000 * 13/12
+    EXPECT_EQ(atomicFraction.load(), Fraction(16250, 3));
+}
+
+/* Test the sharded accumulator */
+
+TEST(atomicFraction, shardedAccumulator)
+{
+    const size_t cThreadsCount{6};
+    ShardedFractionAccumulator accumulator{4};
+    std::vector<std::thread> threads;
+
+    EXPECT_EQ(accumulator.getShardsCount(), 4u);
+    EXPECT_GE(ShardedFractionAccumulator{}.getShardsCount(), 1u);
+
+    for (size_t threadIndex{0}; threadIndex < cThreadsCount; ++threadIndex)
+    {
+        threads.emplace_back([&accumulator]()
+        {
+            for (int addition{0}; addition < 1000; ++addition)
+            {
+                accumulator.add(Fraction{1, 7});
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(accumulator.getSum(), WideFraction{Fraction(6000, 7)});
+
+    accumulator.reset();
+    accumulator.add(Fraction{-1, 3});
+    EXPECT_EQ(accumulator.getSum(), WideFraction{Fraction(-1, 3)});
+}
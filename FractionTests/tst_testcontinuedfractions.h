@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cmath>
+#include <random>
+#include <limits>
+#include <vector>
+#include <numbers>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/continuedfraction.h"
+#include "../FractionLib/fractionbatch.h"
+#include "../FractionLib/widefraction.h"
+
+
+using namespace testing;
+
+static_assert(std::forward_iterator<SemiconvergentSequence::Iterator>);
+
+/* Test the continued fraction expansion */
+
+TEST(continuedFractions, terms)
+{
+    EXPECT_EQ(ContinuedFraction{Fraction(415, 93)}.getTerms(), (std::vector<int>{4, 2, 6, 7}));
+    EXPECT_EQ(ContinuedFraction{Fraction(-7, 3)}.getTerms(), (std::vector<int>{-3, 1, 2}));
+    EXPECT_EQ(ContinuedFraction{Fraction(5)}.getTerms(), (std::vector<int>{5}));
+    EXPECT_EQ(ContinuedFraction{}.getTerms(), (std::vector<int>{0}));
+    EXPECT_EQ(ContinuedFraction{Fraction(415, 93)}.toFraction(), Fraction(415, 93));
+    EXPECT_EQ(ContinuedFraction{Fraction(-2147483647, 1073741824)}.toFraction(), Fraction(-2147483647, 1073741824));
+}
+
+TEST(continuedFractions, convergents)
+{
+    const ContinuedFraction cContinuedFraction{Fraction(415, 93)};
+
+    EXPECT_EQ(cContinuedFraction.getConvergents(), (std::vector<Fraction>{Fraction{4}, Fraction{9, 2}, Fraction{58, 13}, Fraction{415, 93}}));
+    EXPECT_TRUE(std::ranges::equal(cContinuedFraction.getSemiconvergents(), std::vector<Fraction>{Fraction{4}, Fraction{5}, Fraction{9, 2}, Fraction{13, 3}, Fraction{22, 5}, Fraction{31, 7},
+                                                                                                  Fraction{40, 9}, Fraction{49, 11}, Fraction{58, 13}, Fraction{67, 15}, Fraction{125, 28},
+                                                                                                  Fraction{183, 41}, Fraction{241, 54}, Fraction{299, 67}, Fraction{357, 80}, Fraction{415, 93}}));
+
+    // the semiconvergents are computed lazily, 1 / 2147483647 has 2147483648 of them
+    const SemiconvergentSequence cSemiconvergents{ContinuedFraction{Fraction{1, 2147483647}}.getSemiconvergents()};
+    SemiconvergentSequence::Iterator semiconvergentIt{cSemiconvergents.begin()};
+
+    EXPECT_EQ(*semiconvergentIt++, Fraction(0));
+    EXPECT_EQ(*semiconvergentIt++, Fraction(1));
+    EXPECT_EQ(*semiconvergentIt, Fraction(1, 2));
+    EXPECT_TRUE(std::ranges::equal(ContinuedFraction{Fraction{-7, 2}}.getSemiconvergents(), std::vector<Fraction>{Fraction{-4}, Fraction{-3}, Fraction{-7, 2}}));
+    EXPECT_TRUE(std::ranges::equal(ContinuedFraction{}.getSemiconvergents(), std::vector<Fraction>{Fraction{}}));
+}
+
+/* Test the best rational approximations */
+
+TEST(continuedFractions, limitDenominator)
+{
+    const Fraction cPi{314159265, 100000000};
+
+    EXPECT_EQ(cPi.limitDenominator(10), Fraction(22, 7));
+    EXPECT_EQ(cPi.limitDenominator(100), Fraction(311, 99));
+    EXPECT_EQ(cPi.limitDenominator(1000), Fraction(355, 113));
+    EXPECT_EQ(cPi.limitDenominator(100000), Fraction(308429, 98176));
+    EXPECT_EQ(Fraction(-314159265, 100000000).limitDenominator(100), Fraction(-311, 99));
+    EXPECT_EQ(Fraction(1, 3).limitDenominator(2), Fraction(1, 2));
+    EXPECT_EQ(Fraction(2147483647, 1073741824).limitDenominator(1000), Fraction(2));
+    EXPECT_EQ(Fraction(3, 7).limitDenominator(7), Fraction(3, 7));
+    EXPECT_EQ(ContinuedFraction{cPi}.getBestApproximation(1000), Fraction(355, 113));
+    EXPECT_THROW(cPi.limitDenominator(0), std::runtime_error);
+}
+
+TEST(continuedFractions, limitDenominatorBruteForce)
+{
+    std::mt19937 generator{29};
+    std::uniform_int_distribution<int> numeratorDistribution{-1000000, 1000000};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 1000000};
+    std::uniform_int_distribution<int> maxDenominatorDistribution{1, 60};
+
+    for (size_t testIndex{0}; testIndex < 300; ++testIndex)
+    {
+        const Fraction cValue{numeratorDistribution(generator), denominatorDistribution(generator)};
+        const int cMaxDenominator{maxDenominatorDistribution(generator)};
+
+        // closest p / q over all denominators, the first one found wins the ties
+        Fraction expected;
+        WideFraction minError{WideInteger{-1}};
+
+        for (int denominator{1}; denominator <= cMaxDenominator; ++denominator)
+        {
+            const long long cFloor{static_cast<long long>(std::floor(cValue.getDecimalValue() * denominator))};
+
+            for (long long numerator{cFloor - 1}; numerator <= cFloor + 2; ++numerator)
+            {
+                const Fraction cCandidate{static_cast<int>(numerator), denominator};
+                const WideFraction cDifference{WideFraction{cCandidate} - WideFraction{cValue}};
+                const WideFraction cError{cDifference < WideFraction{} ? -cDifference : cDifference};
+
+                if (minError < WideFraction{} || cError < minError)
+                {
+                    expected = cCandidate;
+                    minError = cError;
+                }
+            }
+        }
+
+        EXPECT_EQ(cValue.limitDenominator(cMaxDenominator), expected);
+    }
+}
+
+TEST(continuedFractions, batchLimitDenominators)
+{
+    std::vector<Fraction> fractions{Fraction{314159265, 100000000}, Fraction{1, 3}, Fraction{-7, 1000}};
+    std::vector<Fraction> results(fractions.size());
+
+    limitDenominators(fractions, results, 10);
+    EXPECT_EQ(results, (std::vector<Fraction>{Fraction{22, 7}, Fraction{1, 3}, Fraction{0}}));
+
+    limitDenominators(fractions, 100);
+    EXPECT_EQ(fractions, (std::vector<Fraction>{Fraction{311, 99}, Fraction{1, 3}, Fraction{-1, 100}}));
+
+    EXPECT_THROW(limitDenominators(fractions, std::span<Fraction>{results.data(), 2}, 10), std::runtime_error);
+}
+
+/* Test the simplest fraction of an interval */
+
+// smallest denominator first, then the smallest absolute numerator (the interval must be positive)
+inline Fraction getBruteForceSimplest(const Fraction& lower, const Fraction& upper)
+{
+    for (long long denominator{1}; ; ++denominator)
+    {
+        // the smallest numerator with numerator / denominator >= lower
+        const long long cNumerator{(static_cast<long long>(lower.getNumerator()) * denominator + lower.getDenominator() - 1) / lower.getDenominator()};
+
+        if (cNumerator * upper.getDenominator() <= static_cast<long long>(upper.getNumerator()) * denominator)
+        {
+            return Fraction{static_cast<int>(cNumerator), static_cast<int>(denominator)};
+        }
+    }
+}
+
+TEST(continuedFractions, simplestBetween)
+{
+    EXPECT_EQ(Fraction::simplestBetween(Fraction{3, 10}, Fraction{4, 10}), Fraction(1, 3));
+    EXPECT_EQ(Fraction::simplestBetween(Fraction{31415, 10000}, Fraction{31416, 10000}), Fraction(333, 106));
+    EXPECT_EQ(Fraction::simplestBetween(Fraction{5, 2}, Fraction{7, 2}), Fraction(3));
+    EXPECT_EQ(Fraction::simplestBetween(Fraction{2, 7}, Fraction{2, 7}), Fraction(2, 7));
+    EXPECT_EQ(Fraction::simplestBetween(Fraction{-1, 3}, Fraction{1, 2}), Fraction{});
+    EXPECT_EQ(Fraction::simplestBetween(Fraction{-4, 10}, Fraction{-3, 10}), Fraction(-1, 3));
+    EXPECT_EQ(Fraction::simplestBetween(Fraction{1, 2000000000}, Fraction{1, 1999999999}), Fraction(1, 1999999999));
+    EXPECT_EQ(Fraction::simplestBetween(Fraction{1999999999}, Fraction{std::numeric_limits<int>::max()}), Fraction(1999999999));
+    EXPECT_EQ(Fraction::simplestBetween(Fraction{99999, 100000}, Fraction{70000, 3}), Fraction(1));
+    EXPECT_THROW(Fraction::simplestBetween(Fraction{1, 2}, Fraction{1, 3}), std::runtime_error);
+    EXPECT_THROW(Fraction::simplestBetween(Fraction{70000, 3}, Fraction{99999, 100000}), std::runtime_error);
+
+    EXPECT_EQ(Fraction::simplestBetween(0.333, 0.334), Fraction(1, 3));
+    EXPECT_EQ(Fraction::simplestBetween(std::numbers::pi - 1e-6, std::numbers::pi + 1e-6), Fraction(355, 113));
+    EXPECT_EQ(Fraction::simplestBetween(-2.6, -2.4), Fraction(-5, 2));
+    EXPECT_THROW(Fraction::simplestBetween(0.0, std::nan("")), std::runtime_error);
+    EXPECT_EQ(Fraction::simplestBetween(0.1, 0.1), Fraction(1, 10));
+    EXPECT_THROW(Fraction::simplestBetween(3e9, 4e9), std::overflow_error);
+
+    // random intervals compared to trying all the denominators
+    std::mt19937 generator{39};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 5000};
+
+    for (size_t index{0}; index < 300; ++index)
+    {
+        const int cDenominator{denominatorDistribution(generator)};
+        const int cNumerator{std::uniform_int_distribution<int>{1, 3 * cDenominator}(generator)};
+        const Fraction cLower{cNumerator, cDenominator};
+        const Fraction cUpper{Fraction{cNumerator, cDenominator} + Fraction{1, denominatorDistribution(generator) * 10}};
+
+        EXPECT_EQ(Fraction::simplestBetween(cLower, cUpper), getBruteForceSimplest(cLower, cUpper));
+    }
+}
+
+TEST(continuedFractions, batchQuantize)
+{
+    const std::vector<double> cValues{0.3333, 0.6666667, -1.25, 2.718281828, 0.0};
+    std::vector<Fraction> results(cValues.size());
+
+    quantizeValues(cValues, results, 1e-2);
+    EXPECT_EQ(results, (std::vector<Fraction>{Fraction{1, 3}, Fraction{2, 3}, Fraction{-5, 4}, Fraction{19, 7}, Fraction{}}));
+
+    std::vector<Fraction> fractions{Fraction{3333, 10000}, Fraction{-5, 4}, Fraction{314159, 100000}};
+
+    quantizeFractions(fractions, std::span<Fraction>{results.data(), 3}, Fraction{1, 100});
+    EXPECT_EQ(std::vector<Fraction>(results.begin(), results.begin() + 3), (std::vector<Fraction>{Fraction{1, 3}, Fraction{-5, 4}, Fraction{22, 7}}));
+
+    quantizeFractions(fractions, Fraction{});
+    EXPECT_EQ(fractions, (std::vector<Fraction>{Fraction{3333, 10000}, Fraction{-5, 4}, Fraction{314159, 100000}}));
+
+    EXPECT_THROW(quantizeValues(cValues, results, -1.0), std::runtime_error);
+    EXPECT_THROW(quantizeFractions(fractions, Fraction{-1, 2}), std::runtime_error);
+    EXPECT_THROW(quantizeValues(cValues, std::span<Fraction>{results.data(), 2}, 1e-3), std::runtime_error);
+}
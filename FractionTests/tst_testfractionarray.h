@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <string_view>
+#include <memory_resource>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractionarray.h"
+#include "../FractionLib/fractioncsvreader.h"
+
+using namespace testing;
+
+// memory resource counting the allocations forwarded to its upstream resource
+class CountingMemoryResource : public std::pmr::memory_resource
+{
+public:
+    explicit CountingMemoryResource(std::pmr::memory_resource* upstream)
+        : mUpstream{upstream}
+        , mAllocationsCount{0}
+    {
+    }
+
+    size_t getAllocationsCount() const
+    {
+        return mAllocationsCount;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++mAllocationsCount;
+        return mUpstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+    {
+        mUpstream->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& memoryResource) const noexcept override
+    {
+        return this == &memoryResource;
+    }
+
+    std::pmr::memory_resource* mUpstream;
+    size_t mAllocationsCount;
+};
+
+// makes any allocation from the default resource fail while it is in scope
+class NullDefaultResourceGuard
+{
+public:
+    NullDefaultResourceGuard()
+        : mPreviousResource{std::pmr::set_default_resource(std::pmr::null_memory_resource())}
+    {
+    }
+
+    ~NullDefaultResourceGuard()
+    {
+        std::pmr::set_default_resource(mPreviousResource);
+    }
+
+private:
+    std::pmr::memory_resource* mPreviousResource;
+};
+
+/* Test the arrays allocated from memory resources */
+
+TEST(fractionArray, readFractionArray)
+{
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    std::istringstream stream{"1/2\n\n-0.75\r\nabc\n+3\n"};
+    const FractionArray cExpectedFractions{Fraction{1, 2}, Fraction{-3, 4}, Fraction{3}};
+    FractionContext context;
+    const NullDefaultResourceGuard cGuard;
+
+    const FractionArray cFractions{readFractionArray(stream, &arena, context)};
+
+    EXPECT_EQ(cFractions, cExpectedFractions);
+    EXPECT_EQ(cFractions.get_allocator().resource(), &arena);
+    EXPECT_TRUE(context.isRaised(FractionError::INVALID_FORMAT));
+}
+
+TEST(fractionArray, parseFractionArray)
+{
+    const std::string cText{"7/21 1.125 x 1/0"};
+    const std::vector<std::string_view> cStrings{std::string_view{cText}.substr(0, 4), std::string_view{cText}.substr(5, 5),
+                                                 std::string_view{cText}.substr(11, 1), std::string_view{cText}.substr(13, 3)};
+
+    CountingMemoryResource countingResource{std::pmr::new_delete_resource()};
+    FractionContext context;
+
+    const FractionArray cFractions{parseFractionArray(cStrings, &countingResource, context)};
+
+    EXPECT_EQ(cFractions, (FractionArray{Fraction{1, 3}, Fraction{9, 8}, Fraction{0}, Fraction{0}}));
+    EXPECT_EQ(countingResource.getAllocationsCount(), 1u);
+    EXPECT_TRUE(context.isRaised(FractionError::INVALID_FORMAT));
+    EXPECT_TRUE(context.isRaised(FractionError::DIVISION_BY_ZERO));
+}
+
+TEST(fractionArray, csvReaderColumns)
+{
+    std::string text{"a,b,c\n"};
+
+    for (int row{0}; row < 1000; ++row)
+    {
+        text += std::to_string(row) + "/7," + std::to_string(row) + ".5,-" + std::to_string(row) + "\n";
+    }
+
+    FractionScheduler scheduler{4};
+    FractionCsvReader reader{',', true, scheduler};
+    reader.setChunkSize(512);
+
+    // a single allocation per column and one for the array of columns
+    CountingMemoryResource countingResource{std::pmr::new_delete_resource()};
+    const FractionCsvTable cTable{reader.read(text, &countingResource)};
+
+    EXPECT_EQ(cTable.getRowsCount(), 1000u);
+    EXPECT_EQ(cTable.getColumn("b")[999], Fraction(1999, 2));
+    EXPECT_EQ(cTable.getColumn(2).get_allocator().resource(), &countingResource);
+    EXPECT_EQ(countingResource.getAllocationsCount(), 4u);
+
+    // same columns from an arena, nothing is allocated from the default resource
+    std::pmr::monotonic_buffer_resource arena;
+    const NullDefaultResourceGuard cGuard;
+    const FractionCsvTable cArenaTable{reader.read(text, &arena)};
+
+    for (size_t column{0}; column < cTable.getColumnsCount(); ++column)
+    {
+        EXPECT_EQ(cArenaTable.getColumn(column), cTable.getColumn(column));
+    }
+}
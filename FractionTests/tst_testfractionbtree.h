@@ -0,0 +1,211 @@
+#pragma once
+
+#include <map>
+#include <vector>
+#include <random>
+#include <climits>
+#include <iterator>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractionbtree.h"
+
+using namespace testing;
+
+static_assert(std::forward_iterator<FractionBTree<int>::Iterator>);
+
+// exact order of fractions with large terms (the products are computed with long long)
+struct ExactFractionLess
+{
+    bool operator()(const Fraction& first, const Fraction& second) const
+    {
+        return static_cast<long long>(first.getNumerator()) * second.getDenominator() < static_cast<long long>(second.getNumerator()) * first.getDenominator();
+    }
+};
+
+using ReferenceMap = std::map<Fraction, int, ExactFractionLess>;
+
+inline std::vector<std::pair<Fraction, int>> getEntries(FractionBTree<int>::Iterator begin, FractionBTree<int>::Iterator end)
+{
+    std::vector<std::pair<Fraction, int>> result;
+
+    for (; begin != end; ++begin)
+    {
+        result.emplace_back((*begin).key, (*begin).value);
+    }
+
+    return result;
+}
+
+inline std::vector<std::pair<Fraction, int>> getEntries(ReferenceMap::const_iterator begin, ReferenceMap::const_iterator end)
+{
+    return std::vector<std::pair<Fraction, int>>(begin, end);
+}
+
+/* Test the insertion and the lookups */
+
+TEST(fractionBTree, insert)
+{
+    FractionBTree<int> tree;
+
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_EQ(tree.begin(), tree.end());
+    EXPECT_EQ(tree.find(Fraction{1, 2}), tree.end());
+
+    EXPECT_TRUE(tree.insert(Fraction{3, 7}, 1).second);
+    EXPECT_TRUE(tree.insert(Fraction{5, 8}, 2).second);
+    EXPECT_FALSE(tree.insert(Fraction{6, 14}, 3).second);
+
+    tree[Fraction{1, 2}] = 4;
+    tree[Fraction{5, 8}] += 10;
+
+    EXPECT_EQ(tree.getSize(), 3u);
+    EXPECT_EQ((*tree.find(Fraction{3, 7})).value, 1);
+    EXPECT_EQ((*tree.find(Fraction{10, 16})).value, 12);
+    EXPECT_EQ((*tree.lowerBound(Fraction{4, 9})).key, Fraction(1, 2));
+    EXPECT_EQ((*tree.upperBound(Fraction{1, 2})).key, Fraction(5, 8));
+    EXPECT_EQ(tree.upperBound(Fraction{5, 8}), tree.end());
+
+    tree.clear();
+    EXPECT_EQ(tree.getSize(), 0u);
+    EXPECT_EQ(tree.begin(), tree.end());
+}
+
+TEST(fractionBTree, insertRandomized)
+{
+    std::mt19937 generator{45};
+    std::uniform_int_distribution<int> numeratorDistribution{-5000, 5000};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 300};
+    FractionBTree<int> tree;
+    ReferenceMap reference;
+
+    for (int index{0}; index < 50000; ++index)
+    {
+        const Fraction cKey{numeratorDistribution(generator), denominatorDistribution(generator)};
+
+        EXPECT_EQ(tree.insert(cKey, index).second, reference.emplace(cKey, index).second);
+    }
+
+    EXPECT_EQ(tree.getSize(), reference.size());
+    EXPECT_GE(tree.getHeight(), 2u);
+    EXPECT_EQ(getEntries(tree.begin(), tree.end()), getEntries(reference.begin(), reference.end()));
+
+    for (int query{0}; query < 2000; ++query)
+    {
+        Fraction lower{numeratorDistribution(generator), denominatorDistribution(generator)};
+        const Fraction cUpper{lower + Fraction{numeratorDistribution(generator) % 100 + 100, denominatorDistribution(generator)}};
+
+        EXPECT_EQ(getEntries(tree.lowerBound(lower), tree.upperBound(cUpper)), getEntries(reference.lower_bound(lower), reference.upper_bound(cUpper)));
+        EXPECT_EQ(tree.find(lower) == tree.end(), reference.find(lower) == reference.end());
+    }
+}
+
+TEST(fractionBTree, equalDecimalValues)
+{
+    // distinct fractions whose decimal values are equal are still ordered exactly
+    const Fraction cFirst{INT_MAX - 2, INT_MAX - 1};
+    const Fraction cSecond{INT_MAX - 1, INT_MAX};
+
+    ASSERT_EQ(cFirst.getDecimalValue(), cSecond.getDecimalValue());
+
+    FractionBTree<int> tree;
+    ReferenceMap reference;
+
+    for (int offset{0}; offset < 200; ++offset)
+    {
+        const Fraction cKey{INT_MAX - 1 - offset, INT_MAX - offset};
+
+        tree.insert(cKey, offset);
+        reference.emplace(cKey, offset);
+    }
+
+    EXPECT_EQ(getEntries(tree.begin(), tree.end()), getEntries(reference.begin(), reference.end()));
+    EXPECT_EQ((*tree.lowerBound(cSecond)).value, 0);
+    EXPECT_EQ((*tree.upperBound(cFirst)).value, 0);
+    EXPECT_EQ((*tree.find(cFirst)).value, 1);
+}
+
+/* Test the bulk loading and the range scans */
+
+TEST(fractionBTree, fromSorted)
+{
+    for (size_t size : {0u, 1u, 64u, 65u, 64u * 65u, 64u * 65u + 1u, 300000u})
+    {
+        std::vector<Fraction> keys;
+        std::vector<int> values;
+
+        for (size_t index{0}; index < size; ++index)
+        {
+            keys.emplace_back(static_cast<int>(index) - 1000, 7);
+            values.push_back(static_cast<int>(index));
+        }
+
+        FractionBTree<int> tree{FractionBTree<int>::fromSorted(keys, values)};
+        size_t index{0};
+
+        EXPECT_EQ(tree.getSize(), size);
+
+        for (const auto& [cKey, cValue] : tree)
+        {
+            ASSERT_EQ(cKey, keys[index]);
+            ASSERT_EQ(cValue, values[index]);
+            ++index;
+        }
+
+        EXPECT_EQ(index, size);
+
+        // inserting into the full leaves and inner nodes
+        tree.insert(Fraction{1, 14}, -1);
+
+        EXPECT_EQ((*tree.find(Fraction{1, 14})).value, -1);
+        EXPECT_EQ(std::distance(tree.begin(), tree.end()), static_cast<std::ptrdiff_t>(size + 1));
+    }
+
+    const std::vector<int> cValues{1, 2};
+
+    EXPECT_THROW(FractionBTree<int>::fromSorted(std::vector<Fraction>{Fraction{1}, Fraction{1}}, cValues), std::runtime_error);
+    EXPECT_THROW(FractionBTree<int>::fromSorted(std::vector<Fraction>{Fraction{1}}, cValues), std::runtime_error);
+}
+
+TEST(fractionBTree, forEachInRange)
+{
+    std::vector<Fraction> keys;
+    std::vector<int> values;
+
+    for (int denominator{1}; denominator <= 40; ++denominator)
+    {
+        for (int numerator{0}; numerator <= denominator; ++numerator)
+        {
+            keys.emplace_back(numerator, denominator);
+        }
+    }
+
+    ReferenceMap reference;
+
+    for (const Fraction& key : keys)
+    {
+        reference.emplace(key, static_cast<int>(reference.size()));
+    }
+
+    keys.clear();
+
+    for (const auto& [cKey, cValue] : reference)
+    {
+        keys.push_back(cKey);
+        values.push_back(cValue);
+    }
+
+    const FractionBTree<int> cTree{FractionBTree<int>::fromSorted(keys, values)};
+    std::vector<std::pair<Fraction, int>> entries;
+
+    cTree.forEachInRange(Fraction{3, 7}, Fraction{5, 8}, [&entries](const Fraction& key, int value) {entries.emplace_back(key, value);});
+
+    EXPECT_EQ(entries, getEntries(reference.lower_bound(Fraction{3, 7}), reference.upper_bound(Fraction{5, 8})));
+    EXPECT_EQ(entries.front().first, Fraction(3, 7));
+    EXPECT_EQ(entries.back().first, Fraction(5, 8));
+
+    entries.clear();
+    cTree.forEachInRange(Fraction{2}, Fraction{3}, [&entries](const Fraction& key, int value) {entries.emplace_back(key, value);});
+    EXPECT_TRUE(entries.empty());
+}
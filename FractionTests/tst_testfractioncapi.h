@@ -0,0 +1,138 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <random>
+#include <climits>
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractioncapi.h"
+#include "../FractionLib/fraction.h"
+
+using namespace testing;
+
+inline bool operator==(const FractionLibValue& first, const FractionLibValue& second)
+{
+    return first.numerator == second.numerator && first.denominator == second.denominator;
+}
+
+/* Test the element-wise batch functions */
+
+TEST(fractionCApi, parseAndNormalize)
+{
+    EXPECT_EQ(fractionlib_get_api_version(), FRACTIONLIB_C_API_VERSION);
+
+    const char* const cStrings[]{"3/-6", "0.25", "-7", "1/0", "abc", nullptr, "99999999999", "5/10xyz"};
+    const size_t cLengths[]{4, 4, 2, 3, 3, 0, 11, 4};
+    const size_t cCount{std::size(cStrings)};
+
+    std::vector<FractionLibValue> results(cCount);
+    std::vector<int32_t> statuses(cCount);
+
+    EXPECT_EQ(fractionlib_parse_batch(cStrings, cLengths, cCount, results.data(), statuses.data()), 4u);
+    EXPECT_EQ(results, (std::vector<FractionLibValue>{{-1, 2}, {1, 4}, {-7, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {1, 2}}));
+    EXPECT_EQ(statuses, (std::vector<int32_t>{FRACTIONLIB_STATUS_OK, FRACTIONLIB_STATUS_OK, FRACTIONLIB_STATUS_OK, FRACTIONLIB_STATUS_DIVISION_BY_ZERO,
+                                              FRACTIONLIB_STATUS_INVALID_FORMAT, FRACTIONLIB_STATUS_NULL_POINTER, FRACTIONLIB_STATUS_ARITHMETIC_OVERFLOW,
+                                              FRACTIONLIB_STATUS_OK}));
+
+    // null terminated strings, no statuses
+    EXPECT_EQ(fractionlib_parse_batch(cStrings, nullptr, cCount, results.data(), nullptr), 5u);
+    EXPECT_EQ(results.back(), (FractionLibValue{0, 1}));
+
+    // in place
+    std::vector<FractionLibValue> values{{4, -8}, {0, -3}, {INT_MIN, 2}, {INT_MIN, -1}, {3, 0}};
+
+    EXPECT_EQ(fractionlib_normalize_batch(values.data(), values.size(), values.data(), statuses.data()), 2u);
+    EXPECT_EQ(values, (std::vector<FractionLibValue>{{-1, 2}, {0, 1}, {INT_MIN / 2, 1}, {0, 1}, {0, 1}}));
+    EXPECT_EQ(statuses[3], FRACTIONLIB_STATUS_ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(statuses[4], FRACTIONLIB_STATUS_DIVISION_BY_ZERO);
+
+    EXPECT_EQ(fractionlib_normalize_batch(nullptr, 3, values.data(), statuses.data()), 3u);
+    EXPECT_EQ(statuses[2], FRACTIONLIB_STATUS_NULL_POINTER);
+    EXPECT_EQ(fractionlib_normalize_batch(nullptr, 0, nullptr, nullptr), 0u);
+}
+
+TEST(fractionCApi, arithmetic)
+{
+    const std::vector<FractionLibValue> cFirst{{1, 2}, {2, -3}, {INT_MAX, 1}, {1, 0}, {5, 7}};
+    const std::vector<FractionLibValue> cSecond{{1, 3}, {3, 4}, {INT_MAX, 1}, {1, 2}, {0, 1}};
+    std::vector<FractionLibValue> results(cFirst.size());
+    std::vector<int32_t> statuses(cFirst.size());
+
+    EXPECT_EQ(fractionlib_add_batch(cFirst.data(), cSecond.data(), cFirst.size(), results.data(), statuses.data()), 2u);
+    EXPECT_EQ(results, (std::vector<FractionLibValue>{{5, 6}, {1, 12}, {0, 1}, {0, 1}, {5, 7}}));
+    EXPECT_EQ(statuses[2], FRACTIONLIB_STATUS_ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(statuses[3], FRACTIONLIB_STATUS_DIVISION_BY_ZERO);
+
+    EXPECT_EQ(fractionlib_subtract_batch(cFirst.data(), cSecond.data(), cFirst.size(), results.data(), statuses.data()), 1u);
+    EXPECT_EQ(results, (std::vector<FractionLibValue>{{1, 6}, {-17, 12}, {0, 1}, {0, 1}, {5, 7}}));
+
+    EXPECT_EQ(fractionlib_multiply_batch(cFirst.data(), cSecond.data(), cFirst.size(), results.data(), statuses.data()), 2u);
+    EXPECT_EQ(results, (std::vector<FractionLibValue>{{1, 6}, {-1, 2}, {0, 1}, {0, 1}, {0, 1}}));
+    EXPECT_EQ(statuses[4], FRACTIONLIB_STATUS_OK);
+
+    EXPECT_EQ(fractionlib_divide_batch(cFirst.data(), cSecond.data(), cFirst.size(), results.data(), statuses.data()), 2u);
+    EXPECT_EQ(results, (std::vector<FractionLibValue>{{3, 2}, {-8, 9}, {1, 1}, {0, 1}, {0, 1}}));
+    EXPECT_EQ(statuses[4], FRACTIONLIB_STATUS_DIVISION_BY_ZERO);
+
+    std::vector<int32_t> comparisons(cFirst.size());
+
+    EXPECT_EQ(fractionlib_compare_batch(cFirst.data(), cSecond.data(), cFirst.size(), comparisons.data(), statuses.data()), 1u);
+    EXPECT_EQ(comparisons, (std::vector<int32_t>{1, -1, 0, 0, 1}));
+    EXPECT_EQ(statuses[3], FRACTIONLIB_STATUS_DIVISION_BY_ZERO);
+}
+
+/* Test the sorting and the formatting */
+
+TEST(fractionCApi, sort)
+{
+    std::mt19937 generator{47};
+    std::uniform_int_distribution<int> termDistribution{INT_MIN + 1, INT_MAX};
+    std::vector<FractionLibValue> values(10000);
+
+    for (FractionLibValue& value : values)
+    {
+        value = FractionLibValue{termDistribution(generator), termDistribution(generator)};
+    }
+
+    values[10] = FractionLibValue{1, 0};
+    values[20] = FractionLibValue{-5, 0};
+
+    std::vector<int32_t> statuses(values.size());
+
+    EXPECT_EQ(fractionlib_sort(values.data(), values.size(), statuses.data()), 2u);
+
+    for (size_t index{1}; index + 2 < values.size(); ++index)
+    {
+        // the exact order of the products, the decimal values of close fractions may be equal
+        ASSERT_LE(static_cast<long long>(values[index - 1].numerator) * values[index].denominator,
+                  static_cast<long long>(values[index].numerator) * values[index - 1].denominator);
+        ASSERT_GT(values[index].denominator, 0);
+        ASSERT_EQ(statuses[index], FRACTIONLIB_STATUS_OK);
+    }
+
+    EXPECT_EQ(statuses[values.size() - 2], FRACTIONLIB_STATUS_DIVISION_BY_ZERO);
+    EXPECT_EQ(statuses.back(), FRACTIONLIB_STATUS_DIVISION_BY_ZERO);
+    EXPECT_EQ(values.back(), (FractionLibValue{0, 1}));
+}
+
+TEST(fractionCApi, format)
+{
+    const std::vector<FractionLibValue> cValues{{6, -8}, {INT_MIN, 2147483647}, {0, 5}, {1, 0}, {7, 1}};
+    std::vector<char> buffer(cValues.size() * FRACTIONLIB_FORMAT_SLOT_SIZE, 'x');
+    std::vector<int32_t> statuses(cValues.size());
+
+    EXPECT_EQ(fractionlib_format_batch(cValues.data(), cValues.size(), buffer.data(), statuses.data()), 1u);
+
+    std::vector<std::string> strings;
+
+    for (size_t index{0}; index < cValues.size(); ++index)
+    {
+        strings.emplace_back(buffer.data() + index * FRACTIONLIB_FORMAT_SLOT_SIZE);
+    }
+
+    EXPECT_EQ(strings, (std::vector<std::string>{"-3/4", "-2147483648/2147483647", "0/1", "", "7/1"}));
+    EXPECT_EQ(statuses[3], FRACTIONLIB_STATUS_DIVISION_BY_ZERO);
+}
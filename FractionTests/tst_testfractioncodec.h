@@ -0,0 +1,181 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <random>
+#include <limits>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractioncodec.h"
+
+using namespace testing;
+
+/* Test the compressed fraction stream: round trips for each coding mode, seeking, parallel decoding and corrupted input */
+
+TEST(fractionCodec, roundTrip)
+{
+    std::mt19937 generator{50};
+    std::uniform_int_distribution<int> numeratorDistribution{std::numeric_limits<int>::min() + 1, std::numeric_limits<int>::max()};
+    std::uniform_int_distribution<int> denominatorDistribution{1, std::numeric_limits<int>::max()};
+    std::uniform_int_distribution<int> smallDistribution{-60, 60};
+    std::vector<Fraction> fractions;
+
+    // large terms (multi byte varints) mixed with runs of small ones (one byte varints, decoded 16 at a time)
+    for (size_t index{0}; index < 5000; ++index)
+    {
+        fractions.push_back(index % 100 < 50 ? Fraction{numeratorDistribution(generator), denominatorDistribution(generator)}
+                                             : Fraction{smallDistribution(generator)});
+    }
+
+    fractions.push_back(Fraction{std::numeric_limits<int>::max(), std::numeric_limits<int>::max() - 1});
+    fractions.push_back(Fraction{std::numeric_limits<int>::min() + 1, std::numeric_limits<int>::max()});
+
+    FractionScheduler serialScheduler{1};
+    FractionScheduler scheduler{4};
+
+    for (const size_t cBlockSize : {size_t{1}, size_t{7}, size_t{64}, size_t{4096}})
+    {
+        const std::string cEncoded{encodeFractions(fractions, cBlockSize)};
+        const FractionDecoder cDecoder{cEncoded};
+
+        EXPECT_EQ(cDecoder.getFractionsCount(), fractions.size());
+        EXPECT_EQ(cDecoder.getBlocksCount(), (fractions.size() + cBlockSize - 1) / cBlockSize);
+        EXPECT_TRUE(std::ranges::equal(cDecoder.decode(serialScheduler), fractions));
+        EXPECT_TRUE(std::ranges::equal(cDecoder.decode(scheduler), fractions));
+    }
+
+    EXPECT_TRUE(decodeFractions(encodeFractions({})).empty());
+    EXPECT_EQ(encodeFractions({}).size(), 5u);
+    EXPECT_THROW(encodeFractions(fractions, 0), std::runtime_error);
+    EXPECT_THROW(encodeFractions(fractions, size_t{1} << 32), std::runtime_error);
+}
+
+TEST(fractionCodec, codingModes)
+{
+    std::vector<Fraction> sortedFractions;
+    std::vector<Fraction> repeatedDenominators;
+    std::vector<Fraction> fewDenominators;
+    std::vector<Fraction> distinctDenominators;
+
+    for (int index{0}; index < 4096; ++index)
+    {
+        sortedFractions.push_back(Fraction{1000000 + 2 * index + 1, 2});
+        repeatedDenominators.push_back(Fraction{1, 1000003 + index / 512});
+        fewDenominators.push_back(Fraction{1, 1000003 + index * 7 % 200});
+        distinctDenominators.push_back(Fraction{1, 1000003 + index});
+    }
+
+    const std::string cSorted{encodeFractions(sortedFractions)};
+    const std::string cRepeated{encodeFractions(repeatedDenominators)};
+    const std::string cFew{encodeFractions(fewDenominators)};
+    const std::string cDistinct{encodeFractions(distinctDenominators)};
+
+    // deltas and one run: about a byte per fraction, runs: a byte per numerator, dictionary: an index byte per fraction
+    EXPECT_LT(cSorted.size(), 4200u);
+    EXPECT_LT(cRepeated.size(), 4200u);
+    EXPECT_LT(cFew.size(), 9000u);
+    EXPECT_GT(cDistinct.size(), 4096u * 4);
+
+    EXPECT_TRUE(std::ranges::equal(decodeFractions(cSorted), sortedFractions));
+    EXPECT_TRUE(std::ranges::equal(decodeFractions(cRepeated), repeatedDenominators));
+    EXPECT_TRUE(std::ranges::equal(decodeFractions(cFew), fewDenominators));
+    EXPECT_TRUE(std::ranges::equal(decodeFractions(cDistinct), distinctDenominators));
+}
+
+TEST(fractionCodec, seek)
+{
+    std::vector<Fraction> fractions;
+
+    for (int index{0}; index < 1000; ++index)
+    {
+        fractions.push_back(Fraction{index * 37 - 5000, index % 11 + 1});
+    }
+
+    std::ostringstream encodedStream;
+    FractionEncoder encoder{encodedStream, 64};
+
+    encoder.write(std::span<const Fraction>{fractions}.first(500));
+
+    for (size_t index{500}; index < fractions.size(); ++index)
+    {
+        encoder.write(fractions[index]);
+    }
+
+    EXPECT_EQ(encoder.getFractionsCount(), fractions.size());
+    encoder.finish();
+    EXPECT_THROW(encoder.write(Fraction{1}), std::runtime_error);
+
+    const std::string cEncoded{encodedStream.str()};
+    EXPECT_EQ(encoder.getBytesCount(), cEncoded.size());
+
+    const FractionDecoder cDecoder{cEncoded};
+
+    EXPECT_EQ(cDecoder.get(0), fractions[0]);
+    EXPECT_EQ(cDecoder.get(63), fractions[63]);
+    EXPECT_EQ(cDecoder.get(64), fractions[64]);
+    EXPECT_EQ(cDecoder.get(999), fractions[999]);
+
+    for (const auto& [cFirst, cCount] : {std::pair<size_t, size_t>{0, 1000}, {10, 20}, {60, 200}, {128, 64}, {990, 10}, {1000, 0}})
+    {
+        std::vector<Fraction> range(cCount);
+        cDecoder.decode(cFirst, range);
+
+        EXPECT_TRUE(std::ranges::equal(range, std::span<const Fraction>{fractions}.subspan(cFirst, cCount)));
+    }
+
+    std::vector<Fraction> range(2);
+
+    EXPECT_THROW(cDecoder.get(1000), std::runtime_error);
+    EXPECT_THROW(cDecoder.decode(999, range), std::runtime_error);
+
+    std::pmr::monotonic_buffer_resource memoryResource;
+    FractionScheduler scheduler{2};
+    const FractionArray cDecoded{cDecoder.decode(scheduler, &memoryResource)};
+
+    EXPECT_EQ(cDecoded.get_allocator().resource(), &memoryResource);
+    EXPECT_TRUE(std::ranges::equal(cDecoded, fractions));
+}
+
+TEST(fractionCodec, invalidStream)
+{
+    std::vector<Fraction> fractions;
+
+    for (int index{0}; index < 300; ++index)
+    {
+        fractions.push_back(Fraction{index, 7});
+    }
+
+    const std::string cEncoded{encodeFractions(fractions, 100)};
+
+    EXPECT_THROW(FractionDecoder{""}, std::runtime_error);
+    EXPECT_THROW(FractionDecoder{"FRCZ"}, std::runtime_error);
+    EXPECT_THROW(FractionDecoder{std::string{"FRCX"} + cEncoded.substr(4)}, std::runtime_error);
+    EXPECT_THROW(FractionDecoder{cEncoded.substr(0, cEncoded.size() - 1)}, std::runtime_error);
+    EXPECT_THROW(FractionDecoder{cEncoded + '\0'}, std::runtime_error);
+
+    // a corrupted payload is detected when its block is decoded
+    std::string corrupted{cEncoded};
+    corrupted[corrupted.size() - 3] = static_cast<char>(0x80);
+
+    const FractionDecoder cDecoder{corrupted};
+
+    EXPECT_EQ(cDecoder.get(0), Fraction{0});
+    EXPECT_THROW(cDecoder.get(299), std::runtime_error);
+    FractionScheduler scheduler{3};
+    EXPECT_THROW(cDecoder.decode(scheduler), std::runtime_error);
+
+    // 0 denominator
+    const std::string cZeroDenominator{std::string{"FRCZ\x01\x04\x00\x00\x00\x01\x00\x02\x00", 13}};
+    EXPECT_THROW(decodeFractions(cZeroDenominator), std::runtime_error);
+    EXPECT_EQ(decodeFractions(std::string{"FRCZ\x01\x04\x00\x00\x00\x01\x00\x03\x03", 13}), (FractionArray{Fraction{-2, 3}}));
+
+    // 2/4 (not reduced), more fractions than payload bytes, a numerator delta overflowing 64 bits
+    EXPECT_THROW(decodeFractions(std::string{"FRCZ\x01\x04\x00\x00\x00\x01\x00\x04\x04", 13}), std::runtime_error);
+    EXPECT_THROW(FractionDecoder{std::string_view("FRCZ\x01\x0b\x00\x00\x00\xff\xff\xff\xff\xff\xff\xff\x0f\x00\x02\x02", 20)}, std::runtime_error);
+    EXPECT_THROW(decodeFractions(std::string{"FRCZ\x01\x0f\x00\x00\x00\x02\x01\x02\xfe\xff\xff\xff\xff\xff\xff\xff\xff\x01\x01\x01", 24}),
+                 std::runtime_error);
+}
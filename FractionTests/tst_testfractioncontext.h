@@ -0,0 +1,117 @@
+#pragma once
+
+#include <limits>
+#include <thread>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractioncontext.h"
+#include "../FractionLib/fractionbatch.h"
+
+
+using namespace testing;
+
+/* Test the sticky flags of the scalar operations */
+
+TEST(fractionContext, exactResults)
+{
+    FractionContext context;
+
+    EXPECT_EQ(context.add(Fraction{1, 2}, Fraction{1, 3}), Fraction(5, 6));
+    EXPECT_EQ(context.subtract(Fraction{1, 2}, Fraction{1, 3}), Fraction(1, 6));
+    EXPECT_EQ(context.multiply(Fraction{2000000000, 3}, Fraction{3, 2000000000}), Fraction(1));
+    EXPECT_EQ(context.divide(Fraction{2, 3}, Fraction{4, 9}), Fraction(3, 2));
+    EXPECT_EQ(context.inverse(Fraction{-2, 7}), Fraction(-7, 2));
+    EXPECT_EQ(context.make(6, -8), Fraction(-3, 4));
+    EXPECT_EQ(context.parse("3/9"), Fraction(1, 3));
+    EXPECT_FALSE(context.hasRaisedFlags());
+}
+
+TEST(fractionContext, overflow)
+{
+    const int cMaxInt{std::numeric_limits<int>::max()};
+    FractionContext context;
+
+    // 4000000000 / 3 = [1333333333; 3], the last convergent that fits is 1333333333
+    EXPECT_EQ(context.add(Fraction{2000000000, 3}, Fraction{2000000000, 3}), Fraction(1333333333));
+    EXPECT_TRUE(context.isRaised(FractionError::ARITHMETIC_OVERFLOW));
+    EXPECT_FALSE(context.isRaised(FractionError::DIVISION_BY_ZERO));
+
+    // the magnitudes out of range are saturated
+    EXPECT_EQ(context.multiply(Fraction{2000000000}, Fraction{2}), Fraction(cMaxInt));
+    EXPECT_EQ(context.multiply(Fraction{-2000000000}, Fraction{2}), Fraction(-cMaxInt));
+    EXPECT_EQ(context.make(std::numeric_limits<int>::min(), -1), Fraction(cMaxInt));
+
+    // results with huge terms keep as much precision as the int terms allow: 1 / (1999999999 * 1999999997) underflows to 0
+    // and x^2 / (x^2 - 1) = [1; x^2 - 1] (x = 1999999999) becomes 1
+    EXPECT_EQ(context.multiply(Fraction{1, 1999999999}, Fraction{1, 1999999997}), Fraction(0));
+    EXPECT_EQ(context.divide(Fraction{1999999999, 2000000000}, Fraction{1999999998, 1999999999}), Fraction(1));
+}
+
+TEST(fractionContext, divisionByZeroAndParsing)
+{
+    FractionContext context;
+
+    EXPECT_EQ(context.divide(Fraction{1, 2}, Fraction{}), Fraction(0));
+    EXPECT_EQ(context.inverse(Fraction{}), Fraction(0));
+    EXPECT_EQ(context.make(1, 0), Fraction(0));
+    EXPECT_EQ(context.getFlags(), FractionContext::getFlag(FractionError::DIVISION_BY_ZERO));
+
+    // the flags are sticky
+    EXPECT_EQ(context.add(Fraction{1}, Fraction{1}), Fraction(2));
+    EXPECT_TRUE(context.isRaised(FractionError::DIVISION_BY_ZERO));
+
+    EXPECT_EQ(context.parse("1/x"), Fraction(0));
+    EXPECT_TRUE(context.isRaised(FractionError::INVALID_FORMAT));
+
+    context.clear();
+    EXPECT_FALSE(context.hasRaisedFlags());
+}
+
+TEST(fractionContext, threadContexts)
+{
+    FractionContext::getThreadContext().clear();
+
+    std::thread thread{[]()
+    {
+        (void)FractionContext::getThreadContext().divide(Fraction{1}, Fraction{});
+        EXPECT_TRUE(FractionContext::getThreadContext().isRaised(FractionError::DIVISION_BY_ZERO));
+    }};
+
+    thread.join();
+    EXPECT_FALSE(FractionContext::getThreadContext().hasRaisedFlags());
+}
+
+/* Test the sticky flags of the batch operations */
+
+TEST(fractionContext, batchOperations)
+{
+    const std::vector<Fraction> cFirst{Fraction{1, 2}, Fraction{2000000000}, Fraction{3}};
+    const std::vector<Fraction> cSecond{Fraction{1, 3}, Fraction{2000000000}, Fraction{}};
+    std::vector<Fraction> results(cFirst.size());
+    FractionContext context;
+
+    addFractions(cFirst, cSecond, results, context);
+    EXPECT_EQ(results, (std::vector<Fraction>{Fraction{5, 6}, Fraction{std::numeric_limits<int>::max()}, Fraction{3}}));
+    EXPECT_EQ(context.getFlags(), FractionContext::getFlag(FractionError::ARITHMETIC_OVERFLOW));
+
+    context.clear();
+    divideFractions(cFirst, cSecond, results, context);
+    EXPECT_EQ(results, (std::vector<Fraction>{Fraction{3, 2}, Fraction{1}, Fraction{0}}));
+    EXPECT_EQ(context.getFlags(), FractionContext::getFlag(FractionError::DIVISION_BY_ZERO));
+
+    multiplyFractions(cFirst, cFirst, results, context);
+    subtractFractions(cFirst, cSecond, results, context);
+    EXPECT_EQ(results, (std::vector<Fraction>{Fraction{1, 6}, Fraction{0}, Fraction{3}}));
+    EXPECT_TRUE(context.isRaised(FractionError::ARITHMETIC_OVERFLOW));
+
+    const std::vector<std::string> cStrings{"1/2", "x", "0.25"};
+
+    context.clear();
+    parseFractions(cStrings, results, context);
+    EXPECT_EQ(results, (std::vector<Fraction>{Fraction{1, 2}, Fraction{0}, Fraction{1, 4}}));
+    EXPECT_EQ(context.getFlags(), FractionContext::getFlag(FractionError::INVALID_FORMAT));
+
+    EXPECT_THROW(addFractions(cFirst, cSecond, std::span<Fraction>{results.data(), 2}, context), std::runtime_error);
+}
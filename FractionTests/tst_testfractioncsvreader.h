@@ -0,0 +1,184 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <random>
+#include <fstream>
+#include <stdexcept>
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractioncsvreader.h"
+
+using namespace testing;
+
+/* Test the parsing of the cells */
+
+TEST(fractionCsvReader, read)
+{
+    const std::string cText{"price,\"weight, kg\",ratio\r\n"
+                            "1/2,0.25,-3\r\n"
+                            "\"7/-14\",\"1.5\",+4/6\r\n"
+                            "10,-2.125,0/5"};
+
+    const FractionCsvTable cTable{FractionCsvReader{}.read(cText)};
+
+    EXPECT_EQ(cTable.getColumnNames(), (std::vector<std::string>{"price", "weight, kg", "ratio"}));
+    EXPECT_EQ(cTable.getRowsCount(), 3u);
+    EXPECT_EQ(cTable.getColumnsCount(), 3u);
+    EXPECT_EQ(cTable.getColumn("price"), (FractionArray{Fraction{1, 2}, Fraction{-1, 2}, Fraction{10}}));
+    EXPECT_EQ(cTable.getColumn(1), (FractionArray{Fraction{1, 4}, Fraction{3, 2}, Fraction{-17, 8}}));
+    EXPECT_EQ(cTable.getColumn("ratio"), (FractionArray{Fraction{-3}, Fraction{2, 3}, Fraction{0}}));
+    EXPECT_TRUE(cTable.getErrors().empty());
+    EXPECT_EQ(cTable.getBytesCount(), cText.size());
+    EXPECT_THROW(cTable.getColumn("size"), std::runtime_error);
+    EXPECT_THROW(cTable.getColumn(3), std::runtime_error);
+
+    // other delimiter, no header, final line break
+    const FractionCsvTable cNoHeader{FractionCsvReader{';', false}.read("1;2,5\n\"3;\"\"\";4\n")};
+
+    EXPECT_TRUE(cNoHeader.getColumnNames().empty());
+    EXPECT_EQ(cNoHeader.getRowsCount(), 2u);
+    EXPECT_EQ(cNoHeader.getColumn(0), (FractionArray{Fraction{1}, Fraction{0}}));
+    ASSERT_EQ(cNoHeader.getErrors().size(), 2u);
+    EXPECT_EQ(cNoHeader.getErrors()[0].text, "2,5");
+    EXPECT_EQ(cNoHeader.getErrors()[1].text, "3;\"");
+
+    EXPECT_EQ(FractionCsvReader{}.read("").getColumnsCount(), 0u);
+    EXPECT_EQ(FractionCsvReader{}.read("a,b\n").getRowsCount(), 0u);
+    EXPECT_THROW(FractionCsvReader{'"'}, std::runtime_error);
+}
+
+TEST(fractionCsvReader, cellErrors)
+{
+    const std::string cText{"a,b,c\n"
+                            "1,x,3\n"
+                            "4/0,5\n"
+                            "99999999999,1/2,7,8,9\n"
+                            "\"1\"2,,1.5\n"};
+
+    const FractionCsvTable cTable{FractionCsvReader{}.read(cText)};
+    const std::vector<FractionCsvCellError>& cErrors{cTable.getErrors()};
+
+    ASSERT_EQ(cErrors.size(), 6u);
+
+    const std::vector<std::pair<size_t, size_t>> cExpectedCells{{0, 1}, {1, 0}, {1, 2}, {2, 0}, {2, 3}, {3, 1}};
+
+    for (size_t index{0}; index < cErrors.size(); ++index)
+    {
+        EXPECT_EQ(cErrors[index].row, cExpectedCells[index].first);
+        EXPECT_EQ(cErrors[index].column, cExpectedCells[index].second);
+    }
+
+    EXPECT_EQ(cErrors[0].error, FractionError::INVALID_FORMAT);
+    EXPECT_EQ(cErrors[0].text, "x");
+    EXPECT_EQ(cErrors[1].error, FractionError::DIVISION_BY_ZERO);
+    EXPECT_TRUE(cErrors[2].text.empty());
+    EXPECT_EQ(cErrors[3].error, FractionError::ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(cErrors[4].text, "8");
+
+    // the bad cells are 0, the other cells of their rows are kept (the characters following a closing quote belong to the cell)
+    EXPECT_EQ(cTable.getColumn("a"), (FractionArray{Fraction{1}, Fraction{0}, Fraction{0}, Fraction{12}}));
+    EXPECT_EQ(cTable.getColumn("b"), (FractionArray{Fraction{0}, Fraction{5}, Fraction{1, 2}, Fraction{0}}));
+    EXPECT_EQ(cTable.getColumn("c"), (FractionArray{Fraction{3}, Fraction{0}, Fraction{7}, Fraction{3, 2}}));
+}
+
+/* Test the chunked parallel parsing */
+
+TEST(fractionCsvReader, chunks)
+{
+    std::mt19937 generator{46};
+    std::uniform_int_distribution<int> numeratorDistribution{-1000, 1000};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 100};
+    std::uniform_int_distribution<int> formatDistribution{0, 5};
+
+    std::vector<FractionArray> expectedColumns(3);
+    std::string text{"first,\"second\nline\",third\n"};
+    size_t expectedErrorsCount{0};
+
+    for (int row{0}; row < 2000; ++row)
+    {
+        for (size_t column{0}; column < expectedColumns.size(); ++column)
+        {
+            const Fraction cValue{numeratorDistribution(generator), denominatorDistribution(generator)};
+            const int cFormat{formatDistribution(generator)};
+
+            // fractions, integers and decimals, some of them quoted (with delimiters and line breaks in quoted invalid cells)
+            switch (cFormat)
+            {
+            case 0:
+                text += "\"" + std::to_string(cValue.getNumerator()) + "/" + std::to_string(cValue.getDenominator()) + "\"";
+                expectedColumns[column].push_back(cValue);
+                break;
+            case 1:
+                text += std::to_string(cValue.getNumerator());
+                expectedColumns[column].push_back(Fraction{cValue.getNumerator()});
+                break;
+            case 2:
+                text += std::to_string(cValue.getNumerator()) + ".25";
+                expectedColumns[column].push_back(Fraction{cValue.getNumerator() * 4 + (cValue.getNumerator() < 0 ? -1 : 1), 4});
+                break;
+            case 3:
+                text += "\"bad,\n\"\"cell\"\"\"";
+                expectedColumns[column].push_back(Fraction{0});
+                ++expectedErrorsCount;
+                break;
+            default:
+                text += std::to_string(cValue.getNumerator()) + "/" + std::to_string(cValue.getDenominator());
+                expectedColumns[column].push_back(cValue);
+                break;
+            }
+
+            text += column + 1 < expectedColumns.size() ? "," : "\n";
+        }
+    }
+
+    for (size_t chunkSize : {1u, 7u, 64u, 1000u, 1u << 20})
+    {
+        for (size_t threadsCount : {1u, 4u})
+        {
+            FractionScheduler scheduler{threadsCount};
+            FractionCsvReader reader{',', true, scheduler};
+
+            reader.setChunkSize(chunkSize);
+
+            const FractionCsvTable cTable{reader.read(text)};
+
+            ASSERT_EQ(cTable.getColumnNames(), (std::vector<std::string>{"first", "second\nline", "third"}));
+            ASSERT_EQ(cTable.getRowsCount(), 2000u);
+
+            for (size_t column{0}; column < expectedColumns.size(); ++column)
+            {
+                ASSERT_EQ(cTable.getColumn(column), expectedColumns[column]);
+            }
+
+            ASSERT_EQ(cTable.getErrors().size(), expectedErrorsCount);
+
+            for (const FractionCsvCellError& error : cTable.getErrors())
+            {
+                ASSERT_EQ(error.text, "bad,\n\"cell\"");
+            }
+        }
+    }
+}
+
+TEST(fractionCsvReader, readFile)
+{
+    const std::filesystem::path cFilePath{std::filesystem::temp_directory_path() / "fractioncsvreadertest.csv"};
+
+    {
+        std::ofstream file{cFilePath, std::ios::binary};
+        file << "x\ty\n1/3\t0.5\n-2\t7/8\n";
+    }
+
+    const FractionCsvTable cTable{FractionCsvReader{'\t'}.readFile(cFilePath.string())};
+
+    EXPECT_EQ(cTable.getColumn("x"), (FractionArray{Fraction{1, 3}, Fraction{-2}}));
+    EXPECT_EQ(cTable.getColumn("y"), (FractionArray{Fraction{1, 2}, Fraction{7, 8}}));
+    EXPECT_GE(cTable.getMegabytesPerSecond(), 0.0);
+
+    std::filesystem::remove(cFilePath);
+
+    EXPECT_THROW(FractionCsvReader{}.readFile(cFilePath.string()), std::runtime_error);
+}
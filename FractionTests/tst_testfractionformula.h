@@ -0,0 +1,114 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractionformula.h"
+
+
+using namespace testing;
+
+/* Test the formula compilation */
+
+TEST(fractionFormula, compilation)
+{
+    const FractionFormula cFormula{"1/2 + 3/4 * (x - 0.25)"};
+
+    EXPECT_EQ(cFormula.getVariableNames(), (std::vector<std::string>{"x"}));
+
+    // 1/2 and 3/4 are folded, the remaining instructions are: 1/2, 3/4, x, 1/4, -, *, +
+    EXPECT_EQ(cFormula.getInstructionsCount(), 7u);
+    EXPECT_EQ(FractionFormula{"(1 + 2/3) * 6 - 2^-2"}.getInstructionsCount(), 1u);
+    EXPECT_EQ(FractionFormula{"rate * base_2 + rate"}.getVariableNames(), (std::vector<std::string>{"rate", "base_2"}));
+    EXPECT_EQ(FractionFormula("y - x", {"x", "y", "z"}).getVariablesCount(), 3u);
+
+    EXPECT_THROW(FractionFormula{"1 +"}, std::runtime_error);
+    EXPECT_THROW(FractionFormula{"(x + 1"}, std::runtime_error);
+    EXPECT_THROW(FractionFormula{"x ^ y"}, std::runtime_error);
+    EXPECT_THROW(FractionFormula{"x ^ 1.5"}, std::runtime_error);
+    EXPECT_THROW(FractionFormula{"1.2.3 * x"}, std::runtime_error);
+    EXPECT_THROW(FractionFormula{"x # 2"}, std::runtime_error);
+    EXPECT_THROW(FractionFormula("x + w", {"x", "y"}), std::runtime_error);
+}
+
+/* Test the evaluation */
+
+TEST(fractionFormula, evaluation)
+{
+    FractionContext context;
+    const FractionFormula cFormula{"1/2 + 3/4 * (x - 0.25)"};
+    const std::vector<Fraction> cVariables{Fraction{5, 4}};
+
+    EXPECT_EQ(cFormula.evaluate(cVariables, context), Fraction(5, 4));
+    EXPECT_EQ(FractionFormula("-x^2 + 2*x*y - y^(-1)", {"x", "y"}).evaluate(std::vector<Fraction>{Fraction{3}, Fraction{1, 2}}, context), Fraction(-8));
+    EXPECT_EQ(FractionFormula("--x - +y", {"x", "y"}).evaluate(std::vector<Fraction>{Fraction{3}, Fraction{1, 2}}, context), Fraction(5, 2));
+    EXPECT_EQ(FractionFormula{"x / y / z"}.evaluate(std::vector<Fraction>{Fraction{1}, Fraction{2}, Fraction{3}}, context), Fraction(1, 6));
+    EXPECT_EQ(FractionFormula{"x - y - z"}.evaluate(std::vector<Fraction>{Fraction{1}, Fraction{2}, Fraction{3}}, context), Fraction(-4));
+    EXPECT_EQ(FractionFormula{"x^0 + x^3"}.evaluate(std::vector<Fraction>{Fraction{-2, 3}}, context), Fraction(19, 27));
+    EXPECT_FALSE(context.hasRaisedFlags());
+
+    EXPECT_THROW(cFormula.evaluate(std::vector<Fraction>{}, context), std::runtime_error);
+}
+
+TEST(fractionFormula, evaluationErrors)
+{
+    FractionContext context;
+
+    // the constant division by zero is not folded, so each evaluation raises the flag
+    const FractionFormula cFormula{"x + 1/0"};
+
+    EXPECT_EQ(cFormula.getInstructionsCount(), 5u);
+    EXPECT_EQ(cFormula.evaluate(std::vector<Fraction>{Fraction{2}}, context), Fraction(2));
+    EXPECT_TRUE(context.isRaised(FractionError::DIVISION_BY_ZERO));
+
+    context.clear();
+    EXPECT_EQ(FractionFormula{"x^-1"}.evaluate(std::vector<Fraction>{Fraction{0}}, context), Fraction(0));
+    EXPECT_TRUE(context.isRaised(FractionError::DIVISION_BY_ZERO));
+
+    context.clear();
+    EXPECT_EQ(FractionFormula{"x^3"}.evaluate(std::vector<Fraction>{Fraction{2000}}, context), Fraction(2147483647));
+    EXPECT_TRUE(context.isRaised(FractionError::ARITHMETIC_OVERFLOW));
+}
+
+TEST(fractionFormula, rowsEvaluation)
+{
+    const FractionFormula cFormula{"a * b - 1/3"};
+    const size_t cRowsCount{5000};
+    std::vector<Fraction> rows;
+    std::vector<Fraction> results(cRowsCount);
+
+    for (size_t row{0}; row < cRowsCount; ++row)
+    {
+        rows.push_back(Fraction{static_cast<int>(row), 2});
+        rows.push_back(Fraction{2, 3});
+    }
+
+    // the last row divides by zero
+    rows.back() = Fraction{};
+
+    FractionScheduler scheduler{3};
+    FractionContext context;
+    cFormula.evaluateRows(rows, results, scheduler, context);
+
+    for (size_t row{0}; row + 1 < cRowsCount; ++row)
+    {
+        EXPECT_EQ(results[row], Fraction(static_cast<int>(row) - 1, 3));
+    }
+
+    EXPECT_EQ(results.back(), Fraction(-1, 3));
+    EXPECT_FALSE(context.hasRaisedFlags());
+
+    // a small batch is evaluated by the calling thread
+    std::vector<Fraction> smallResults(10);
+    cFormula.evaluateRows(std::span<const Fraction>{rows}.first(20), smallResults, scheduler, context);
+
+    EXPECT_EQ(smallResults.back(), Fraction(8, 3));
+    EXPECT_FALSE(context.hasRaisedFlags());
+
+    EXPECT_THROW(cFormula.evaluateRows(rows, std::span<Fraction>{results.data(), 10}, scheduler, context), std::runtime_error);
+
+    FractionFormula{"a / b"}.evaluateRows(rows, results, FractionScheduler::getDefaultScheduler(), context);
+    EXPECT_TRUE(context.isRaised(FractionError::DIVISION_BY_ZERO));
+}
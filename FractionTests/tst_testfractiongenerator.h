@@ -0,0 +1,92 @@
+#pragma once
+
+#include <vector>
+#include <sstream>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractiongenerator.h"
+
+
+using namespace testing;
+
+/* Test the stream reading */
+
+TEST(fractionGenerator, readFractions)
+{
+    std::istringstream inputStream{"1/2\n-3/6\r\n\n0.25\nabc\n7\n5/0\n"};
+    FractionContext context;
+    std::vector<Fraction> fractions;
+
+    for (const Fraction& fraction : readFractions(inputStream, context))
+    {
+        fractions.push_back(fraction);
+    }
+
+    EXPECT_EQ(fractions, (std::vector<Fraction>{Fraction{1, 2}, Fraction{-1, 2}, Fraction{1, 4}, Fraction{7}}));
+    EXPECT_TRUE(context.isRaised(FractionError::INVALID_FORMAT));
+    EXPECT_TRUE(context.isRaised(FractionError::DIVISION_BY_ZERO));
+
+    std::istringstream emptyStream;
+    Generator<Fraction> generator{readFractions(emptyStream, context)};
+
+    EXPECT_TRUE(generator.begin() == generator.end());
+}
+
+/* Test the pipeline stages */
+
+TEST(fractionGenerator, pipelines)
+{
+    std::istringstream inputStream{"1/2\n1/3\n-1/4\n1/5\n-1/6\n1/7\n"};
+    FractionContext context;
+
+    // the stages get function pointers (+lambda), the GCC coroutine frames of a header should not store types without linkage
+    Generator<Fraction> positiveFractions{filter(readFractions(inputStream, context), +[](const Fraction& fraction) {return fraction.getNumerator() > 0;})};
+    Generator<int> denominators{transform(std::move(positiveFractions), +[](const Fraction& fraction) {return fraction.getDenominator();})};
+    std::vector<std::vector<int>> windows;
+
+    for (std::span<const int> denominatorsWindow : window(std::move(denominators), 2))
+    {
+        windows.emplace_back(denominatorsWindow.begin(), denominatorsWindow.end());
+    }
+
+    EXPECT_EQ(windows, (std::vector<std::vector<int>>{{2, 3}, {3, 5}, {5, 7}}));
+    EXPECT_FALSE(context.hasRaisedFlags());
+
+    inputStream.clear();
+    inputStream.str("1/2\n1/3\n1/6\n");
+
+    const Fraction cSum{reduce(readFractions(inputStream, context), Fraction{}, [](Fraction sum, const Fraction& fraction) {return sum + fraction;})};
+
+    EXPECT_EQ(cSum, Fraction(1));
+}
+
+TEST(fractionGenerator, slidingWindows)
+{
+    const auto cCountFrom{[](int start, int count) -> Generator<int>
+    {
+        for (int value{start}; value < start + count; ++value)
+        {
+            co_yield value;
+        }
+    }};
+
+    // the buffer is compacted several times, the sums of the windows of 3 consecutive values are 3 * (middle value)
+    int windowsCount{0};
+
+    for (std::span<const int> valuesWindow : window(cCountFrom(0, 100), 3))
+    {
+        EXPECT_EQ(valuesWindow[0] + valuesWindow[1] + valuesWindow[2], 3 * (windowsCount + 1));
+        ++windowsCount;
+    }
+
+    EXPECT_EQ(windowsCount, 98);
+    EXPECT_EQ(reduce(window(cCountFrom(0, 2), 3), 0, [](int count, std::span<const int>) {return count + 1;}), 0);
+    EXPECT_EQ(reduce(window(cCountFrom(0, 5), 0), 0, [](int count, std::span<const int>) {return count + 1;}), 0);
+    EXPECT_EQ(reduce(window(cCountFrom(0, 5), 1), 0, [](int sum, std::span<const int> valuesWindow) {return sum + valuesWindow[0];}), 10);
+
+    // the exceptions of the stages reach the consumer
+    EXPECT_THROW(reduce(transform(cCountFrom(0, 5), +[](int value) -> int {return 3 == value ? throw std::runtime_error{"Error! Invalid value"} : value;}), 0,
+                        [](int sum, int value) {return sum + value;}), std::runtime_error);
+}
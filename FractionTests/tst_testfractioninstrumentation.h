@@ -0,0 +1,118 @@
+#pragma once
+
+#include <thread>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractioninstrumentation.h"
+#include "../FractionLib/checkedfraction.h"
+
+
+using namespace testing;
+
+/* Test the recorded events (the library must be built with FRACTIONLIB_INSTRUMENTATION) */
+
+TEST(fractionInstrumentation, recordedEvents)
+{
+    if (!FractionInstrumentation::isEnabled())
+    {
+        GTEST_SKIP() << "instrumentation disabled";
+    }
+
+    FractionInstrumentation::reset();
+
+    const Fraction cReduced{6, 8};
+    const Fraction cIrreducible{3, 7};
+
+    EXPECT_THROW(Fraction{"1/x"}, std::runtime_error);
+    EXPECT_THROW(CheckedFraction(std::numeric_limits<long long>::max()) * CheckedFraction{2}, std::overflow_error);
+
+    // the events of finished threads are kept
+    std::thread thread{[]() {(void)(Fraction{1 << 20, 3} * Fraction{1 << 10, 5});}};
+    thread.join();
+
+    const FractionInstrumentation::Snapshot cSnapshot{FractionInstrumentation::getSnapshot()};
+
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::NORMALIZE_CALLS), 5u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::NORMALIZE_REDUCTIONS), 1u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::GCD_CALLS), 5u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::PARSE_CALLS), 1u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::PARSE_FAILURES), 1u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::NEAR_OVERFLOWS), 1u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::CHECKED_OVERFLOWS), 1u);
+    EXPECT_EQ(cSnapshot.getHistogram(FractionInstrumentation::Histogram::GCD_ITERATIONS).getCount(), 5u);
+    EXPECT_EQ(cSnapshot.getHistogram(FractionInstrumentation::Histogram::INTERMEDIATE_TERMS).getCount(), 1u);
+
+    // the 2^30 numerator of the product has a bit width of 31
+    EXPECT_EQ(cSnapshot.getHistogram(FractionInstrumentation::Histogram::INTERMEDIATE_TERMS).buckets[31], 1u);
+
+    FractionInstrumentation::reset();
+    EXPECT_EQ(FractionInstrumentation::getSnapshot().getCounter(FractionInstrumentation::Counter::NORMALIZE_CALLS), 0u);
+}
+
+TEST(fractionInstrumentation, arithmeticPaths)
+{
+    if (!FractionInstrumentation::isEnabled())
+    {
+        GTEST_SKIP() << "instrumentation disabled";
+    }
+
+    Fraction half{1, 2};
+    Fraction twoThirds{2, 3};
+    const Fraction cThird{1, 3};
+    const Fraction cFiveHalves{5, 2};
+
+    FractionInstrumentation::reset();
+
+    (void)(half + Fraction{3});
+    (void)(half - cFiveHalves);
+    (void)(half * Fraction{});
+    (void)(half / Fraction{-1});
+    (void)(half / Fraction{4});
+    (void)(half + cThird);
+    twoThirds *= Fraction{3, 5};
+
+    const FractionInstrumentation::Snapshot cSnapshot{FractionInstrumentation::getSnapshot()};
+
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::INTEGER_OPERAND_HITS), 2u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::SAME_DENOMINATOR_HITS), 1u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::ZERO_OPERAND_HITS), 1u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::UNIT_OPERAND_HITS), 1u);
+    EXPECT_EQ(cSnapshot.getCounter(FractionInstrumentation::Counter::GENERAL_ARITHMETIC_PATHS), 2u);
+}
+
+TEST(fractionInstrumentation, disabledInstrumentation)
+{
+    if (FractionInstrumentation::isEnabled())
+    {
+        GTEST_SKIP() << "instrumentation enabled";
+    }
+
+    const Fraction cReduced{6, 8};
+
+    EXPECT_EQ(FractionInstrumentation::getSnapshot().getCounter(FractionInstrumentation::Counter::NORMALIZE_CALLS), 0u);
+    EXPECT_EQ(FractionInstrumentation::getSnapshot().getHistogram(FractionInstrumentation::Histogram::GCD_ITERATIONS).getCount(), 0u);
+}
+
+/* Test the export formats */
+
+TEST(fractionInstrumentation, exportFormats)
+{
+    FractionInstrumentation::Snapshot snapshot;
+    snapshot.counters[static_cast<size_t>(FractionInstrumentation::Counter::PARSE_FAILURES)] = 3;
+    snapshot.histograms[static_cast<size_t>(FractionInstrumentation::Histogram::GCD_ITERATIONS)].buckets[2] = 4;
+    snapshot.histograms[static_cast<size_t>(FractionInstrumentation::Histogram::GCD_ITERATIONS)].sum = 10;
+
+    const std::string cJson{snapshot.toJson()};
+    const std::string cPrometheusText{snapshot.toPrometheusText()};
+
+    EXPECT_NE(cJson.find("\"parse_failures\":3"), std::string::npos);
+    EXPECT_NE(cJson.find("\"gcd_iterations\":{\"count\":4,\"sum\":10,\"buckets\":[0,0,4,0"), std::string::npos);
+    EXPECT_NE(cPrometheusText.find("# TYPE fractionlib_parse_failures_total counter\nfractionlib_parse_failures_total 3\n"), std::string::npos);
+    EXPECT_NE(cPrometheusText.find("fractionlib_gcd_iterations_bucket{le=\"1\"} 0\n"), std::string::npos);
+    EXPECT_NE(cPrometheusText.find("fractionlib_gcd_iterations_bucket{le=\"3\"} 4\n"), std::string::npos);
+    EXPECT_NE(cPrometheusText.find("fractionlib_gcd_iterations_bucket{le=\"+Inf\"} 4\nfractionlib_gcd_iterations_sum 10\nfractionlib_gcd_iterations_count 4\n"),
+              std::string::npos);
+    EXPECT_EQ(FractionInstrumentation::getCounterName(FractionInstrumentation::Counter::NORMALIZE_REDUCTIONS), std::string{"normalize_reductions"});
+}
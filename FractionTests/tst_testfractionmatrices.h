@@ -0,0 +1,190 @@
+#pragma once
+
+#include <limits>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractionmatrix.h"
+
+
+using namespace testing;
+
+/* Test the matrix layout */
+
+TEST(fractionMatrices, elementAccess)
+{
+    // sizes not multiple of the block size exercise the padded edge blocks
+    FractionMatrix matrix{37, 21};
+
+    for (size_t row{0}; row < matrix.getRowsCount(); ++row)
+    {
+        for (size_t column{0}; column < matrix.getColumnsCount(); ++column)
+        {
+            matrix(row, column) = Fraction{static_cast<int>(row), static_cast<int>(column + 1)};
+        }
+    }
+
+    EXPECT_EQ(matrix(36, 20), Fraction(36, 21));
+    EXPECT_EQ(matrix.at(16, 15), Fraction(1));
+    EXPECT_EQ(matrix.at(0, 0), Fraction(0));
+    EXPECT_THROW(matrix.at(37, 0), std::runtime_error);
+    EXPECT_THROW(matrix.at(0, 21), std::runtime_error);
+    EXPECT_THROW((FractionMatrix{{Fraction{1}, Fraction{2}}, {Fraction{3}}}), std::runtime_error);
+}
+
+/* Test the fraction-free elimination */
+
+TEST(fractionMatrices, determinant)
+{
+    const FractionMatrix cMatrix{{Fraction{1, 2}, Fraction{1, 3}, Fraction{1, 4}},
+                                 {Fraction{1, 3}, Fraction{1, 4}, Fraction{1, 5}},
+                                 {Fraction{1, 4}, Fraction{1, 5}, Fraction{1, 6}}};
+    const FractionMatrix cSingularMatrix{{Fraction{1}, Fraction{2}}, {Fraction{-1, 2}, Fraction{-1}}};
+    const FractionMatrix cSwapMatrix{{Fraction{0}, Fraction{1}}, {Fraction{1}, Fraction{0}}};
+
+    EXPECT_EQ(cMatrix.getDeterminant(), WideFraction(Fraction{1, 43200}));
+    EXPECT_EQ(cSingularMatrix.getDeterminant(), WideFraction{});
+    EXPECT_EQ(cSwapMatrix.getDeterminant(), WideFraction(Fraction{-1}));
+    EXPECT_EQ(FractionMatrix{}.getDeterminant(), WideFraction(Fraction{1}));
+    EXPECT_THROW(FractionMatrix(2, 3).getDeterminant(), std::runtime_error);
+}
+
+TEST(fractionMatrices, determinantExceedingIntRange)
+{
+    // the determinant of the 12x12 Hilbert matrix has a denominator that doesn't fit into an int
+    const size_t cSize{12};
+    FractionMatrix hilbertMatrix{cSize, cSize};
+
+    for (size_t row{0}; row < cSize; ++row)
+    {
+        for (size_t column{0}; column < cSize; ++column)
+        {
+            hilbertMatrix(row, column) = Fraction{1, static_cast<int>(row + column + 1)};
+        }
+    }
+
+    const WideFraction cDeterminant{hilbertMatrix.getDeterminant()};
+
+    EXPECT_EQ(cDeterminant.getNumerator(), WideInteger{1});
+    EXPECT_EQ(cDeterminant.getDenominator().toString(), "379106579436304517151885479034796391880188687864118464104324304732160000000000");
+    EXPECT_EQ(hilbertMatrix.getInverse()(11, 11).toString(), "11445589052352/1");
+}
+
+TEST(fractionMatrices, rank)
+{
+    const FractionMatrix cMatrix{{Fraction{1}, Fraction{2}, Fraction{3}},
+                                 {Fraction{2}, Fraction{4}, Fraction{6}},
+                                 {Fraction{0}, Fraction{1, 2}, Fraction{1}}};
+    const FractionMatrix cWideMatrix{{Fraction{0}, Fraction{0}, Fraction{1}, Fraction{2}},
+                                     {Fraction{0}, Fraction{0}, Fraction{2}, Fraction{5}}};
+
+    EXPECT_EQ(cMatrix.getRank(), 2u);
+    EXPECT_EQ(cWideMatrix.getRank(), 2u);
+    EXPECT_EQ(FractionMatrix(3, 3).getRank(), 0u);
+    EXPECT_EQ(FractionMatrix::createIdentityMatrix(5).getRank(), 5u);
+}
+
+TEST(fractionMatrices, inverse)
+{
+    const FractionMatrix cMatrix{{Fraction{2}, Fraction{1, 2}},
+                                 {Fraction{-1, 3}, Fraction{1}}};
+    const WideFractionMatrix cInverse{cMatrix.getInverse()};
+
+    EXPECT_EQ(cInverse(0, 0), WideFraction(Fraction{6, 13}));
+    EXPECT_EQ(cInverse(0, 1), WideFraction(Fraction{-3, 13}));
+    EXPECT_EQ(cInverse(1, 0), WideFraction(Fraction{2, 13}));
+    EXPECT_EQ(cInverse(1, 1), WideFraction(Fraction{12, 13}));
+    EXPECT_THROW(FractionMatrix(2, 2).getInverse(), std::runtime_error);
+}
+
+TEST(fractionMatrices, solve)
+{
+    const FractionMatrix cMatrix{{Fraction{0}, Fraction{2}, Fraction{1}},
+                                 {Fraction{1, 2}, Fraction{-1}, Fraction{0}},
+                                 {Fraction{3}, Fraction{0}, Fraction{-1, 4}}};
+    const std::vector<WideFraction> cSolution{cMatrix.solve({Fraction{7}, Fraction{-3, 2}, Fraction{9, 4}})};
+
+    ASSERT_EQ(cSolution.size(), 3u);
+    EXPECT_EQ(cSolution[0], WideFraction(Fraction{1}));
+    EXPECT_EQ(cSolution[1], WideFraction(Fraction{2}));
+    EXPECT_EQ(cSolution[2], WideFraction(Fraction{3}));
+    EXPECT_THROW(cMatrix.solve({Fraction{1}}), std::runtime_error);
+    EXPECT_THROW(FractionMatrix(2, 2).solve({Fraction{1}, Fraction{1}}), std::runtime_error);
+}
+
+/* Test the blocked multiplication */
+
+TEST(fractionMatrices, multiply)
+{
+    const size_t cRowsCount{35};
+    const size_t cInnerCount{18};
+    const size_t cColumnsCount{20};
+
+    FractionMatrix first{cRowsCount, cInnerCount};
+    FractionMatrix second{cInnerCount, cColumnsCount};
+
+    for (size_t row{0}; row < cRowsCount; ++row)
+    {
+        for (size_t inner{0}; inner < cInnerCount; ++inner)
+        {
+            first(row, inner) = Fraction{static_cast<int>(row + inner) % 7 - 3, static_cast<int>(inner % 3) + 1};
+        }
+    }
+
+    for (size_t inner{0}; inner < cInnerCount; ++inner)
+    {
+        for (size_t column{0}; column < cColumnsCount; ++column)
+        {
+            second(inner, column) = Fraction{static_cast<int>(inner * column) % 5 - 2, 2};
+        }
+    }
+
+    FractionScheduler serialScheduler{1};
+    FractionScheduler scheduler{4};
+
+    const WideFractionMatrix cSingleThreadedProduct{first.multiply(second, serialScheduler)};
+    const WideFractionMatrix cMultiThreadedProduct{first.multiply(second, scheduler)};
+
+    ASSERT_EQ(cSingleThreadedProduct.getRowsCount(), cRowsCount);
+    ASSERT_EQ(cSingleThreadedProduct.getColumnsCount(), cColumnsCount);
+    EXPECT_EQ(cSingleThreadedProduct, cMultiThreadedProduct);
+
+    for (size_t row{0}; row < cRowsCount; ++row)
+    {
+        for (size_t column{0}; column < cColumnsCount; ++column)
+        {
+            Fraction expected{};
+
+            for (size_t inner{0}; inner < cInnerCount; ++inner)
+            {
+                Fraction leftElement{first(row, inner)};
+                expected += leftElement * second(inner, column);
+            }
+
+            EXPECT_EQ(cSingleThreadedProduct(row, column), WideFraction{expected});
+        }
+    }
+
+    const WideFractionMatrix cIdentityProduct{first * FractionMatrix::createIdentityMatrix(cInnerCount)};
+
+    for (size_t row{0}; row < cRowsCount; ++row)
+    {
+        for (size_t inner{0}; inner < cInnerCount; ++inner)
+        {
+            EXPECT_EQ(cIdentityProduct(row, inner), WideFraction{first(row, inner)});
+        }
+    }
+
+    EXPECT_THROW(first * first, std::runtime_error);
+
+    // the sums of the second column overflow the 64 bit terms
+    const int cMax{std::numeric_limits<int>::max()};
+    const FractionMatrix cLargeFirst{{Fraction{1, cMax}, Fraction{1, cMax - 1}, Fraction{1, cMax - 2}}};
+    const FractionMatrix cLargeSecond{{Fraction{1}, Fraction{cMax, 2}}, {Fraction{1}, Fraction{1, 3}}, {Fraction{1}, Fraction{-1}}};
+    const WideFractionMatrix cLargeProduct{cLargeFirst * cLargeSecond};
+
+    EXPECT_EQ(cLargeProduct(0, 0), WideFraction{Fraction(1, cMax)} + WideFraction{Fraction(1, cMax - 1)} + WideFraction{Fraction(1, cMax - 2)});
+    EXPECT_EQ(cLargeProduct(0, 1), WideFraction{Fraction(1, 2)} + WideFraction{Fraction(1, cMax - 1)} * WideFraction{Fraction(1, 3)} -
+                                   WideFraction{Fraction(1, cMax - 2)});
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <vector>
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractionmodular.h"
+
+using namespace testing;
+
+inline Fraction createModularTestFraction(std::mt19937& generator, int maxNumerator, int maxDenominator)
+{
+    std::uniform_int_distribution<int> numeratorDistribution{-maxNumerator, maxNumerator};
+    std::uniform_int_distribution<int> denominatorDistribution{1, maxDenominator};
+
+    return Fraction{numeratorDistribution(generator), denominatorDistribution(generator)};
+}
+
+/* Test the multi-modular computations against the exact wide arithmetic */
+
+TEST(fractionModular, primes)
+{
+    EXPECT_EQ(FractionModular::getPrime(0), 2147483647u);
+    EXPECT_EQ(FractionModular::getPrime(1), 2147483629u);
+    EXPECT_EQ(FractionModular::getPrime(2), 2147483587u);
+    EXPECT_GT(FractionModular::getPrime(4095), 2147000000u);
+    EXPECT_THROW(FractionModular::getPrime(4096), std::runtime_error);
+}
+
+TEST(fractionModular, dot)
+{
+    std::mt19937 generator{49};
+    std::vector<Fraction> first(300);
+    std::vector<Fraction> second(first.size());
+    WideFraction expectedResult;
+
+    for (size_t index{0}; index < first.size(); ++index)
+    {
+        first[index] = createModularTestFraction(generator, 1000000, 1000);
+        second[index] = createModularTestFraction(generator, 1000000, 1000);
+        expectedResult += WideFraction{first[index]} * WideFraction{second[index]};
+    }
+
+    FractionScheduler scheduler{4};
+    FractionModular modular{scheduler};
+
+    EXPECT_EQ(modular.dot(first, second), expectedResult);
+    EXPECT_GT(modular.getStatistics().primesCount, 10u);
+    EXPECT_GE(modular.getStatistics().roundsCount, 2u);
+    EXPECT_FALSE(modular.getStatistics().isExactFallbackUsed);
+
+    // the largest prime divides a denominator, it is skipped
+    const std::vector<Fraction> cFirst{Fraction{1, 2147483647}, Fraction{-3, 7}};
+    const std::vector<Fraction> cSecond{Fraction{2}, Fraction{5, 6}};
+
+    EXPECT_EQ(modular.dot(cFirst, cSecond), WideFraction(WideInteger{-10737418207}, WideInteger{30064771058}));
+    EXPECT_EQ(modular.getStatistics().unluckyPrimesCount, 1u);
+
+    EXPECT_EQ(modular.dot(std::vector<Fraction>{}, std::vector<Fraction>{}), WideFraction{});
+    EXPECT_THROW(modular.dot(cFirst, std::vector<Fraction>{Fraction{1}}), std::runtime_error);
+}
+
+TEST(fractionModular, solve)
+{
+    std::mt19937 generator{490};
+    const size_t cSize{12};
+    FractionMatrix matrix{cSize, cSize};
+    std::vector<Fraction> rightHandSide(cSize);
+
+    for (size_t row{0}; row < cSize; ++row)
+    {
+        for (size_t column{0}; column < cSize; ++column)
+        {
+            matrix(row, column) = createModularTestFraction(generator, 1000, 100);
+        }
+
+        rightHandSide[row] = createModularTestFraction(generator, 1000, 100);
+    }
+
+    FractionScheduler scheduler{2};
+    FractionModular modular{scheduler};
+
+    EXPECT_EQ(modular.solve(matrix, rightHandSide), matrix.solve(rightHandSide));
+    EXPECT_FALSE(modular.getStatistics().isExactFallbackUsed);
+
+    // singular: all the primes are unlucky, the exact elimination confirms it
+    const FractionMatrix cSingularMatrix{{Fraction{1, 2}, Fraction{1, 3}}, {Fraction{3, 2}, Fraction{1}}};
+
+    EXPECT_THROW(modular.solve(cSingularMatrix, {Fraction{1}, Fraction{2}}), std::runtime_error);
+    EXPECT_TRUE(modular.getStatistics().isExactFallbackUsed);
+    EXPECT_EQ(modular.getStatistics().primesCount, 0u);
+
+    EXPECT_EQ(modular.solve(FractionMatrix{{Fraction{2}, Fraction{1}}, {Fraction{1}, Fraction{3}}}, {Fraction{3}, Fraction{-1, 2}}),
+              (std::vector<WideFraction>{Fraction{19, 10}, Fraction{-4, 5}}));
+
+    EXPECT_THROW(modular.solve(FractionMatrix{2, 3}, {Fraction{1}, Fraction{2}}), std::runtime_error);
+    EXPECT_THROW(modular.solve(cSingularMatrix, {Fraction{1}}), std::runtime_error);
+}
+
+TEST(fractionModular, multiplyPolynomials)
+{
+    std::mt19937 generator{4900};
+    std::vector<WideFraction> firstCoefficients(40);
+    std::vector<WideFraction> secondCoefficients(25);
+
+    for (WideFraction& coefficient : firstCoefficients)
+    {
+        coefficient = WideFraction{createModularTestFraction(generator, 1000000, 1000000)} * WideFraction{createModularTestFraction(generator, 1000000, 1000000)};
+    }
+
+    for (WideFraction& coefficient : secondCoefficients)
+    {
+        coefficient = createModularTestFraction(generator, 1000000, 1000000);
+    }
+
+    const FractionPolynomial cFirst{firstCoefficients};
+    const FractionPolynomial cSecond{secondCoefficients};
+
+    FractionModular modular;
+    const FractionPolynomial cProduct{modular.multiply(cFirst, cSecond)};
+
+    EXPECT_EQ(cProduct.getCoefficients(), (cFirst * cSecond).getCoefficients());
+    EXPECT_EQ(cProduct.getDegree(), 63);
+
+    // (x - 1/2) * (x + 1/2) = x^2 - 1/4
+    EXPECT_EQ(modular.multiply(FractionPolynomial{Fraction{-1, 2}, Fraction{1}}, FractionPolynomial{Fraction{1, 2}, Fraction{1}}).getCoefficients(),
+              (std::vector<WideFraction>{Fraction{-1, 4}, Fraction{0}, Fraction{1}}));
+    EXPECT_TRUE(modular.multiply(cFirst, FractionPolynomial{}).isZero());
+
+    // the largest prime divides the common denominator
+    const FractionPolynomial cUnluckyFirst{Fraction{1, 2147483647}, Fraction{2, 3}};
+    const FractionPolynomial cUnluckySecond{Fraction{-5}, Fraction{0}, Fraction{7, 4}};
+
+    EXPECT_EQ(modular.multiply(cUnluckyFirst, cUnluckySecond), cUnluckyFirst * cUnluckySecond);
+    EXPECT_EQ(modular.getStatistics().unluckyPrimesCount, 1u);
+}
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include <random>
+#include <climits>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractionpolynomial.h"
+
+using namespace testing;
+
+// value computed term by term with the normalized wide arithmetic
+inline WideFraction getNaiveValue(const FractionPolynomial& polynomial, const WideFraction& point)
+{
+    WideFraction result;
+    WideFraction power{1};
+
+    for (const WideFraction& coefficient : polynomial.getCoefficients())
+    {
+        result += coefficient * power;
+        power *= point;
+    }
+
+    return result;
+}
+
+// product of (x - root) for all roots
+inline FractionPolynomial getPolynomialWithRoots(const std::vector<Fraction>& roots)
+{
+    FractionPolynomial result{Fraction{1}};
+
+    for (const Fraction& root : roots)
+    {
+        result = result * FractionPolynomial{Fraction{0} - root, Fraction{1}};
+    }
+
+    return result;
+}
+
+/* Test the polynomial arithmetic */
+
+TEST(fractionPolynomial, arithmetic)
+{
+    const FractionPolynomial cFirst{Fraction{1}, Fraction{1}};
+    const FractionPolynomial cSecond{Fraction{-1}, Fraction{1}};
+
+    EXPECT_EQ(cFirst * cSecond, (FractionPolynomial{Fraction{-1}, Fraction{0}, Fraction{1}}));
+    EXPECT_EQ(cFirst + cSecond, (FractionPolynomial{Fraction{0}, Fraction{2}}));
+    EXPECT_EQ(cFirst - cFirst, FractionPolynomial{});
+    EXPECT_EQ((cFirst - cFirst).getDegree(), -1);
+    EXPECT_EQ((FractionPolynomial{Fraction{1, 2}, Fraction{0}, Fraction{0}}).getDegree(), 0);
+
+    const FractionPolynomial cPolynomial{Fraction{1}, Fraction{-1}, Fraction{0}, Fraction{3, 2}};
+
+    EXPECT_EQ(cPolynomial.toString(), "3/2*x^3 - x + 1");
+    EXPECT_EQ((-cPolynomial).toString(), "-3/2*x^3 + x - 1");
+    EXPECT_EQ(cPolynomial.getDerivative(), (FractionPolynomial{Fraction{-1}, Fraction{0}, Fraction{9, 2}}));
+    EXPECT_EQ(FractionPolynomial{}.toString(), "0");
+    EXPECT_EQ(cPolynomial.getCoefficient(3), WideFraction(Fraction(3, 2)));
+    EXPECT_EQ(cPolynomial.getCoefficient(7), WideFraction{});
+}
+
+TEST(fractionPolynomial, divideWithRemainder)
+{
+    std::mt19937 generator{44};
+    std::uniform_int_distribution<int> numeratorDistribution{-20, 20};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 9};
+
+    for (int test{0}; test < 50; ++test)
+    {
+        std::vector<WideFraction> dividendCoefficients(7);
+        std::vector<WideFraction> divisorCoefficients(3);
+
+        for (WideFraction& coefficient : dividendCoefficients)
+        {
+            coefficient = WideFraction{Fraction{numeratorDistribution(generator), denominatorDistribution(generator)}};
+        }
+
+        for (WideFraction& coefficient : divisorCoefficients)
+        {
+            coefficient = WideFraction{Fraction{numeratorDistribution(generator), denominatorDistribution(generator)}};
+        }
+
+        divisorCoefficients.back() = WideFraction{Fraction{denominatorDistribution(generator), 5}};
+
+        const FractionPolynomial cDividend{dividendCoefficients};
+        const FractionPolynomial cDivisor{divisorCoefficients};
+        const auto [cQuotient, cRemainder]{cDividend.divideWithRemainder(cDivisor)};
+
+        EXPECT_EQ(cQuotient * cDivisor + cRemainder, cDividend);
+        EXPECT_LT(cRemainder.getDegree(), cDivisor.getDegree());
+    }
+
+    const FractionPolynomial cLinear{Fraction{1}, Fraction{1}};
+    const FractionPolynomial cQuadratic{Fraction{0}, Fraction{0}, Fraction{1}};
+
+    EXPECT_EQ(cLinear / cQuadratic, FractionPolynomial{});
+    EXPECT_EQ(cLinear % cQuadratic, cLinear);
+    EXPECT_THROW(cLinear / FractionPolynomial{}, std::runtime_error);
+}
+
+TEST(fractionPolynomial, greatestCommonDivisor)
+{
+    const FractionPolynomial cFirst{getPolynomialWithRoots({Fraction{1}, Fraction{-2}, Fraction{1, 4}}) * FractionPolynomial{Fraction{3}}};
+    const FractionPolynomial cSecond{getPolynomialWithRoots({Fraction{1}, Fraction{-2}, Fraction{-3}})};
+
+    EXPECT_EQ(FractionPolynomial::getGreatestCommonDivisor(cFirst, cSecond), (FractionPolynomial{Fraction{-2}, Fraction{1}, Fraction{1}}));
+    EXPECT_EQ(FractionPolynomial::getGreatestCommonDivisor(cFirst, FractionPolynomial{}), cFirst.getMonic());
+    EXPECT_EQ(FractionPolynomial::getGreatestCommonDivisor(cFirst, FractionPolynomial{Fraction{5}}), FractionPolynomial{Fraction{1}});
+    EXPECT_TRUE(FractionPolynomial::getGreatestCommonDivisor(FractionPolynomial{}, FractionPolynomial{}).isZero());
+}
+
+/* Test the evaluation */
+
+TEST(fractionPolynomial, evaluate)
+{
+    const FractionPolynomial cPolynomial{Fraction{-7, 3}, Fraction{1, 2}, Fraction{0}, Fraction{5, 6}, Fraction{-1, 4}};
+
+    std::mt19937 generator{440};
+    std::uniform_int_distribution<int> numeratorDistribution{-1000, 1000};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 1000};
+
+    for (int test{0}; test < 200; ++test)
+    {
+        const Fraction cPoint{numeratorDistribution(generator), denominatorDistribution(generator)};
+
+        EXPECT_EQ(cPolynomial.evaluate(cPoint), getNaiveValue(cPolynomial, WideFraction{cPoint}));
+    }
+
+    // points whose powers overflow the 64 bit terms
+    const Fraction cLargePoint{INT_MAX - 1, INT_MAX};
+    EXPECT_EQ(cPolynomial.evaluate(cLargePoint), getNaiveValue(cPolynomial, WideFraction{cLargePoint}));
+
+    // coefficients which do not fit into 64 bit terms
+    const FractionPolynomial cWide{std::vector<WideFraction>{WideFraction{Fraction{1, INT_MAX}}, WideFraction{Fraction{1, INT_MAX - 1}},
+                                                            WideFraction{Fraction{1, INT_MAX - 2}}}};
+    EXPECT_EQ(cWide.evaluate(Fraction{3, 7}), getNaiveValue(cWide, WideFraction{Fraction{3, 7}}));
+    EXPECT_EQ(FractionPolynomial{}.evaluate(Fraction{3, 7}), WideFraction{});
+}
+
+TEST(fractionPolynomial, evaluateBatch)
+{
+    const FractionPolynomial cPolynomial{Fraction{1, 2}, Fraction{-3}, Fraction{1, 3}};
+
+    std::mt19937 generator{4400};
+    std::uniform_int_distribution<int> numeratorDistribution{-100, 100};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 50};
+    std::vector<Fraction> points(5000);
+
+    for (Fraction& point : points)
+    {
+        point = Fraction{numeratorDistribution(generator), denominatorDistribution(generator)};
+    }
+
+    for (size_t threadsCount : {1u, 4u})
+    {
+        FractionScheduler scheduler{threadsCount};
+        std::vector<Fraction> results(points.size());
+        std::vector<WideFraction> wideResults(points.size());
+
+        cPolynomial.evaluate(points, results, scheduler);
+        cPolynomial.evaluate(points, wideResults, scheduler);
+
+        for (size_t index{0}; index < points.size(); ++index)
+        {
+            ASSERT_EQ(WideFraction{results[index]}, getNaiveValue(cPolynomial, WideFraction{points[index]}));
+            ASSERT_EQ(wideResults[index], getNaiveValue(cPolynomial, WideFraction{points[index]}));
+        }
+    }
+
+    // a small batch is evaluated by the calling thread
+    std::vector<WideFraction> smallResults(100);
+    cPolynomial.evaluate(std::span<const Fraction>{points}.first(100), smallResults);
+
+    EXPECT_EQ(smallResults.back(), getNaiveValue(cPolynomial, WideFraction{points[99]}));
+
+    // a value which does not fit into a Fraction
+    points[3000] = Fraction{INT_MAX};
+    std::vector<Fraction> results(points.size());
+    FractionScheduler scheduler{4};
+
+    EXPECT_THROW(cPolynomial.evaluate(points, results, scheduler), std::runtime_error);
+    EXPECT_THROW(cPolynomial.evaluate(points, std::span<Fraction>{results.data(), 10}), std::runtime_error);
+}
+
+/* Test the root isolation */
+
+// checks that each interval isolates the expected root (given by its approximate value) and that the single point intervals are roots
+inline void checkRootIntervals(const FractionPolynomial& polynomial, const std::vector<FractionPolynomial::RootInterval>& rootIntervals,
+                               const std::vector<double>& expectedRoots)
+{
+    ASSERT_EQ(rootIntervals.size(), expectedRoots.size());
+
+    for (size_t index{0}; index < rootIntervals.size(); ++index)
+    {
+        const FractionPolynomial::RootInterval& cRootInterval{rootIntervals[index]};
+
+        EXPECT_LE(cRootInterval.lower.getDecimalValue(), expectedRoots[index] + 1e-12);
+        EXPECT_GE(cRootInterval.upper.getDecimalValue(), expectedRoots[index] - 1e-12);
+
+        if (cRootInterval.lower == cRootInterval.upper)
+        {
+            EXPECT_EQ(polynomial.getSignAt(cRootInterval.lower), 0);
+        }
+        else
+        {
+            EXPECT_NE(polynomial.getSignAt(cRootInterval.lower), 0);
+            EXPECT_NE(polynomial.getSignAt(cRootInterval.upper), 0);
+            EXPECT_EQ(polynomial.countRealRoots(cRootInterval.lower, cRootInterval.upper), 1u);
+        }
+    }
+}
+
+TEST(fractionPolynomial, isolateRealRoots)
+{
+    // (x + 3) (x - 1/2) (x^2 - 2)
+    const FractionPolynomial cPolynomial{getPolynomialWithRoots({Fraction{-3}, Fraction{1, 2}}) * FractionPolynomial{Fraction{-2}, Fraction{0}, Fraction{1}}};
+    const double cSquareRoot{std::sqrt(2.0)};
+
+    checkRootIntervals(cPolynomial, cPolynomial.isolateRealRoots(), {-3.0, -cSquareRoot, 0.5, cSquareRoot});
+    EXPECT_EQ(cPolynomial.countRealRoots(WideFraction{0}, WideFraction{2}), 2u);
+    EXPECT_EQ(cPolynomial.countRealRoots(WideFraction{-3}, WideFraction{0}), 1u);
+
+    // refined intervals
+    const std::vector<FractionPolynomial::RootInterval> cRefined{cPolynomial.isolateRealRoots(WideFraction{WideInteger{1}, WideInteger{1000000}})};
+
+    checkRootIntervals(cPolynomial, cRefined, {-3.0, -cSquareRoot, 0.5, cSquareRoot});
+    EXPECT_LE((cRefined[3].upper - cRefined[3].lower).getDecimalValue(), 1e-6);
+    EXPECT_NEAR(cRefined[3].lower.getDecimalValue(), cSquareRoot, 1e-6);
+
+    // multiple roots are counted once, no real roots
+    const FractionPolynomial cMultipleRoots{getPolynomialWithRoots({Fraction{1}, Fraction{1}, Fraction{1}, Fraction{-1, 3}, Fraction{-1, 3}})};
+    checkRootIntervals(cMultipleRoots, cMultipleRoots.isolateRealRoots(), {-1.0 / 3.0, 1.0});
+    EXPECT_TRUE((FractionPolynomial{Fraction{1}, Fraction{0}, Fraction{1}}).isolateRealRoots().empty());
+    EXPECT_TRUE(FractionPolynomial{Fraction{4}}.isolateRealRoots().empty());
+    EXPECT_THROW(FractionPolynomial{}.isolateRealRoots(), std::runtime_error);
+
+    // close roots
+    std::vector<Fraction> closeRoots;
+    std::vector<double> expectedRoots;
+
+    for (int root{1}; root <= 10; ++root)
+    {
+        closeRoots.push_back(Fraction{root, 1000} + Fraction{1, 3});
+        expectedRoots.push_back(closeRoots.back().getDecimalValue());
+    }
+
+    const FractionPolynomial cCloseRoots{getPolynomialWithRoots(closeRoots)};
+    checkRootIntervals(cCloseRoots, cCloseRoots.isolateRealRoots(), expectedRoots);
+}
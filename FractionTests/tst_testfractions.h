@@ -1,5 +1,9 @@
 #pragma once
 
+#include <span>
+#include <limits>
+#include <random>
+#include <vector>
 #include <stdexcept>
 #include <sstream>
 
@@ -69,6 +73,65 @@ TEST(throwingNoExceptions, setTheDenominator)
     EXPECT_NO_THROW(fract.setDenominator(3));
 }
 
+/* Test the non-throwing API */
+
+TEST(nonThrowingApi, parsing)
+{
+    EXPECT_EQ(Fraction::tryParse("-6/8"), Fraction(-3, 4));
+    EXPECT_EQ(Fraction::tryParse("+3/-9"), Fraction(-1, 3));
+    EXPECT_EQ(Fraction::tryParse("0.29"), Fraction(29, 100));
+    EXPECT_EQ(Fraction::tryParse("-1.5"), Fraction(-3, 2));
+    EXPECT_EQ(Fraction::tryParse("1.250000000000"), Fraction(5, 4));
+    EXPECT_EQ(Fraction::tryParse("+17"), Fraction(17));
+    EXPECT_EQ(Fraction::tryParse("4294967296/8589934592"), Fraction(1, 2));
+    EXPECT_EQ(Fraction::tryParse("1/x").error(), FractionError::INVALID_FORMAT);
+    EXPECT_EQ(Fraction::tryParse(".15").error(), FractionError::INVALID_FORMAT);
+    EXPECT_EQ(Fraction::tryParse("").error(), FractionError::INVALID_FORMAT);
+    EXPECT_EQ(Fraction::tryParse("1/0").error(), FractionError::DIVISION_BY_ZERO);
+    EXPECT_EQ(Fraction::tryParse("2147483648").error(), FractionError::ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(Fraction::tryParse("99999999999999999999/3").error(), FractionError::ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(Fraction::tryParse("0.1234567890123456789").error(), FractionError::ARITHMETIC_OVERFLOW);
+
+    // views which are not null terminated, decimals with signs and long integer parts
+    EXPECT_EQ(Fraction::tryParse(std::string_view{"3/4xyz"}.substr(0, 3)), Fraction(3, 4));
+    EXPECT_EQ(Fraction::tryParse("-0.5"), Fraction(-1, 2));
+    EXPECT_EQ(Fraction::tryParse("+0.25"), Fraction(1, 4));
+    EXPECT_EQ(Fraction::tryParse("0000000000000000000001.5"), Fraction(3, 2));
+    EXPECT_EQ(Fraction::tryParse("92233720368547758.08").error(), FractionError::ARITHMETIC_OVERFLOW);
+}
+
+TEST(nonThrowingApi, construction)
+{
+    EXPECT_EQ(Fraction::tryMake(6, -8), Fraction(-3, 4));
+    EXPECT_EQ(Fraction::tryMake(std::numeric_limits<int>::min(), 2), Fraction(-1073741824, 1));
+    EXPECT_EQ(Fraction::tryMake(1, 0).error(), FractionError::DIVISION_BY_ZERO);
+    EXPECT_EQ(Fraction::tryMake(std::numeric_limits<int>::min(), -1).error(), FractionError::ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(Fraction(3, 4).tryInverse(), Fraction(4, 3));
+    EXPECT_EQ(Fraction{}.tryInverse().error(), FractionError::DIVISION_BY_ZERO);
+
+    // the throwing API reports the same errors as exceptions
+    EXPECT_THROW(Fraction(std::numeric_limits<int>::min(), -1), std::overflow_error);
+    EXPECT_THROW(Fraction{"2147483648"}, std::overflow_error);
+}
+
+TEST(nonThrowingApi, arithmetic)
+{
+    const Fraction cLarge{2000000000, 3};
+
+    EXPECT_EQ(Fraction(1, 6).tryAdd(Fraction{1, 3}), Fraction(1, 2));
+    EXPECT_EQ(Fraction(1, 6).trySubtract(Fraction{1, 3}), Fraction(-1, 6));
+    EXPECT_EQ(Fraction(2, 3).tryMultiply(Fraction{9, 4}), Fraction(3, 2));
+    EXPECT_EQ(Fraction(2, 3).tryDivide(Fraction{4, 9}), Fraction(3, 2));
+
+    // the 64 bit intermediate terms are reduced before the range check
+    EXPECT_EQ(cLarge.tryMultiply(Fraction{3, 2000000000}), Fraction(1));
+    EXPECT_EQ(cLarge.tryAdd(cLarge).error(), FractionError::ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(cLarge.trySubtract(Fraction{-2000000000, 3}).error(), FractionError::ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(cLarge.tryMultiply(Fraction{2}).error(), FractionError::ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(cLarge.tryDivide(Fraction{1, 2}).error(), FractionError::ARITHMETIC_OVERFLOW);
+    EXPECT_EQ(cLarge.tryDivide(Fraction{}).error(), FractionError::DIVISION_BY_ZERO);
+}
+
 /* Test fraction string format (fractionary / decimal / integer) */
 
 TEST(checkFractionFormat, checkStringIsDecimal)
@@ -276,6 +339,16 @@ TEST(constructors, numDenConstructor)
     EXPECT_EQ(decimal4, fract4.getDecimalValue());
 }
 
+TEST(constructors, doubleConstructor)
+{
+    // the value is rounded to 6 significant digits
+    EXPECT_EQ(Fraction{0.25}, Fraction(1, 4));
+    EXPECT_EQ(Fraction{-1.5}, Fraction(-3, 2));
+    EXPECT_EQ(Fraction{3.14159265}, Fraction(314159, 100000));
+    EXPECT_EQ(Fraction{0.0}, Fraction(0));
+    EXPECT_EQ(Fraction{-42.0}, Fraction(-42));
+}
+
 TEST(constructors, stringConstructorFractionary)
 {
     Fraction fract1{ "4/6" };
@@ -593,6 +666,145 @@ TEST(arithmeticOperators, powerEqual)
     EXPECT_EQ(fract, fractCopy);
 }
 
+TEST(arithmeticOperators, compoundChaining)
+{
+    Fraction fract{ "1/2" };
+    (fract += "1/3") *= Fraction{ 6 };
+    EXPECT_EQ(fract, Fraction(5));
+    EXPECT_EQ(((fract /= Fraction{ -10 }) ^= -2), Fraction(4));
+    EXPECT_EQ(fract.getDecimalValue(), 4.0);
+
+    // aliasing, zero results and the sign of the divisor
+    fract -= fract;
+    EXPECT_EQ(fract, Fraction(0));
+    EXPECT_EQ(fract.getDenominator(), 1);
+    fract = Fraction{ 3, 4 };
+    fract *= fract;
+    EXPECT_EQ(fract, Fraction(9, 16));
+    fract /= Fraction{ -3, 8 };
+    EXPECT_EQ(fract, Fraction(-3, 2));
+    EXPECT_EQ(fract.getDenominator(), 2);
+    fract ^= 0;
+    EXPECT_EQ(fract, Fraction(1));
+
+    Fraction zero{};
+    EXPECT_THROW(fract /= zero, std::runtime_error);
+    EXPECT_THROW(zero ^= -1, std::runtime_error);
+    EXPECT_EQ(zero ^= 3, Fraction(0));
+
+    // out of range powers throw like the non-throwing API, the minimum int divisor is handled with 64 bit terms
+    fract = Fraction{ -2, 3 };
+    EXPECT_EQ(fract ^ 19, Fraction(-524288, 1162261467));
+    EXPECT_EQ(fract ^ -19, Fraction(-1162261467, 524288));
+    EXPECT_THROW(fract ^= 20, std::overflow_error);
+    EXPECT_THROW(fract ^ 20, std::overflow_error);
+    EXPECT_THROW(Fraction(2) ^ 31, std::overflow_error);
+    EXPECT_EQ(fract, Fraction(-2, 3));
+
+    fract = Fraction{ 4 };
+    const Fraction cMinimumDivisor{ std::numeric_limits<int>::min(), 3 };
+    EXPECT_EQ(fract /= cMinimumDivisor, Fraction(-3, 536870912));
+    const Fraction cMinimumInteger{ std::numeric_limits<int>::min() };
+    EXPECT_THROW(fract /= cMinimumInteger, std::overflow_error);
+}
+
+TEST(arithmeticOperators, compoundRandomized)
+{
+    // the in-place operators give the same reduced results as the binary ones (the terms are small enough not to overflow)
+    std::mt19937 generator{41};
+    std::uniform_int_distribution<int> numeratorDistribution{-3000, 3000};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 3000};
+
+    for (size_t index{0}; index < 2000; ++index)
+    {
+        const Fraction cFirst{numeratorDistribution(generator), denominatorDistribution(generator)};
+        const Fraction cSecond{numeratorDistribution(generator), denominatorDistribution(generator)};
+        Fraction expected{cFirst};
+
+        EXPECT_EQ(Fraction{cFirst} += cSecond, expected + cSecond);
+        EXPECT_EQ(Fraction{cFirst} -= cSecond, expected - cSecond);
+        EXPECT_EQ(Fraction{cFirst} *= cSecond, expected * cSecond);
+        EXPECT_EQ((Fraction{cFirst} += cSecond).getDecimalValue(), (expected + cSecond).getDecimalValue());
+
+        if (0 != cSecond.getNumerator())
+        {
+            EXPECT_EQ(Fraction{cFirst} /= cSecond, expected / cSecond);
+        }
+
+        EXPECT_EQ(Fraction{cFirst} ^= 2, expected ^ 2);
+    }
+}
+
+TEST(arithmeticOperators, fastPathsRandomized)
+{
+    // operands of all the fast path shapes (integers, zeros, units, equal denominators, unit fractions) and general ones,
+    // the results are compared to the non-throwing API, which computes with 64 bit terms and a single reduction
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> shapeDistribution{0, 5};
+    std::uniform_int_distribution<int> termDistribution{1, 5000};
+    std::uniform_int_distribution<int> signDistribution{0, 1};
+
+    const auto cCreateOperand{[&](int commonDenominator)
+    {
+        const int cSign{0 == signDistribution(generator) ? -1 : 1};
+
+        switch (shapeDistribution(generator))
+        {
+        case 0:
+            return Fraction{cSign * termDistribution(generator)};
+        case 1:
+            return Fraction{};
+        case 2:
+            return Fraction{cSign};
+        case 3:
+            return Fraction{cSign * termDistribution(generator), commonDenominator};
+        case 4:
+            return Fraction{cSign, termDistribution(generator)};
+        default:
+            return Fraction{cSign * termDistribution(generator), termDistribution(generator)};
+        }
+    }};
+
+    const auto cExpectIdentical{[](const Fraction& result, const std::expected<Fraction, FractionError>& expected)
+    {
+        ASSERT_TRUE(expected.has_value());
+        EXPECT_EQ(result.getNumerator(), expected->getNumerator());
+        EXPECT_EQ(result.getDenominator(), expected->getDenominator());
+        EXPECT_EQ(result.getDecimalValue(), expected->getDecimalValue());
+    }};
+
+    for (size_t index{0}; index < 5000; ++index)
+    {
+        const int cCommonDenominator{termDistribution(generator)};
+        Fraction first{cCreateOperand(cCommonDenominator)};
+        const Fraction cSecond{cCreateOperand(cCommonDenominator)};
+
+        cExpectIdentical(first + cSecond, first.tryAdd(cSecond));
+        cExpectIdentical(first - cSecond, first.trySubtract(cSecond));
+        cExpectIdentical(first * cSecond, first.tryMultiply(cSecond));
+        cExpectIdentical(Fraction{first} += cSecond, first.tryAdd(cSecond));
+        cExpectIdentical(Fraction{first} -= cSecond, first.trySubtract(cSecond));
+        cExpectIdentical(Fraction{first} *= cSecond, first.tryMultiply(cSecond));
+
+        if (0 != cSecond.getNumerator())
+        {
+            cExpectIdentical(first / cSecond, first.tryDivide(cSecond));
+            cExpectIdentical(Fraction{first} /= cSecond, first.tryDivide(cSecond));
+        }
+        else
+        {
+            EXPECT_THROW(first / cSecond, std::runtime_error);
+        }
+    }
+
+    // fast path shapes with results at the int range limits
+    const int cMax{std::numeric_limits<int>::max()};
+    cExpectIdentical(Fraction{cMax - 1} + Fraction{1}, Fraction{cMax - 1}.tryAdd(Fraction{1}));
+    cExpectIdentical(Fraction{-cMax, 3} - Fraction{1, 3}, Fraction{-cMax, 3}.trySubtract(Fraction{1, 3}));
+    cExpectIdentical(Fraction{cMax, 2} * Fraction{-1}, Fraction{cMax, 2}.tryMultiply(Fraction{-1}));
+    cExpectIdentical(Fraction{1, 46341} * Fraction{46341, 2}, Fraction{1, 46341}.tryMultiply(Fraction{46341, 2}));
+}
+
 TEST(unaryOperators, plusPlus)
 {
     Fraction fract1{ "1/2" };
@@ -905,3 +1117,112 @@ TEST(IOOperators, fileStreams)
     readFromFile >> readFract;
     EXPECT_EQ(writtenFract, readFract);
 }
+
+/* Test the decimal strings */
+
+TEST(decimalStrings, toDecimalString)
+{
+    EXPECT_EQ(Fraction(1, 3).toDecimalString(5), "0.33333");
+    EXPECT_EQ(Fraction(-1, 6).toDecimalString(3), "-0.167");
+    EXPECT_EQ(Fraction(22, 7).toDecimalString(30), "3.142857142857142857142857142857");
+    EXPECT_EQ(Fraction(7, 2).toDecimalString(0), "4");
+    EXPECT_EQ(Fraction(-5).toDecimalString(2), "-5.00");
+    EXPECT_EQ(Fraction(-1, 3).toDecimalString(2), "-0.33");
+    EXPECT_EQ(Fraction(-1, 300).toDecimalString(2), "0.00");
+    EXPECT_EQ(Fraction(999999, 1000000).toDecimalString(3), "1.000");
+    EXPECT_EQ(Fraction(std::numeric_limits<int>::min(), 1).toDecimalString(1), "-2147483648.0");
+    EXPECT_EQ(Fraction(std::numeric_limits<int>::max(), 2).toDecimalString(0), "1073741824");
+
+    // the rounding modes on both sides of 0, with ties and without
+    const std::vector<Fraction::RoundingMode> cModes{Fraction::RoundingMode::TOWARD_ZERO, Fraction::RoundingMode::FLOOR, Fraction::RoundingMode::CEILING,
+                                                     Fraction::RoundingMode::HALF_AWAY_FROM_ZERO, Fraction::RoundingMode::HALF_EVEN};
+    const std::vector<std::pair<Fraction, std::vector<std::string>>> cCases{
+        {Fraction{5, 2}, {"2", "2", "3", "3", "2"}},
+        {Fraction{-5, 2}, {"-2", "-3", "-2", "-3", "-2"}},
+        {Fraction{7, 2}, {"3", "3", "4", "4", "4"}},
+        {Fraction{-27, 10}, {"-2", "-3", "-2", "-3", "-3"}},
+        {Fraction{1, 3}, {"0", "0", "1", "0", "0"}},
+        {Fraction{-1, 3}, {"0", "-1", "0", "0", "0"}}
+    };
+
+    for (const auto& [fraction, expected] : cCases)
+    {
+        for (size_t modeIndex{0}; modeIndex < cModes.size(); ++modeIndex)
+        {
+            EXPECT_EQ(fraction.toDecimalString(0, cModes[modeIndex]), expected[modeIndex]);
+        }
+    }
+
+    EXPECT_EQ(Fraction(1, 8).toDecimalString(2, Fraction::RoundingMode::HALF_EVEN), "0.12");
+    EXPECT_EQ(Fraction(3, 8).toDecimalString(2, Fraction::RoundingMode::HALF_EVEN), "0.38");
+    EXPECT_THROW(Fraction(1, 3).toDecimalString(-1), std::runtime_error);
+}
+
+TEST(decimalStrings, toDecimalStringBuffer)
+{
+    std::vector<char> buffer(Fraction::getMaxDecimalStringLength(4));
+
+    const size_t cLength{Fraction(-2, 3).toDecimalString(buffer, 4)};
+    EXPECT_EQ(std::string(buffer.data(), cLength), "-0.6667");
+
+    EXPECT_THROW(Fraction(-2, 3).toDecimalString(std::span<char>{buffer.data(), buffer.size() - 1}, 4), std::runtime_error);
+
+    // random fractions compared to the digit by digit long division (truncated)
+    std::mt19937 generator{40};
+    std::uniform_int_distribution<int> termDistribution{1, std::numeric_limits<int>::max()};
+
+    for (size_t index{0}; index < 200; ++index)
+    {
+        const int cNumerator{termDistribution(generator)};
+        const int cDenominator{termDistribution(generator)};
+        const Fraction cFraction{cNumerator, cDenominator};
+
+        std::string expected{std::to_string(cFraction.getNumerator() / cFraction.getDenominator()) + "."};
+        long long remainder{cFraction.getNumerator() % cFraction.getDenominator()};
+
+        for (size_t digitIndex{0}; digitIndex < 40; ++digitIndex)
+        {
+            remainder *= 10;
+            expected.push_back(static_cast<char>('0' + remainder / cFraction.getDenominator()));
+            remainder %= cFraction.getDenominator();
+        }
+
+        EXPECT_EQ(cFraction.toDecimalString(40, Fraction::RoundingMode::TOWARD_ZERO), expected);
+    }
+}
+
+TEST(decimalStrings, decimalExpansion)
+{
+    const Fraction::DecimalExpansion cSixth{Fraction(-1, 6).decimalExpansion()};
+
+    EXPECT_EQ(cSixth.integerPart, "-0");
+    EXPECT_EQ(cSixth.preperiod, "1");
+    EXPECT_EQ(cSixth.period, "6");
+
+    const Fraction::DecimalExpansion cSeventh{Fraction(22, 7).decimalExpansion()};
+
+    EXPECT_EQ(cSeventh.integerPart, "3");
+    EXPECT_EQ(cSeventh.preperiod, "");
+    EXPECT_EQ(cSeventh.period, "142857");
+
+    const Fraction::DecimalExpansion cTerminating{Fraction(13, 40).decimalExpansion()};
+
+    EXPECT_EQ(cTerminating.integerPart, "0");
+    EXPECT_EQ(cTerminating.preperiod, "325");
+    EXPECT_EQ(cTerminating.period, "");
+
+    // 1/96 = 1/(2^5 * 3) has 5 pre-period digits, 18/77 has the period length lcm(6, 2) of 1/7 and 1/11
+    EXPECT_EQ(Fraction(1, 96).decimalExpansion().preperiod, "01041");
+    EXPECT_EQ(Fraction(1, 96).decimalExpansion().period, "6");
+    EXPECT_EQ(Fraction(18, 77).getDecimalPeriodLength(), 6u);
+    EXPECT_EQ(Fraction(1, 97).getDecimalPeriodLength(), 96u);
+    EXPECT_EQ(Fraction(5).getDecimalPeriodLength(), 0u);
+
+    // the period repeats: the digits after the pre-period and two periods match the expansion
+    const Fraction cLarge{123457, 398920};
+    const Fraction::DecimalExpansion cLargeExpansion{cLarge.decimalExpansion()};
+    const size_t cDigits{cLargeExpansion.preperiod.size() + 2 * cLargeExpansion.period.size()};
+
+    EXPECT_EQ(cLarge.toDecimalString(static_cast<int>(cDigits), Fraction::RoundingMode::TOWARD_ZERO),
+              cLargeExpansion.integerPart + "." + cLargeExpansion.preperiod + cLargeExpansion.period + cLargeExpansion.period);
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractionbatch.h"
+
+
+using namespace testing;
+
+/* Test the work-stealing loops */
+
+TEST(fractionScheduler, parallelFor)
+{
+    FractionScheduler scheduler{4};
+    const size_t cSize{10000};
+    std::vector<std::atomic<int>> visitsCounts(cSize);
+    std::atomic<bool> isChunkTooLarge{false};
+
+    EXPECT_EQ(scheduler.getThreadsCount(), 4u);
+
+    // the elements at the start are much more expensive than the others
+    scheduler.parallelFor(cSize, [&visitsCounts, &isChunkTooLarge](size_t begin, size_t end, size_t workerIndex)
+    {
+        isChunkTooLarge = isChunkTooLarge || end - begin > 16 || workerIndex >= 4;
+
+        for (size_t index{begin}; index < end; ++index)
+        {
+            Fraction fraction{1, static_cast<int>(index) + 1};
+
+            for (size_t repetition{0}; index < 100 && repetition < 1000; ++repetition)
+            {
+                fraction = fraction.limitDenominator(static_cast<int>(repetition) + 1);
+            }
+
+            ++visitsCounts[index];
+        }
+    }, 16);
+
+    EXPECT_FALSE(isChunkTooLarge);
+    EXPECT_TRUE(std::all_of(visitsCounts.cbegin(), visitsCounts.cend(), [](const std::atomic<int>& visitsCount) {return 1 == visitsCount;}));
+
+    const FractionScheduler::Statistics cStatistics{scheduler.getStatistics()};
+
+    EXPECT_EQ(cStatistics.workers.size(), 4u);
+    EXPECT_EQ(cStatistics.getElementsCount(), cSize);
+    EXPECT_GE(cStatistics.getImbalance(), 1.0);
+
+    scheduler.resetStatistics();
+    EXPECT_EQ(scheduler.getStatistics().getElementsCount(), 0u);
+
+    // empty loops return immediately
+    scheduler.parallelFor(0, [](size_t, size_t, size_t) {throw std::runtime_error{"Error! Unexpected call"};});
+}
+
+TEST(fractionScheduler, exceptionsAndNestedLoops)
+{
+    FractionScheduler scheduler{3, FractionScheduler::ThreadAffinity::PINNED};
+    std::atomic<size_t> processedCount{0};
+
+    EXPECT_THROW(scheduler.parallelFor(1000, [&processedCount](size_t begin, size_t end, size_t)
+    {
+        if (begin <= 500 && 500 < end)
+        {
+            throw std::runtime_error{"Error! Failed chunk"};
+        }
+
+        processedCount += end - begin;
+    }, 10), std::runtime_error);
+
+    EXPECT_LT(processedCount, 1000u);
+
+    // the scheduler is still usable, the nested loops run on the calling worker and get its index
+    processedCount = 0;
+    std::atomic<bool> isWorkerIndexChanged{false};
+
+    scheduler.parallelFor(10, [&scheduler, &processedCount, &isWorkerIndexChanged](size_t begin, size_t end, size_t workerIndex)
+    {
+        for (size_t index{begin}; index < end; ++index)
+        {
+            scheduler.parallelFor(100, [&processedCount, &isWorkerIndexChanged, workerIndex](size_t nestedBegin, size_t nestedEnd, size_t nestedWorkerIndex)
+            {
+                isWorkerIndexChanged = isWorkerIndexChanged || nestedWorkerIndex != workerIndex;
+                processedCount += nestedEnd - nestedBegin;
+            });
+        }
+    }, 1);
+
+    EXPECT_EQ(processedCount, 1000u);
+    EXPECT_FALSE(isWorkerIndexChanged);
+}
+
+TEST(fractionScheduler, idleWorkers)
+{
+    FractionScheduler scheduler{4};
+    std::atomic<size_t> processedCount{0};
+
+    // while a single element sleeps, the other workers wait instead of spinning (the process uses almost no CPU time)
+    const std::clock_t cStartTime{std::clock()};
+
+    scheduler.parallelFor(4, [&processedCount](size_t begin, size_t end, size_t)
+    {
+        if (0 == begin)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{300});
+        }
+
+        processedCount += end - begin;
+    }, 1);
+
+    const double cCpuMilliseconds{1000.0 * static_cast<double>(std::clock() - cStartTime) / CLOCKS_PER_SEC};
+
+    EXPECT_EQ(processedCount, 4u);
+    EXPECT_LT(cCpuMilliseconds, 150.0);
+}
+
+/* Test the parallel batch operations */
+
+TEST(fractionScheduler, batchOperations)
+{
+    FractionScheduler scheduler{4};
+    const size_t cSize{3000};
+    std::vector<Fraction> fractions;
+    std::vector<Fraction> results(cSize);
+
+    for (size_t index{0}; index < cSize; ++index)
+    {
+        fractions.push_back(Fraction{1, static_cast<int>(index % 7) + 1});
+    }
+
+    mapFractions(fractions, results, [](const Fraction& fraction) {return fraction.inverse();}, scheduler);
+
+    for (size_t index{0}; index < cSize; ++index)
+    {
+        EXPECT_EQ(results[index], Fraction(static_cast<int>(index % 7) + 1));
+    }
+
+    EXPECT_EQ(reduceFractions(results, Fraction{}, [](Fraction first, const Fraction& second) {return first + second;}, scheduler), Fraction(11994));
+    EXPECT_EQ(reduceFractions(std::span<const Fraction>{}, Fraction{1}, [](Fraction first, const Fraction& second) {return first * second;}, scheduler), Fraction(1));
+    EXPECT_THROW(mapFractions(fractions, std::span<Fraction>{results.data(), 2}, [](const Fraction& fraction) {return fraction;}, scheduler), std::runtime_error);
+
+    std::vector<std::string> fractionStrings(cSize, "2/4");
+    FractionContext context;
+
+    fractionStrings[1234] = "1/0";
+    parseFractions(fractionStrings, results, scheduler, context);
+
+    EXPECT_EQ(results[0], Fraction(1, 2));
+    EXPECT_EQ(results[1234], Fraction(0));
+    EXPECT_EQ(results[cSize - 1], Fraction(1, 2));
+    EXPECT_TRUE(context.isRaised(FractionError::DIVISION_BY_ZERO));
+    EXPECT_FALSE(context.isRaised(FractionError::INVALID_FORMAT));
+}
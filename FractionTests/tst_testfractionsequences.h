@@ -0,0 +1,161 @@
+#pragma once
+
+#include <vector>
+#include <numeric>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractionsequences.h"
+#include "../FractionLib/fractioninstrumentation.h"
+
+
+using namespace testing;
+
+static_assert(std::forward_iterator<FareySequence::Iterator>);
+static_assert(std::forward_iterator<SternBrocotSequence::Iterator>);
+
+// reduced fractions with denominators up to the order within [lower, upper] obtained by trying all the terms
+inline std::vector<Fraction> getBruteForceFareySequence(int order, int lowerNumerator, int lowerDenominator, int upperNumerator, int upperDenominator)
+{
+    std::vector<Fraction> result;
+
+    for (int denominator{1}; denominator <= order; ++denominator)
+    {
+        for (int numerator{lowerNumerator * denominator / lowerDenominator - 1}; numerator <= upperNumerator * denominator / upperDenominator + 1; ++numerator)
+        {
+            const bool cIsInRange{numerator * lowerDenominator >= lowerNumerator * denominator && numerator * upperDenominator <= upperNumerator * denominator};
+
+            if (cIsInRange && 1 == std::gcd(numerator, denominator))
+            {
+                result.push_back(Fraction{numerator, denominator});
+            }
+        }
+    }
+
+    std::sort(result.begin(), result.end());
+
+    return result;
+}
+
+/* Test the Farey sequence elements */
+
+TEST(fractionSequences, fareySequence)
+{
+    const FareySequence cSequence{5};
+    const std::vector<Fraction> cElements{cSequence.begin(), cSequence.end()};
+    const std::vector<Fraction> cExpected{{0, 1}, {1, 5}, {1, 4}, {1, 3}, {2, 5}, {1, 2}, {3, 5}, {2, 3}, {3, 4}, {4, 5}, {1, 1}};
+
+    EXPECT_EQ(cElements, cExpected);
+    EXPECT_EQ(std::vector<Fraction>(FareySequence{1}.begin(), FareySequence{1}.end()), (std::vector<Fraction>{Fraction{0}, Fraction{1}}));
+
+    // |F(n)| = 1 + phi(1) + ... + phi(n), e.g. 1 + 31 elements for n = 10 (counted by a standard algorithm)
+    const FareySequence cTenthOrder{10};
+    EXPECT_EQ(std::distance(cTenthOrder.begin(), cTenthOrder.end()), 33);
+    EXPECT_EQ(std::count_if(cTenthOrder.begin(), cTenthOrder.end(), [](const Fraction& fraction) {return 10 == fraction.getDenominator();}), 4);
+
+    const std::vector<Fraction> cBruteForce{getBruteForceFareySequence(37, 0, 1, 1, 1)};
+    const FareySequence cLargerOrder{37};
+
+    EXPECT_TRUE(std::equal(cLargerOrder.begin(), cLargerOrder.end(), cBruteForce.begin(), cBruteForce.end()));
+    EXPECT_THROW(FareySequence{0}, std::runtime_error);
+}
+
+TEST(fractionSequences, fareySequenceRange)
+{
+    // bounds which are elements and bounds which are not (the closest elements inside the range are used)
+    const FareySequence cElementBounds{7, Fraction{1, 3}, Fraction{1, 2}};
+    const std::vector<Fraction> cExpected{{1, 3}, {2, 5}, {3, 7}, {1, 2}};
+
+    EXPECT_EQ(std::vector<Fraction>(cElementBounds.begin(), cElementBounds.end()), cExpected);
+
+    const FareySequence cOtherBounds{7, Fraction{7, 22}, Fraction{11, 21}};
+    EXPECT_EQ(std::vector<Fraction>(cOtherBounds.begin(), cOtherBounds.end()), cExpected);
+
+    // negative values and values larger than 1
+    const std::vector<Fraction> cBruteForce{getBruteForceFareySequence(13, -7, 3, 5, 2)};
+    const FareySequence cWideRange{13, Fraction{-7, 3}, Fraction{5, 2}};
+
+    EXPECT_TRUE(std::equal(cWideRange.begin(), cWideRange.end(), cBruteForce.begin(), cBruteForce.end()));
+
+    // ranges without elements
+    EXPECT_TRUE(FareySequence(3, Fraction{2, 5}, Fraction{3, 7}).isEmpty());
+    EXPECT_TRUE(FareySequence(3, Fraction{1, 2}, Fraction{1, 3}).isEmpty());
+    EXPECT_EQ(FareySequence(3, Fraction{2, 5}, Fraction{3, 7}).begin(), FareySequence(3, Fraction{2, 5}, Fraction{3, 7}).end());
+
+    EXPECT_THROW(FareySequence(1 << 20, Fraction{0}, Fraction{1 << 12}), std::runtime_error);
+}
+
+TEST(fractionSequences, fareySequenceChunks)
+{
+    const FareySequence cSequence{50, Fraction{-1, 2}, Fraction{3, 2}};
+    const std::vector<Fraction> cExpected{cSequence.begin(), cSequence.end()};
+
+    for (size_t chunksCount : {1u, 2u, 7u, 64u, 5000u})
+    {
+        const std::vector<FareySequence> cChunks{cSequence.split(chunksCount)};
+        std::vector<Fraction> concatenated;
+
+        EXPECT_EQ(cChunks.size(), chunksCount);
+
+        for (const FareySequence& chunk : cChunks)
+        {
+            std::copy(chunk.begin(), chunk.end(), std::back_inserter(concatenated));
+        }
+
+        EXPECT_EQ(concatenated, cExpected);
+    }
+}
+
+/* Test the Stern-Brocot tree nodes */
+
+TEST(fractionSequences, sternBrocotSequence)
+{
+    const SternBrocotSequence cSequence{3};
+    const std::vector<Fraction> cExpected{{1, 3}, {1, 2}, {2, 3}, {1, 1}, {3, 2}, {2, 1}, {3, 1}};
+
+    EXPECT_EQ(std::vector<Fraction>(cSequence.begin(), cSequence.end()), cExpected);
+
+    // 2^depth - 1 nodes, increasing and reduced
+    const SternBrocotSequence cDeeper{12};
+    const std::vector<Fraction> cNodes{cDeeper.begin(), cDeeper.end()};
+
+    EXPECT_EQ(cNodes.size(), 4095u);
+    EXPECT_TRUE(std::is_sorted(cNodes.begin(), cNodes.end()));
+    EXPECT_EQ(std::adjacent_find(cNodes.begin(), cNodes.end()), cNodes.end());
+
+    // range restriction
+    const SternBrocotSequence cRange{4, Fraction{1, 2}, Fraction{3, 2}};
+    const std::vector<Fraction> cExpectedRange{{1, 2}, {3, 5}, {2, 3}, {3, 4}, {1, 1}, {4, 3}, {3, 2}};
+
+    EXPECT_EQ(std::vector<Fraction>(cRange.begin(), cRange.end()), cExpectedRange);
+    EXPECT_EQ(SternBrocotSequence{0}.begin(), SternBrocotSequence{0}.end());
+
+    // the deepest nodes still fit into int
+    const SternBrocotSequence cDeepest{45, Fraction{1836311903, 1134903170}, Fraction{1836311903, 1134903170}};
+    EXPECT_EQ(std::distance(cDeepest.begin(), cDeepest.end()), 1);
+
+    EXPECT_THROW(SternBrocotSequence{46}, std::runtime_error);
+}
+
+/* Test that no GCD is computed (the library must be built with FRACTIONLIB_INSTRUMENTATION) */
+
+TEST(fractionSequences, noGreatestCommonDivisor)
+{
+    if (!FractionInstrumentation::isEnabled())
+    {
+        GTEST_SKIP() << "instrumentation disabled";
+    }
+
+    const FareySequence cFarey{100};
+    const SternBrocotSequence cSternBrocot{10};
+
+    FractionInstrumentation::reset();
+
+    EXPECT_EQ(std::count_if(cFarey.begin(), cFarey.end(), [](const Fraction& fraction) {return fraction.getDenominator() > 0;}), 3045);
+    EXPECT_EQ(std::distance(cSternBrocot.begin(), cSternBrocot.end()), 1023);
+
+    EXPECT_EQ(FractionInstrumentation::getSnapshot().getCounter(FractionInstrumentation::Counter::GCD_CALLS), 0u);
+}
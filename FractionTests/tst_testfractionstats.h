@@ -0,0 +1,299 @@
+#pragma once
+
+#include <vector>
+#include <random>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/fractionstats.h"
+
+using namespace testing;
+
+// mean and population variance computed with two passes over the values
+inline std::pair<WideFraction, WideFraction> getTwoPassesMoments(const std::vector<Fraction>& values)
+{
+    const WideFraction cCount{WideInteger{static_cast<long long>(values.size())}};
+    WideFraction sum;
+
+    for (const Fraction& value : values)
+    {
+        sum += WideFraction{value};
+    }
+
+    const WideFraction cMean{sum / cCount};
+    WideFraction squaredDeviationsSum;
+
+    for (const Fraction& value : values)
+    {
+        squaredDeviationsSum += (WideFraction{value} - cMean) * (WideFraction{value} - cMean);
+    }
+
+    return {cMean, squaredDeviationsSum / cCount};
+}
+
+/* Test the exact moments */
+
+TEST(fractionStats, moments)
+{
+    FractionStats stats;
+
+    EXPECT_THROW(stats.getMean(), std::runtime_error);
+    EXPECT_THROW(stats.getMin(), std::runtime_error);
+
+    for (const Fraction& value : {Fraction{1, 2}, Fraction{-1, 3}, Fraction{5, 6}, Fraction{2}})
+    {
+        stats.add(value);
+    }
+
+    EXPECT_EQ(stats.getCount(), 4u);
+    EXPECT_EQ(stats.getSum(), WideFraction(Fraction(3)));
+    EXPECT_EQ(stats.getMean(), WideFraction(Fraction(3, 4)));
+    EXPECT_EQ(stats.getVariance(), WideFraction(Fraction(101, 144)));
+    EXPECT_EQ(stats.getSampleVariance(), WideFraction(Fraction(101, 108)));
+    EXPECT_EQ(stats.getMin(), Fraction(-1, 3));
+    EXPECT_EQ(stats.getMax(), Fraction(2));
+    EXPECT_FALSE(stats.isWide());
+
+    stats.reset();
+    stats.add(Fraction{7, 3});
+
+    EXPECT_EQ(stats.getVariance(), WideFraction{});
+    EXPECT_THROW(stats.getSampleVariance(), std::runtime_error);
+}
+
+TEST(fractionStats, momentsRandomized)
+{
+    std::mt19937 generator{43};
+    std::uniform_int_distribution<int> numeratorDistribution{-1000, 1000};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 30};
+    std::vector<Fraction> values;
+    FractionStats stats;
+
+    for (size_t index{0}; index < 500; ++index)
+    {
+        values.emplace_back(numeratorDistribution(generator), denominatorDistribution(generator));
+        stats.add(values.back());
+    }
+
+    const auto [cMean, cVariance]{getTwoPassesMoments(values)};
+
+    EXPECT_EQ(stats.getMean(), cMean);
+    EXPECT_EQ(stats.getVariance(), cVariance);
+    EXPECT_EQ(stats.getMin(), *std::min_element(values.begin(), values.end()));
+    EXPECT_EQ(stats.getMax(), *std::max_element(values.begin(), values.end()));
+}
+
+TEST(fractionStats, merge)
+{
+    std::mt19937 generator{4300};
+    std::uniform_int_distribution<int> numeratorDistribution{-50, 50};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 8};
+    std::vector<Fraction> values;
+    std::vector<FractionStats> partialStats(5);
+    FractionStats sequentialStats;
+
+    for (size_t index{0}; index < 300; ++index)
+    {
+        values.emplace_back(numeratorDistribution(generator), denominatorDistribution(generator));
+        sequentialStats.add(values.back());
+
+        // unequal partitions, one of them empty
+        partialStats[index % 7 % 4].add(values.back());
+    }
+
+    FractionStats mergedStats;
+
+    for (const FractionStats& stats : partialStats)
+    {
+        mergedStats.merge(stats);
+    }
+
+    EXPECT_EQ(mergedStats.getCount(), sequentialStats.getCount());
+    EXPECT_EQ(mergedStats.getSum(), sequentialStats.getSum());
+    EXPECT_EQ(mergedStats.getMean(), sequentialStats.getMean());
+    EXPECT_EQ(mergedStats.getVariance(), sequentialStats.getVariance());
+    EXPECT_EQ(mergedStats.getMin(), sequentialStats.getMin());
+    EXPECT_EQ(mergedStats.getMax(), sequentialStats.getMax());
+}
+
+TEST(fractionStats, wideMoments)
+{
+    // coprime large denominators overflow the 64 bit terms of the moments
+    const std::vector<Fraction> cValues{{1, INT_MAX}, {1, INT_MAX - 1}, {1, INT_MAX - 2}, {INT_MAX, 3}, {-7, 1000003}};
+    FractionStats stats;
+    FractionStats narrowStats;
+
+    for (const Fraction& value : cValues)
+    {
+        stats.add(value);
+    }
+
+    narrowStats.add(Fraction{1, 2});
+
+    const auto [cMean, cVariance]{getTwoPassesMoments(cValues)};
+
+    EXPECT_TRUE(stats.isWide());
+    EXPECT_EQ(stats.getMean(), cMean);
+    EXPECT_EQ(stats.getVariance(), cVariance);
+
+    // merging a narrow state into a wide state and the other way around
+    FractionStats mergedStats{narrowStats};
+    mergedStats.merge(stats);
+    narrowStats.add(Fraction{0});
+    stats.merge(narrowStats);
+
+    std::vector<Fraction> allValues{cValues};
+    allValues.push_back(Fraction{1, 2});
+
+    EXPECT_TRUE(mergedStats.isWide());
+    EXPECT_EQ(mergedStats.getVariance(), getTwoPassesMoments(allValues).second);
+
+    allValues.push_back(Fraction{0});
+    EXPECT_EQ(stats.getVariance(), getTwoPassesMoments(allValues).second);
+}
+
+/* Test the sliding window sum and mean */
+
+TEST(fractionStats, window)
+{
+    std::mt19937 generator{430};
+    std::uniform_int_distribution<int> numeratorDistribution{-100, 100};
+    std::uniform_int_distribution<int> denominatorDistribution{1, 20};
+    std::vector<Fraction> values;
+    FractionWindowStats windowStats{10};
+
+    EXPECT_THROW(FractionWindowStats{0}, std::runtime_error);
+    EXPECT_THROW(windowStats.getMean(), std::runtime_error);
+
+    for (size_t index{0}; index < 100; ++index)
+    {
+        values.emplace_back(numeratorDistribution(generator), denominatorDistribution(generator));
+        windowStats.add(values.back());
+
+        WideFraction sum;
+
+        for (size_t valueIndex{index >= 10 ? index - 9 : 0}; valueIndex <= index; ++valueIndex)
+        {
+            sum += WideFraction{values[valueIndex]};
+        }
+
+        ASSERT_EQ(windowStats.getSum(), sum);
+        ASSERT_EQ(windowStats.getCount(), std::min<size_t>(index + 1, 10));
+    }
+
+    EXPECT_EQ(windowStats.getMean(), windowStats.getSum() / WideFraction{WideInteger{10}});
+}
+
+TEST(fractionStats, wideWindow)
+{
+    FractionWindowStats windowStats{3};
+
+    windowStats.add(Fraction{1, INT_MAX});
+    windowStats.add(Fraction{1, INT_MAX - 1});
+    windowStats.add(Fraction{1, INT_MAX - 2});
+
+    EXPECT_TRUE(windowStats.isWide());
+    EXPECT_EQ(windowStats.getSum(), WideFraction(Fraction(1, INT_MAX)) + WideFraction(Fraction(1, INT_MAX - 1)) + WideFraction(Fraction(1, INT_MAX - 2)));
+
+    // the large denominators leave the window
+    for (int value{1}; value <= 3; ++value)
+    {
+        windowStats.add(Fraction{value});
+    }
+
+    EXPECT_FALSE(windowStats.isWide());
+    EXPECT_EQ(windowStats.getSum(), WideFraction(Fraction(6)));
+    EXPECT_EQ(windowStats.getMean(), WideFraction(Fraction(2)));
+}
+
+/* Test the exact quantiles */
+
+TEST(fractionStats, quantiles)
+{
+    FractionQuantiles quantiles;
+
+    EXPECT_THROW(quantiles.getMedian(), std::runtime_error);
+
+    for (int value{10}; value >= 1; --value)
+    {
+        quantiles.add(Fraction{value, 4});
+    }
+
+    quantiles.add(Fraction{1, 2}, 5);
+
+    // 1/4, 1/2 (6 times), 3/4, 1, ..., 5/2
+    EXPECT_EQ(quantiles.getCount(), 15u);
+    EXPECT_EQ(quantiles.getDistinctValuesCount(), 10u);
+    EXPECT_EQ(quantiles.getQuantile(Fraction{0}), Fraction(1, 4));
+    EXPECT_EQ(quantiles.getQuantile(Fraction{1, 15}), Fraction(1, 4));
+    EXPECT_EQ(quantiles.getQuantile(Fraction{2, 15}), Fraction(1, 2));
+    EXPECT_EQ(quantiles.getMedian(), Fraction(3, 4));
+    EXPECT_EQ(quantiles.getQuantile(Fraction{9, 15}), Fraction(1));
+    EXPECT_EQ(quantiles.getQuantile(Fraction{1}), Fraction(5, 2));
+    EXPECT_THROW(quantiles.getQuantile(Fraction{3, 2}), std::runtime_error);
+
+    quantiles.remove(Fraction{1, 4});
+    EXPECT_EQ(quantiles.getQuantile(Fraction{0}), Fraction(1, 2));
+    EXPECT_EQ(quantiles.getDistinctValuesCount(), 9u);
+    EXPECT_THROW(quantiles.remove(Fraction{1, 4}), std::runtime_error);
+
+    FractionQuantiles otherQuantiles;
+    otherQuantiles.add(Fraction{-1}, 20);
+    quantiles.merge(otherQuantiles);
+
+    EXPECT_EQ(quantiles.getCount(), 34u);
+    EXPECT_EQ(quantiles.getMedian(), Fraction(-1));
+    EXPECT_EQ(quantiles.getQuantile(Fraction{3, 4}), Fraction(1, 2));
+}
+
+TEST(fractionStats, largeTerms)
+{
+    // the int cross products of these values overflow and reverse their order
+    const std::vector<Fraction> cValues{{99999, 100000}, {-70000, 3}, {3, 70001}, {70000, 3}, {-100000, 100001}};
+    FractionStats stats;
+    FractionStats otherStats;
+    FractionQuantiles quantiles;
+
+    for (size_t index{0}; index < cValues.size(); ++index)
+    {
+        (index < 2 ? stats : otherStats).add(cValues[index]);
+        quantiles.add(cValues[index]);
+    }
+
+    stats.merge(otherStats);
+
+    EXPECT_EQ(stats.getMin(), Fraction(-70000, 3));
+    EXPECT_EQ(stats.getMax(), Fraction(70000, 3));
+    EXPECT_EQ(quantiles.getDistinctValuesCount(), 5u);
+    EXPECT_EQ(quantiles.getQuantile(Fraction{1, 5}), Fraction(-70000, 3));
+    EXPECT_EQ(quantiles.getQuantile(Fraction{2, 5}), Fraction(-100000, 100001));
+    EXPECT_EQ(quantiles.getMedian(), Fraction(3, 70001));
+    EXPECT_EQ(quantiles.getQuantile(Fraction{4, 5}), Fraction(99999, 100000));
+    EXPECT_EQ(quantiles.getQuantile(Fraction{1}), Fraction(70000, 3));
+}
+
+TEST(fractionStats, quantilesRandomized)
+{
+    std::mt19937 generator{4343};
+    std::uniform_int_distribution<int> numeratorDistribution{-20, 20};
+    std::vector<Fraction> values;
+    FractionQuantiles quantiles;
+
+    for (size_t index{0}; index < 1000; ++index)
+    {
+        values.emplace_back(numeratorDistribution(generator), 3);
+        quantiles.add(values.back());
+    }
+
+    std::sort(values.begin(), values.end());
+
+    EXPECT_EQ(quantiles.getDistinctValuesCount(), 41u);
+
+    for (int percent{1}; percent <= 100; ++percent)
+    {
+        EXPECT_EQ(quantiles.getQuantile(Fraction{percent, 100}), values[(percent * 1000 + 99) / 100 - 1]);
+    }
+}
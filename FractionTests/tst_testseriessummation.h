@@ -0,0 +1,77 @@
+#pragma once
+
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/seriessummation.h"
+
+
+using namespace testing;
+
+/* Test the sums of independent terms */
+
+TEST(seriesSummation, sumTerms)
+{
+    const SeriesSummation::TermFunction cHarmonicTerm{[](long long index) {return SeriesSummation::Term{1, index};}};
+
+    EXPECT_EQ(SeriesSummation::sumTerms(cHarmonicTerm, 1, 11), WideFraction(WideInteger{7381}, WideInteger{2520}));
+    EXPECT_EQ(SeriesSummation::sumTerms(cHarmonicTerm, 1, 2), WideFraction(WideInteger{1}));
+    EXPECT_EQ(SeriesSummation::sumTerms(cHarmonicTerm, 5, 5), WideFraction{});
+
+    // sum of (-1)^k / (2k + 1) compared to the naive summation, serial and parallel
+    const SeriesSummation::TermFunction cLeibnizTerm{[](long long index) {return SeriesSummation::Term{0 == index % 2 ? 1 : -1, 2 * index + 1};}};
+    WideFraction expected;
+
+    for (long long index{0}; index < 300; ++index)
+    {
+        expected += WideFraction{WideInteger{0 == index % 2 ? 1 : -1}, WideInteger{2 * index + 1}};
+    }
+
+    EXPECT_EQ(SeriesSummation::sumTerms(cLeibnizTerm, 0, 300), expected);
+    EXPECT_EQ(SeriesSummation::sumTerms(cLeibnizTerm, 0, 300, 4), expected);
+
+    EXPECT_THROW(SeriesSummation::sumTerms(cHarmonicTerm, 0, 10), std::runtime_error);
+}
+
+/* Test the hypergeometric (ratio products) series */
+
+TEST(seriesSummation, sumRatioProducts)
+{
+    const SeriesSummation::TermFunction cFactorialRatio{[](long long index) {return SeriesSummation::Term{1, index};}};
+
+    // e - 1 = 1/1! + 1/2! + ... , the partial sum up to 1/5! is 206/120
+    EXPECT_EQ(SeriesSummation::sumRatioProducts(cFactorialRatio, 1, 6), WideFraction(WideInteger{103}, WideInteger{60}));
+
+    // geometric series 1/2 + 1/4 + ... + 1/2^n = 1 - 1/2^n
+    const SeriesSummation::TermFunction cHalfRatio{[](long long) {return SeriesSummation::Term{1, 2};}};
+
+    EXPECT_EQ(SeriesSummation::sumRatioProducts(cHalfRatio, 0, 100, 3), WideFraction{1} - WideFraction(WideInteger{1}, WideInteger{1} << 100));
+    EXPECT_EQ(SeriesSummation::sumRatioProducts(cHalfRatio, 3, 2), WideFraction{});
+
+    // random rational ratios compared to the naive product accumulation
+    std::mt19937 generator{37};
+    std::uniform_int_distribution<long long> numeratorDistribution{-20, 20};
+    std::uniform_int_distribution<long long> denominatorDistribution{1, 20};
+    std::vector<SeriesSummation::Term> ratios;
+
+    for (size_t index{0}; index < 200; ++index)
+    {
+        ratios.push_back(SeriesSummation::Term{numeratorDistribution(generator), denominatorDistribution(generator)});
+    }
+
+    WideFraction expected;
+    WideFraction product{1};
+
+    for (const SeriesSummation::Term& ratio : ratios)
+    {
+        product *= WideFraction{ratio.numerator, ratio.denominator};
+        expected += product;
+    }
+
+    const SeriesSummation::TermFunction cRandomRatio{[&ratios](long long index) {return ratios[index];}};
+
+    EXPECT_EQ(SeriesSummation::sumRatioProducts(cRandomRatio, 0, 200), expected);
+    EXPECT_EQ(SeriesSummation::sumRatioProducts(cRandomRatio, 0, 200, 0), expected);
+}
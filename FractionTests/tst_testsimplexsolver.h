@@ -0,0 +1,174 @@
+#pragma once
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/simplexsolver.h"
+
+
+using namespace testing;
+
+/* Test the optimal solutions and their certificates */
+
+TEST(simplexSolver, maximization)
+{
+    SimplexSolver solver{2};
+    solver.setObjective({Fraction{3}, Fraction{5}}, true);
+    solver.addConstraint({Fraction{1}, Fraction{0}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{4});
+    solver.addConstraint({Fraction{0}, Fraction{2}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{12});
+    solver.addConstraint({Fraction{3}, Fraction{2}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{18});
+
+    const SimplexSolver::Result cResult{solver.solve()};
+
+    ASSERT_EQ(cResult.status, SimplexSolver::Status::OPTIMAL);
+    EXPECT_EQ(cResult.objectiveValue, WideFraction{Fraction{36}});
+    EXPECT_EQ(cResult.primalValues, (std::vector<WideFraction>{Fraction{2}, Fraction{6}}));
+
+    // the duals certify the optimum: they are dual feasible and b * y equals the objective value
+    EXPECT_EQ(cResult.dualValues, (std::vector<WideFraction>{Fraction{0}, Fraction{3, 2}, Fraction{1}}));
+}
+
+TEST(simplexSolver, mixedConstraints)
+{
+    // minimize 2x + 3y with x + y >= 4, x - y = 1, -x <= -1 (negative right hand side)
+    SimplexSolver solver{2};
+    solver.setObjective({Fraction{2}, Fraction{3}}, false);
+    solver.addConstraint({Fraction{1}, Fraction{1}}, SimplexSolver::ConstraintType::GREATER_OR_EQUAL, Fraction{4});
+    solver.addConstraint({Fraction{1}, Fraction{-1}}, SimplexSolver::ConstraintType::EQUAL, Fraction{1});
+    solver.addConstraint({Fraction{-1}, Fraction{0}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{-1});
+
+    const SimplexSolver::Result cResult{solver.solve()};
+
+    ASSERT_EQ(cResult.status, SimplexSolver::Status::OPTIMAL);
+    EXPECT_EQ(cResult.objectiveValue, WideFraction(Fraction{19, 2}));
+    EXPECT_EQ(cResult.primalValues, (std::vector<WideFraction>{Fraction{5, 2}, Fraction{3, 2}}));
+
+    const WideFraction cDualObjective{WideFraction{Fraction{4}} * cResult.dualValues[0] + cResult.dualValues[1] - cResult.dualValues[2]};
+
+    EXPECT_EQ(cDualObjective, cResult.objectiveValue);
+    EXPECT_GE(cResult.dualValues[0], WideFraction{});
+    EXPECT_LE(cResult.dualValues[2], WideFraction{});
+    EXPECT_LE(cResult.dualValues[0] + cResult.dualValues[1] - cResult.dualValues[2], WideFraction{Fraction{2}});
+    EXPECT_LE(cResult.dualValues[0] - cResult.dualValues[1], WideFraction{Fraction{3}});
+}
+
+TEST(simplexSolver, redundantConstraints)
+{
+    SimplexSolver solver{2};
+    solver.setObjective({Fraction{1}, Fraction{0}}, true);
+    solver.addConstraint({Fraction{1}, Fraction{1}}, SimplexSolver::ConstraintType::EQUAL, Fraction{2});
+    solver.addConstraint({Fraction{2}, Fraction{2}}, SimplexSolver::ConstraintType::EQUAL, Fraction{4});
+
+    const SimplexSolver::Result cResult{solver.solve()};
+
+    ASSERT_EQ(cResult.status, SimplexSolver::Status::OPTIMAL);
+    EXPECT_EQ(cResult.objectiveValue, WideFraction{Fraction{2}});
+    EXPECT_EQ(cResult.primalValues, (std::vector<WideFraction>{Fraction{2}, Fraction{0}}));
+}
+
+TEST(simplexSolver, degenerateCycling)
+{
+    // classic example on which the textbook Dantzig rule (without anti-cycling) cycles forever
+    for (const SimplexSolver::PivotingRule pivotingRule : {SimplexSolver::PivotingRule::BLAND, SimplexSolver::PivotingRule::DANTZIG})
+    {
+        SimplexSolver solver{4};
+        solver.setPivotingRule(pivotingRule);
+        solver.setObjective({Fraction{-3, 4}, Fraction{150}, Fraction{-1, 50}, Fraction{6}}, false);
+        solver.addConstraint({Fraction{1, 4}, Fraction{-60}, Fraction{-1, 25}, Fraction{9}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{0});
+        solver.addConstraint({Fraction{1, 2}, Fraction{-90}, Fraction{-1, 50}, Fraction{3}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{0});
+        solver.addConstraint({Fraction{0}, Fraction{0}, Fraction{1}, Fraction{0}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{1});
+
+        const SimplexSolver::Result cResult{solver.solve()};
+
+        ASSERT_EQ(cResult.status, SimplexSolver::Status::OPTIMAL);
+        EXPECT_EQ(cResult.objectiveValue, WideFraction(Fraction{-1, 20}));
+        EXPECT_EQ(cResult.primalValues, (std::vector<WideFraction>{Fraction{1, 25}, Fraction{0}, Fraction{1}, Fraction{0}}));
+    }
+}
+
+/* Test the infeasibility and unboundedness certificates */
+
+TEST(simplexSolver, infeasibleProblem)
+{
+    SimplexSolver solver{2};
+    solver.setObjective({Fraction{1}, Fraction{1}}, false);
+    solver.addConstraint({Fraction{1}, Fraction{1}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{1});
+    solver.addConstraint({Fraction{1}, Fraction{2}}, SimplexSolver::ConstraintType::GREATER_OR_EQUAL, Fraction{3});
+
+    const SimplexSolver::Result cResult{solver.solve()};
+
+    ASSERT_EQ(cResult.status, SimplexSolver::Status::INFEASIBLE);
+    ASSERT_EQ(cResult.dualValues.size(), 2u);
+
+    // Farkas certificate: y * A <= 0 column-wise, y_0 <= 0 (<= row), y_1 >= 0 (>= row), y * b > 0
+    const std::vector<WideFraction>& cFarkas{cResult.dualValues};
+
+    EXPECT_LE(cFarkas[0], WideFraction{});
+    EXPECT_GE(cFarkas[1], WideFraction{});
+    EXPECT_LE(cFarkas[0] + cFarkas[1], WideFraction{});
+    EXPECT_LE(cFarkas[0] + WideFraction{Fraction{2}} * cFarkas[1], WideFraction{});
+    EXPECT_GT(cFarkas[0] + WideFraction{Fraction{3}} * cFarkas[1], WideFraction{});
+}
+
+TEST(simplexSolver, unboundedProblem)
+{
+    SimplexSolver solver{2};
+    solver.setObjective({Fraction{1}, Fraction{1}}, true);
+    solver.addConstraint({Fraction{1}, Fraction{-1}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{1});
+    solver.addConstraint({Fraction{-2}, Fraction{1}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{2});
+
+    const SimplexSolver::Result cResult{solver.solve()};
+
+    ASSERT_EQ(cResult.status, SimplexSolver::Status::UNBOUNDED);
+    ASSERT_EQ(cResult.unboundedRay.size(), 2u);
+
+    const std::vector<WideFraction>& cRay{cResult.unboundedRay};
+
+    EXPECT_GE(cRay[0], WideFraction{});
+    EXPECT_GE(cRay[1], WideFraction{});
+    EXPECT_LE(cRay[0] - cRay[1], WideFraction{});
+    EXPECT_LE(cRay[1] - WideFraction{Fraction{2}} * cRay[0], WideFraction{});
+    EXPECT_GT(cRay[0] + cRay[1], WideFraction{});
+}
+
+/* Test the warm start */
+
+TEST(simplexSolver, warmStart)
+{
+    SimplexSolver solver{3};
+    solver.setObjective({Fraction{2}, Fraction{3}, Fraction{4}}, true);
+    solver.addConstraint({Fraction{3}, Fraction{2}, Fraction{1}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{10});
+    solver.addConstraint({Fraction{2}, Fraction{5}, Fraction{3}}, SimplexSolver::ConstraintType::LESS_OR_EQUAL, Fraction{15});
+    solver.addConstraint({Fraction{1}, Fraction{1}, Fraction{1}}, SimplexSolver::ConstraintType::GREATER_OR_EQUAL, Fraction{1});
+
+    const SimplexSolver::Result cColdResult{solver.solve()};
+
+    ASSERT_EQ(cColdResult.status, SimplexSolver::Status::OPTIMAL);
+    EXPECT_GT(cColdResult.iterationsCount, 0u);
+
+    // a small change of the right hand side keeps the optimal basis feasible, so no pivots are needed
+    solver.setRightHandSide(1, Fraction{16});
+
+    const SimplexSolver::Result cWarmResult{solver.solve(cColdResult.basis)};
+    const SimplexSolver::Result cReferenceResult{solver.solve()};
+
+    ASSERT_EQ(cWarmResult.status, SimplexSolver::Status::OPTIMAL);
+    EXPECT_EQ(cWarmResult.iterationsCount, 0u);
+    EXPECT_EQ(cWarmResult.objectiveValue, cReferenceResult.objectiveValue);
+    EXPECT_EQ(cWarmResult.primalValues, cReferenceResult.primalValues);
+
+    // invalid bases are ignored
+    EXPECT_EQ(solver.solve({0, 0, 1}).objectiveValue, cReferenceResult.objectiveValue);
+    EXPECT_EQ(solver.solve({0, 1, 100}).objectiveValue, cReferenceResult.objectiveValue);
+    EXPECT_EQ(solver.solve({0}).objectiveValue, cReferenceResult.objectiveValue);
+}
+
+TEST(simplexSolver, invalidInput)
+{
+    SimplexSolver solver{2};
+
+    EXPECT_THROW(solver.setObjective({Fraction{1}}, false), std::runtime_error);
+    EXPECT_THROW(solver.addConstraint({Fraction{1}, Fraction{2}, Fraction{3}}, SimplexSolver::ConstraintType::EQUAL, Fraction{1}), std::runtime_error);
+    EXPECT_THROW(solver.setRightHandSide(0, Fraction{1}), std::runtime_error);
+}
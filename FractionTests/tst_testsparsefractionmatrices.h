@@ -0,0 +1,149 @@
+#pragma once
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/sparsefractionmatrix.h"
+
+
+using namespace testing;
+
+/* Test the compressed storage */
+
+TEST(sparseFractionMatrices, compressedRows)
+{
+    const SparseFractionMatrix cMatrix{3, 4, {{2, 3, Fraction{1, 2}}, {0, 1, Fraction{3}}, {2, 0, Fraction{-1, 4}}, {0, 1, Fraction{1, 2}},
+                                              {1, 2, Fraction{1, 3}}, {1, 2, Fraction{-1, 3}}}};
+
+    // duplicates are summed up and the resulting zero is not stored
+    EXPECT_EQ(cMatrix.getNonZerosCount(), 3u);
+    EXPECT_EQ(cMatrix.getRowOffsets(), (std::vector<size_t>{0, 1, 1, 3}));
+    EXPECT_EQ(cMatrix.getColumnIndices(), (std::vector<size_t>{1, 0, 3}));
+    EXPECT_EQ(cMatrix.getElement(0, 1), Fraction(7, 2));
+    EXPECT_EQ(cMatrix.getElement(2, 3), Fraction(1, 2));
+    EXPECT_EQ(cMatrix.getElement(1, 2), Fraction(0));
+    EXPECT_THROW(cMatrix.getElement(3, 0), std::runtime_error);
+    EXPECT_THROW(SparseFractionMatrix(2, 2, {{0, 2, Fraction{1}}}), std::runtime_error);
+
+    // the duplicates are summed up exactly (the intermediate denominators exceed 64 bits), sums out of the int range throw
+    const SparseFractionMatrix cLargeTermsMatrix{1, 1, {{0, 0, Fraction{1, 2147483647}}, {0, 0, Fraction{1, 2147483629}}, {0, 0, Fraction{1, 2147483587}},
+                                                        {0, 0, Fraction{-1, 2147483647}}, {0, 0, Fraction{-1, 2147483629}}}};
+
+    EXPECT_EQ(cLargeTermsMatrix.getElement(0, 0), Fraction(1, 2147483587));
+    EXPECT_THROW(SparseFractionMatrix(1, 1, {{0, 0, Fraction{2147483647}}, {0, 0, Fraction{2147483647}}}), std::overflow_error);
+}
+
+TEST(sparseFractionMatrices, compressedColumns)
+{
+    const SparseFractionMatrix cMatrix{2, 3, {{0, 0, Fraction{1}}, {0, 2, Fraction{2}}, {1, 1, Fraction{3}}, {1, 2, Fraction{4}}}};
+    const SparseFractionMatrix cTransposedMatrix{cMatrix.transpose()};
+
+    EXPECT_EQ(cTransposedMatrix.getRowsCount(), 3u);
+    EXPECT_EQ(cTransposedMatrix.getColumnsCount(), 2u);
+    EXPECT_EQ(cTransposedMatrix.getRowOffsets(), (std::vector<size_t>{0, 1, 2, 4}));
+    EXPECT_EQ(cTransposedMatrix.getColumnIndices(), (std::vector<size_t>{0, 1, 0, 1}));
+    EXPECT_EQ(cTransposedMatrix.getElement(2, 1), Fraction(4));
+}
+
+TEST(sparseFractionMatrices, matrixVectorProduct)
+{
+    const SparseFractionMatrix cMatrix{2, 3, {{0, 0, Fraction{1, 2}}, {0, 2, Fraction{2, 3}}, {1, 0, Fraction{2000000000}},
+                                              {1, 1, Fraction{2000000000}}, {1, 2, Fraction{2000000000}}}};
+
+    // the partial sums of the second row are out of the int range
+    const std::vector<Fraction> cProduct{cMatrix.multiply({Fraction{1}, Fraction{1}, Fraction{-1}})};
+
+    ASSERT_EQ(cProduct.size(), 2u);
+    EXPECT_EQ(cProduct[0], Fraction(-1, 6));
+    EXPECT_EQ(cProduct[1], Fraction(2000000000));
+    EXPECT_THROW(cMatrix.multiply({Fraction{1}}), std::runtime_error);
+    EXPECT_THROW(cMatrix.multiply({Fraction{1}, Fraction{1}, Fraction{1}}), std::runtime_error);
+}
+
+/* Test the sparse LU factorization */
+
+TEST(sparseFractionMatrices, factorizeAndSolve)
+{
+    // arrow matrix: a bad pivot order (dense row/column first) fills in the whole matrix, Markowitz avoids it
+    const size_t cSize{50};
+    std::vector<SparseFractionMatrixEntry> entries;
+    std::vector<Fraction> rightHandSide(cSize);
+
+    for (size_t index{0}; index < cSize; ++index)
+    {
+        entries.push_back({index, index, Fraction{static_cast<int>(index % 3) + 2, 3}});
+
+        if (index > 0)
+        {
+            entries.push_back({0, index, Fraction{1}});
+            entries.push_back({index, 0, Fraction{-1, 2}});
+        }
+    }
+
+    const SparseFractionMatrix cMatrix{cSize, cSize, entries};
+
+    // choose the solution x = (1, 2, ..., n) and compute the matching right hand side
+    std::vector<Fraction> expectedSolution(cSize);
+
+    for (size_t index{0}; index < cSize; ++index)
+    {
+        expectedSolution[index] = Fraction{static_cast<int>(index) + 1};
+    }
+
+    rightHandSide = cMatrix.multiply(expectedSolution);
+
+    const SparseLUFactorization cFactorization{cMatrix};
+    const std::vector<WideFraction> cSolution{cFactorization.solve(rightHandSide)};
+
+    ASSERT_EQ(cSolution.size(), cSize);
+
+    for (size_t index{0}; index < cSize; ++index)
+    {
+        EXPECT_EQ(cSolution[index], WideFraction{expectedSolution[index]});
+    }
+
+    EXPECT_EQ(cFactorization.getStatistics().matrixNonZerosCount, 3 * cSize - 2);
+    EXPECT_EQ(cFactorization.getStatistics().fillInCount, 0u);
+    EXPECT_EQ(cFactorization.getStatistics().lowerNonZerosCount + cFactorization.getStatistics().upperNonZerosCount, 3 * cSize - 2);
+    EXPECT_FALSE(cFactorization.getStatistics().isWideArithmeticUsed);
+    EXPECT_THROW(cFactorization.solve({Fraction{1}}), std::runtime_error);
+}
+
+TEST(sparseFractionMatrices, wideArithmeticFallback)
+{
+    // the factors of the Hilbert matrix quickly outgrow the 64 bit terms
+    const size_t cSize{24};
+    std::vector<SparseFractionMatrixEntry> entries;
+    std::vector<Fraction> firstColumn(cSize);
+
+    for (size_t row{0}; row < cSize; ++row)
+    {
+        for (size_t column{0}; column < cSize; ++column)
+        {
+            entries.push_back({row, column, Fraction{1, static_cast<int>(row + column + 1)}});
+        }
+
+        firstColumn[row] = Fraction{1, static_cast<int>(row + 1)};
+    }
+
+    const SparseLUFactorization cFactorization{SparseFractionMatrix{cSize, cSize, entries}};
+    const std::vector<WideFraction> cSolution{cFactorization.solve(firstColumn)};
+
+    EXPECT_TRUE(cFactorization.getStatistics().isWideArithmeticUsed);
+    EXPECT_EQ(cSolution[0], WideFraction{Fraction{1}});
+
+    for (size_t index{1}; index < cSize; ++index)
+    {
+        EXPECT_EQ(cSolution[index], WideFraction{});
+    }
+}
+
+TEST(sparseFractionMatrices, singularMatrix)
+{
+    const SparseFractionMatrix cMatrix{3, 3, {{0, 0, Fraction{1}}, {0, 1, Fraction{2}}, {1, 0, Fraction{1, 2}}, {1, 1, Fraction{1}}, {2, 2, Fraction{5}}}};
+
+    EXPECT_THROW(SparseLUFactorization{cMatrix}, std::runtime_error);
+    EXPECT_THROW(SparseLUFactorization{SparseFractionMatrix(2, 3, {})}, std::runtime_error);
+    EXPECT_THROW(SparseLUFactorization{SparseFractionMatrix(2, 2, {{0, 0, Fraction{1}}})}, std::runtime_error);
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <stdexcept>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "../FractionLib/wideinteger.h"
+#include "../FractionLib/widefraction.h"
+#include "../FractionLib/checkedfraction.h"
+
+
+using namespace testing;
+
+/* Test the wide integers */
+
+TEST(wideIntegers, stringConversions)
+{
+    EXPECT_EQ(WideInteger{"0"}.toString(), "0");
+    EXPECT_EQ(WideInteger{"-0"}.toString(), "0");
+    EXPECT_EQ(WideInteger{"+17"}.toString(), "17");
+    EXPECT_EQ(WideInteger{"-123456789012345678901234567890"}.toString(), "-123456789012345678901234567890");
+    EXPECT_EQ(WideInteger{"1000000000000000000000"}.toString(), "1000000000000000000000");
+    EXPECT_THROW(WideInteger{""}, std::runtime_error);
+    EXPECT_THROW(WideInteger{"-"}, std::runtime_error);
+    EXPECT_THROW(WideInteger{"12a"}, std::runtime_error);
+}
+
+TEST(wideIntegers, arithmeticOperators)
+{
+    const WideInteger cFirst{"123456789012345678901234567890"};
+    const WideInteger cSecond{"-987654321098765432109876543210"};
+
+    EXPECT_EQ((cFirst + cSecond).toString(), "-864197532086419753208641975320");
+    EXPECT_EQ((cFirst - cSecond).toString(), "1111111110111111111011111111100");
+    EXPECT_EQ((cFirst * cSecond).toString(), "-121932631137021795226185032733622923332237463801111263526900");
+    EXPECT_EQ((cSecond / cFirst).toString(), "-8");
+    EXPECT_EQ((cSecond % cFirst).toString(), "-9000000000900000000090");
+    EXPECT_EQ((cFirst * cSecond) / cSecond, cFirst);
+    EXPECT_EQ(WideInteger{-7} / WideInteger{2}, WideInteger{-3});
+    EXPECT_EQ(WideInteger{-7} % WideInteger{2}, WideInteger{-1});
+    EXPECT_THROW(cFirst / WideInteger{}, std::runtime_error);
+}
+
+TEST(wideIntegers, longDivision)
+{
+    // divisors with several limbs exercise the quotient estimate corrections
+    const WideInteger cDividend{"340282366920938463463374607431768211455"};
+    const WideInteger cDivisor{"18446744073709551617"};
+    WideInteger quotient;
+    WideInteger remainder;
+
+    WideInteger::divide(cDividend, cDivisor, quotient, remainder);
+    EXPECT_EQ(quotient.toString(), "18446744073709551615");
+    EXPECT_EQ(remainder.toString(), "0");
+
+    WideInteger::divide(cDividend + WideInteger{5}, cDivisor, quotient, remainder);
+    EXPECT_EQ(quotient * cDivisor + remainder, cDividend + WideInteger{5});
+    EXPECT_LT(remainder, cDivisor);
+}
+
+TEST(wideIntegers, shiftOperators)
+{
+    EXPECT_EQ((WideInteger{3} << 100).toString(), "3802951800684688204490109616128");
+    EXPECT_EQ((WideInteger{"3802951800684688204490109616128"} >> 99), WideInteger{6});
+    EXPECT_EQ(WideInteger{-5} >> 1, WideInteger{-2});
+    EXPECT_EQ(WideInteger{5} >> 64, WideInteger{});
+}
+
+TEST(wideIntegers, comparisonOperators)
+{
+    EXPECT_LT(WideInteger{-5}, WideInteger{3});
+    EXPECT_LT(WideInteger{"-100000000000000000000"}, WideInteger{-5});
+    EXPECT_GT(WideInteger{"100000000000000000000"}, WideInteger{"99999999999999999999"});
+    EXPECT_EQ(WideInteger{"-0"}, WideInteger{0});
+    EXPECT_FALSE(WideInteger{0});
+    EXPECT_TRUE(WideInteger{-1});
+}
+
+TEST(wideIntegers, nativeConversions)
+{
+    EXPECT_TRUE(WideInteger{2147483647}.fitsInt());
+    EXPECT_TRUE(WideInteger{-2147483648LL}.fitsInt());
+    EXPECT_FALSE(WideInteger{2147483648LL}.fitsInt());
+    EXPECT_FALSE(WideInteger{-2147483649LL}.fitsInt());
+    EXPECT_EQ(WideInteger{-2147483648LL}.toInt(), -2147483647 - 1);
+    EXPECT_EQ(WideInteger{std::numeric_limits<long long>::min()}.toLongLong(), std::numeric_limits<long long>::min());
+    EXPECT_THROW(WideInteger{"9223372036854775808"}.toLongLong(), std::runtime_error);
+    EXPECT_DOUBLE_EQ(WideInteger{"-1000000000000000000000"}.toDouble(), -1e21);
+}
+
+TEST(wideIntegers, greatestCommonDivisor)
+{
+    EXPECT_EQ(WideInteger::getGreatestCommonDivisor(WideInteger{-12}, WideInteger{18}), WideInteger{6});
+    EXPECT_EQ(WideInteger::getGreatestCommonDivisor(WideInteger{0}, WideInteger{-7}), WideInteger{7});
+    EXPECT_EQ(WideInteger::getGreatestCommonDivisor(WideInteger{"121932631137021795226185032733622923332237463801111263526900"},
+                                                    WideInteger{"123456789012345678901234567890"}).toString(), "123456789012345678901234567890");
+    EXPECT_EQ(WideInteger::getLeastCommonMultiple(WideInteger{4}, WideInteger{-6}), WideInteger{12});
+    EXPECT_THROW(WideInteger::getGreatestCommonDivisor(WideInteger{}, WideInteger{}), std::runtime_error);
+}
+
+/* Test the wide fractions */
+
+TEST(wideFractions, normalization)
+{
+    const WideFraction cFraction{WideInteger{6}, WideInteger{-8}};
+
+    EXPECT_EQ(cFraction.getNumerator(), WideInteger{-3});
+    EXPECT_EQ(cFraction.getDenominator(), WideInteger{4});
+    EXPECT_EQ(WideFraction(WideInteger{0}, WideInteger{-5}).getDenominator(), WideInteger{1});
+    EXPECT_THROW(WideFraction(WideInteger{1}, WideInteger{0}), std::runtime_error);
+}
+
+TEST(wideFractions, arithmeticOperators)
+{
+    const WideFraction cFirst{Fraction{1, 6}};
+    const WideFraction cSecond{Fraction{-3, 4}};
+
+    EXPECT_EQ(cFirst + cSecond, WideFraction(Fraction{-7, 12}));
+    EXPECT_EQ(cFirst - cSecond, WideFraction(Fraction{11, 12}));
+    EXPECT_EQ(cFirst * cSecond, WideFraction(Fraction{-1, 8}));
+    EXPECT_EQ(cFirst / cSecond, WideFraction(Fraction{-2, 9}));
+    EXPECT_EQ(cSecond.inverse(), WideFraction(Fraction{-4, 3}));
+    EXPECT_THROW(WideFraction{}.inverse(), std::runtime_error);
+    EXPECT_THROW(cFirst / WideFraction{}, std::runtime_error);
+}
+
+TEST(wideFractions, fractionConversions)
+{
+    const WideFraction cLarge{WideInteger{"10000000000"}, WideInteger{3}};
+
+    EXPECT_TRUE(WideFraction(Fraction{5, 7}).fitsFraction());
+    EXPECT_EQ(WideFraction(Fraction{5, 7}).toFraction(), Fraction(5, 7));
+    EXPECT_FALSE(cLarge.fitsFraction());
+    EXPECT_THROW(cLarge.toFraction(), std::runtime_error);
+    EXPECT_DOUBLE_EQ(cLarge.getDecimalValue(), 1e10 / 3);
+    EXPECT_EQ(cLarge.toString(), "10000000000/3");
+}
+
+TEST(wideFractions, comparisonOperators)
+{
+    EXPECT_LT(WideFraction(Fraction{1, 3}), WideFraction(Fraction{1, 2}));
+    EXPECT_GT(WideFraction(Fraction{-1, 3}), WideFraction(Fraction{-1, 2}));
+    EXPECT_EQ(WideFraction(Fraction{2, 4}), WideFraction(Fraction{1, 2}));
+}
+
+/* Test the overflow checked fractions */
+
+TEST(checkedFractions, arithmeticOperators)
+{
+    const CheckedFraction cFirst{3000000000LL, 7};
+    const CheckedFraction cSecond{-5, 14};
+
+    EXPECT_EQ(cFirst + cSecond, CheckedFraction(5999999995LL, 14));
+    EXPECT_EQ(cFirst * cSecond, CheckedFraction(-7500000000LL, 49));
+    EXPECT_EQ(cFirst / cSecond, CheckedFraction(-1200000000LL));
+    EXPECT_EQ(CheckedFraction(4, -6), CheckedFraction(-2, 3));
+    EXPECT_THROW(cFirst / CheckedFraction{}, std::runtime_error);
+    EXPECT_THROW(CheckedFraction(1, 0), std::runtime_error);
+}
+
+TEST(checkedFractions, overflowDetection)
+{
+    const CheckedFraction cLarge{std::numeric_limits<long long>::max() / 2};
+
+    EXPECT_NO_THROW(cLarge + cLarge);
+    EXPECT_THROW(cLarge * CheckedFraction{7}, std::overflow_error);
+    EXPECT_THROW(cLarge + CheckedFraction(1, 5), std::overflow_error);
+    EXPECT_THROW(CheckedFraction(std::numeric_limits<long long>::min()), std::overflow_error);
+    EXPECT_FALSE(cLarge.fitsFraction());
+    EXPECT_THROW(cLarge.toFraction(), std::runtime_error);
+    EXPECT_EQ(cLarge.toWideFraction().toString(), "4611686018427387903/1");
+}